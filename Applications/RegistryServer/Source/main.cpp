@@ -11,6 +11,7 @@
 #include "Beam/ServiceLocator/AuthenticationServletAdapter.hpp"
 #include "Beam/Services/ServiceProtocolServletContainer.hpp"
 #include "Beam/Threading/LiveTimer.hpp"
+#include "Beam/Threading/ThreadingConfig.hpp"
 #include "Beam/Utilities/ApplicationInterrupt.hpp"
 #include "Beam/Utilities/YamlConfig.hpp"
 #include "Version.hpp"
@@ -40,6 +41,11 @@ int main(int argc, const char** argv) {
   try {
     auto config = ParseCommandLine(argc, argv, "1.0-r" REGISTRY_SERVER_VERSION
       "\nCopyright (C) 2020 Spire Trading Inc.");
+    if(auto threadingConfig = config["threading"]) {
+      Configure(TryOrNest([&] {
+        return ThreadingConfig::Parse(threadingConfig);
+      }, std::runtime_error("Error parsing section 'threading'.")));
+    }
     auto serviceConfig = TryOrNest([&] {
       return ServiceConfiguration::Parse(GetNode(config, "server"),
         RegistryService::SERVICE_NAME);
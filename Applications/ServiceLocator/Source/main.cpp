@@ -13,6 +13,7 @@
 #include "Beam/Sql/MySqlConfig.hpp"
 #include "Beam/Sql/SqlConnection.hpp"
 #include "Beam/Threading/LiveTimer.hpp"
+#include "Beam/Threading/ThreadingConfig.hpp"
 #include "Beam/Utilities/ApplicationInterrupt.hpp"
 #include "Beam/Utilities/Expect.hpp"
 #include "Beam/Utilities/YamlConfig.hpp"
@@ -42,6 +43,11 @@ int main(int argc, const char** argv) {
   try {
     auto config = ParseCommandLine(argc, argv, "1.0-r" SERVICE_LOCATOR_VERSION
       "\nCopyright (C) 2020 Spire Trading Inc.");
+    if(auto threadingConfig = config["threading"]) {
+      Configure(TryOrNest([&] {
+        return ThreadingConfig::Parse(threadingConfig);
+      }, std::runtime_error("Error parsing section 'threading'.")));
+    }
     auto interface = Extract<IpAddress>(config, "interface");
     auto mySqlConfig = TryOrNest([&] {
       return MySqlConfig::Parse(GetNode(config, "data_store"));
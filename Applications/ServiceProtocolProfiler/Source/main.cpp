@@ -8,7 +8,12 @@
 #include "Beam/IO/LocalServerConnection.hpp"
 #include "Beam/IO/NotConnectedException.hpp"
 #include "Beam/IO/SharedBuffer.hpp"
+#ifdef __linux__
+  #include "Beam/IO/SharedMemoryServerConnection.hpp"
+#endif
 #include "Beam/Network/TcpServerSocket.hpp"
+#include "Beam/Network/TcpSocketChannel.hpp"
+#include "Beam/Routines/RoutineHandler.hpp"
 #include "Beam/Routines/RoutineHandlerGroup.hpp"
 #include "Beam/Serialization/BinaryReceiver.hpp"
 #include "Beam/Serialization/BinarySender.hpp"
@@ -98,6 +103,63 @@ namespace {
     }
     client.Close();
   }
+
+  template<typename C>
+  using BenchmarkServiceProtocolClient = ServiceProtocolClient<
+    MessageProtocol<std::unique_ptr<C>, BinarySender<SharedBuffer>,
+    ServiceEncoder>, TriggerTimer>;
+
+  template<typename S, typename F>
+  void RunBenchmark(const std::string& name, S& server, F connect,
+      int roundTrips) {
+    auto serverRoutine = RoutineHandler(Spawn([&] {
+      auto client = BenchmarkServiceProtocolClient<typename S::Channel>(
+        server.Accept(), Initialize());
+      RegisterServiceProtocolProfilerServices(Store(client.GetSlots()));
+      RegisterServiceProtocolProfilerMessages(Store(client.GetSlots()));
+      EchoService::AddSlot(Store(client.GetSlots()), [] (auto& client,
+          const auto& message) {
+        return message;
+      });
+      HandleMessagesLoop(client);
+    }));
+    auto client = BenchmarkServiceProtocolClient<
+      typename std::invoke_result_t<F>::element_type>(connect(),
+      Initialize());
+    RegisterServiceProtocolProfilerServices(Store(client.GetSlots()));
+    RegisterServiceProtocolProfilerMessages(Store(client.GetSlots()));
+    auto message = std::string("hello world");
+    auto start = microsec_clock::universal_time();
+    for(auto i = 0; i < roundTrips; ++i) {
+      client.template SendRequest<EchoService>(message);
+    }
+    auto elapsed = microsec_clock::universal_time() - start;
+    client.Close();
+    serverRoutine.Wait();
+    std::cout << boost::format("%1%: %2% round trips in %3%us, %4%/s\n") %
+      name % roundTrips % elapsed.total_microseconds() %
+      (roundTrips * 1000000.0 /
+        std::max<std::int64_t>(elapsed.total_microseconds(), 1)) <<
+      std::flush;
+  }
+
+  void RunBenchmarks(const IpAddress& interface, int roundTrips) {
+    {
+      auto server = TcpServerSocket(interface);
+      RunBenchmark("TCP loopback", server, [&] {
+        return std::make_unique<TcpSocketChannel>(interface);
+      }, roundTrips);
+    }
+#ifdef __linux__
+    {
+      auto server = SharedMemoryServerConnection("service_protocol_profiler");
+      RunBenchmark("Shared memory", server, [] {
+        return std::make_unique<SharedMemoryChannel>(
+          "service_protocol_profiler");
+      }, roundTrips);
+    }
+#endif
+  }
 }
 
 int main(int argc, const char** argv) {
@@ -107,6 +169,12 @@ int main(int argc, const char** argv) {
       "\nCopyright (C) 2020 Spire Trading Inc.");
     auto clientCount = Extract<int>(config, "clients",
       static_cast<int>(boost::thread::hardware_concurrency()));
+    auto benchmark = Extract<int>(config, "benchmark", 0);
+    if(benchmark > 0) {
+      RunBenchmarks(IpAddress("127.0.0.1", Extract<IpAddress>(config["server"],
+        "interface").GetPort()), benchmark);
+      return 0;
+    }
     auto server = ApplicationServerConnection();
     auto routines = RoutineHandlerGroup();
     routines.Spawn([&] {
@@ -9,6 +9,7 @@
 #include "Beam/Serialization/BinarySender.hpp"
 #include "Beam/Services/ServiceProtocolServletContainer.hpp"
 #include "Beam/Threading/LiveTimer.hpp"
+#include "Beam/Threading/ThreadingConfig.hpp"
 #include "Beam/Utilities/ApplicationInterrupt.hpp"
 #include "Beam/Utilities/Expect.hpp"
 #include "Beam/Utilities/YamlConfig.hpp"
@@ -38,6 +39,11 @@ int main(int argc, const char** argv) {
   try {
     auto config = ParseCommandLine(argc, argv, "1.0-r" SERVLET_TEMPLATE_VERSION
       "\nCopyright (C) 2020 Spire Trading Inc.");
+    if(auto threadingConfig = config["threading"]) {
+      Configure(TryOrNest([&] {
+        return ThreadingConfig::Parse(threadingConfig);
+      }, std::runtime_error("Error parsing section 'threading'.")));
+    }
     auto interface = Extract<IpAddress>(config, "interface");
     auto server = ServletTemplateServletContainer(Initialize(),
       Initialize(interface),
@@ -12,6 +12,7 @@
 #include "Beam/Sql/MySqlConfig.hpp"
 #include "Beam/Sql/SqlConnection.hpp"
 #include "Beam/Threading/LiveTimer.hpp"
+#include "Beam/Threading/ThreadingConfig.hpp"
 #include "Beam/UidService/SqlUidDataStore.hpp"
 #include "Beam/UidService/UidServlet.hpp"
 #include "Beam/Utilities/ApplicationInterrupt.hpp"
@@ -43,6 +44,11 @@ int main(int argc, const char** argv) {
   try {
     auto config = ParseCommandLine(argc, argv, "1.0-r" UID_SERVER_VERSION
       "\nCopyright (C) 2020 Spire Trading Inc.");
+    if(auto threadingConfig = config["threading"]) {
+      Configure(TryOrNest([&] {
+        return ThreadingConfig::Parse(threadingConfig);
+      }, std::runtime_error("Error parsing section 'threading'.")));
+    }
     auto mySqlConfig = TryOrNest([&] {
       return MySqlConfig::Parse(GetNode(config, "data_store"));
     }, std::runtime_error("Error parsing section 'data_store'."));
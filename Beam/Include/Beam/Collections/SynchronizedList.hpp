@@ -4,6 +4,7 @@
 #include <boost/thread/locks.hpp>
 #include <boost/thread/mutex.hpp>
 #include "Beam/Collections/Collections.hpp"
+#include "Beam/Threading/LockTraits.hpp"
 #include "Beam/Utilities/Algorithm.hpp"
 
 namespace Beam {
@@ -125,14 +126,14 @@ namespace Beam {
 
   template<typename T, typename M>
   SynchronizedList<T, M>::SynchronizedList(const SynchronizedList& list) {
-    auto lock = boost::lock_guard(list.m_mutex);
+    auto lock = Threading::GetReadLock<M>(list.m_mutex);
     m_list.insert(m_list.end(), list.m_list.begin(), list.m_list.end());
   }
 
   template<typename T, typename M>
   template<typename U, typename V>
   SynchronizedList<T, M>::SynchronizedList(const SynchronizedList<U, V>& list) {
-    auto lock = boost::lock_guard(list.m_mutex);
+    auto lock = Threading::GetReadLock<V>(list.m_mutex);
     m_list.insert(m_list.end(), list.m_list.begin(), list.m_list.end());
   }
 
@@ -145,7 +146,7 @@ namespace Beam {
   template<typename T, typename M>
   typename SynchronizedList<T, M>::List
       SynchronizedList<T, M>::Acquire() const {
-    auto lock = boost::lock_guard(m_mutex);
+    auto lock = Threading::GetReadLock<M>(m_mutex);
     return m_list;
   }
 
@@ -187,7 +188,7 @@ namespace Beam {
   template<typename T, typename M>
   template<typename F>
   void SynchronizedList<T, M>::ForEach(F&& f) const {
-    auto lock = boost::lock_guard(m_mutex);
+    auto lock = Threading::GetReadLock<M>(m_mutex);
     std::for_each(m_list.begin(), m_list.end(), std::forward<F>(f));
   }
 
@@ -216,7 +217,7 @@ namespace Beam {
   template<typename T, typename M>
   template<typename F>
   decltype(auto) SynchronizedList<T, M>::With(F&& f) const {
-    auto lock = boost::lock_guard(m_mutex);
+    auto lock = Threading::GetReadLock<M>(m_mutex);
     return f(m_list);
   }
 }
@@ -7,6 +7,7 @@
 #include <boost/thread/locks.hpp>
 #include <boost/thread/mutex.hpp>
 #include "Beam/Collections/Collections.hpp"
+#include "Beam/Threading/LockTraits.hpp"
 
 namespace Beam {
 
@@ -193,7 +194,7 @@ namespace Beam {
   template<typename T, typename M>
   boost::optional<typename SynchronizedMap<T, M>::Value>
       SynchronizedMap<T, M>::FindValue(const Key& key) const {
-    auto lock = boost::lock_guard(m_mutex);
+    auto lock = Threading::GetReadLock<M>(m_mutex);
     auto valueIterator = m_map.find(key);
     if(valueIterator == m_map.end()) {
       return boost::none;
@@ -204,7 +205,7 @@ namespace Beam {
   template<typename T, typename M>
   boost::optional<const typename SynchronizedMap<T, M>::Value&>
       SynchronizedMap<T, M>::Find(const Key& key) const {
-    auto lock = boost::lock_guard(m_mutex);
+    auto lock = Threading::GetReadLock<M>(m_mutex);
     auto valueIterator = m_map.find(key);
     if(valueIterator == m_map.end()) {
       return boost::none;
@@ -269,7 +270,7 @@ namespace Beam {
   template<typename T, typename M>
   template<typename F>
   decltype(auto) SynchronizedMap<T, M>::With(F&& f) const {
-    auto lock = boost::lock_guard(m_mutex);
+    auto lock = Threading::GetReadLock<M>(m_mutex);
     return f(m_map);
   }
 }
@@ -5,6 +5,7 @@
 #include <boost/thread/locks.hpp>
 #include <boost/thread/mutex.hpp>
 #include "Beam/Collections/Collections.hpp"
+#include "Beam/Threading/LockTraits.hpp"
 
 namespace Beam {
 
@@ -113,7 +114,7 @@ namespace Beam {
 
   template<typename T, typename M>
   bool SynchronizedSet<T, M>::Contains(const Value& value) const {
-    auto lock = boost::lock_guard(m_mutex);
+    auto lock = Threading::GetReadLock<M>(m_mutex);
     return m_set.find(value) != m_set.end();
   }
 
@@ -184,7 +185,7 @@ namespace Beam {
   template<typename T, typename M>
   template<typename F>
   decltype(auto) SynchronizedSet<T, M>::With(F&& f) const {
-    auto lock = boost::lock_guard(m_mutex);
+    auto lock = Threading::GetReadLock<M>(m_mutex);
     return f(m_set);
   }
 }
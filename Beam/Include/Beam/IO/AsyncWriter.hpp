@@ -1,6 +1,10 @@
 #ifndef BEAM_ASYNC_WRITER_HPP
 #define BEAM_ASYNC_WRITER_HPP
+#include <memory>
 #include <type_traits>
+#include <vector>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/thread/mutex.hpp>
 #include <boost/throw_exception.hpp>
 #include "Beam/IO/SharedBuffer.hpp"
 #include "Beam/IO/Writer.hpp"
@@ -8,12 +12,18 @@
 #include "Beam/Pointers/LocalPtr.hpp"
 #include "Beam/Queues/PipeBrokenException.hpp"
 #include "Beam/Queues/RoutineTaskQueue.hpp"
+#include "Beam/Threading/LiveTimer.hpp"
+
+#ifndef BEAM_ASYNC_WRITER_COALESCE_SIZE
+  #define BEAM_ASYNC_WRITER_COALESCE_SIZE 65536
+#endif
 
 namespace Beam {
 namespace IO {
 
   /**
-   * Asynchronously writes to a destination using a Routine.
+   * Asynchronously writes to a destination using a Routine, all Buffers
+   * pending when the Routine runs are combined into a single write.
    * @param <W> The Writer to write to.
    */
   template<typename W>
@@ -31,6 +41,29 @@ namespace IO {
       template<typename WF>
       AsyncWriter(WF&& destination);
 
+      /**
+       * Constructs an AsyncWriter whose pending writes are stored in a
+       * specified Queue, for example an MpscQueue.
+       * @param destination Used to initialize the destination of all writes.
+       * @param tasks The Queue to store the pending writes in.
+       */
+      template<typename WF>
+      AsyncWriter(WF&& destination,
+        std::unique_ptr<AbstractQueue<std::function<void ()>>> tasks);
+
+      /**
+       * Constructs an AsyncWriter.
+       * @param destination Used to initialize the destination of all writes.
+       * @param coalesceSize The maximum number of bytes combined into a single
+       *        write, a single larger Buffer is still written on its own.
+       * @param corkWindow How long to wait for further Buffers before writing
+       *        less than <i>coalesceSize</i> bytes, a zero duration writes
+       *        as soon as the Routine runs.
+       */
+      template<typename WF>
+      AsyncWriter(WF&& destination, std::size_t coalesceSize,
+        boost::posix_time::time_duration corkWindow);
+
       void Write(const void* data, std::size_t size);
 
       template<typename B>
@@ -38,17 +71,55 @@ namespace IO {
 
     private:
       GetOptionalLocalPtr<W> m_destination;
+      std::size_t m_coalesceSize;
+      boost::posix_time::time_duration m_corkWindow;
       std::exception_ptr m_exception;
+      boost::mutex m_mutex;
+      std::vector<SharedBuffer> m_pending;
+      std::size_t m_pendingSize;
+      bool m_isFlushPending;
       RoutineTaskQueue m_tasks;
+
+      void Enqueue(SharedBuffer buffer);
+      void Flush();
   };
 
   template<typename W>
   AsyncWriter(W&&) -> AsyncWriter<std::decay_t<W>>;
 
+  template<typename W, typename Q>
+  AsyncWriter(W&&, Q&&) -> AsyncWriter<std::decay_t<W>>;
+
+  template<typename W>
+  AsyncWriter(W&&, std::size_t, boost::posix_time::time_duration) ->
+    AsyncWriter<std::decay_t<W>>;
+
   template<typename W>
   template<typename WF>
   AsyncWriter<W>::AsyncWriter(WF&& destination)
-    : m_destination(std::forward<WF>(destination)) {}
+    : AsyncWriter(std::forward<WF>(destination),
+        BEAM_ASYNC_WRITER_COALESCE_SIZE, boost::posix_time::seconds(0)) {}
+
+  template<typename W>
+  template<typename WF>
+  AsyncWriter<W>::AsyncWriter(WF&& destination,
+      std::unique_ptr<AbstractQueue<std::function<void ()>>> tasks)
+      : m_destination(std::forward<WF>(destination)),
+        m_coalesceSize(BEAM_ASYNC_WRITER_COALESCE_SIZE),
+        m_corkWindow(boost::posix_time::seconds(0)),
+        m_pendingSize(0),
+        m_isFlushPending(false),
+        m_tasks(std::move(tasks)) {}
+
+  template<typename W>
+  template<typename WF>
+  AsyncWriter<W>::AsyncWriter(WF&& destination, std::size_t coalesceSize,
+      boost::posix_time::time_duration corkWindow)
+      : m_destination(std::forward<WF>(destination)),
+        m_coalesceSize(coalesceSize),
+        m_corkWindow(corkWindow),
+        m_pendingSize(0),
+        m_isFlushPending(false) {}
 
   template<typename W>
   void AsyncWriter<W>::Write(const void* data, std::size_t size) {
@@ -58,22 +129,103 @@ namespace IO {
   template<typename W>
   template<typename B>
   void AsyncWriter<W>::Write(const B& data) {
+    if constexpr(std::is_same_v<B, SharedBuffer>) {
+      Enqueue(data);
+    } else {
+      Enqueue(SharedBuffer(data.GetData(), data.GetSize()));
+    }
+  }
+
+  template<typename W>
+  void AsyncWriter<W>::Enqueue(SharedBuffer buffer) {
+    {
+      auto lock = boost::lock_guard(m_mutex);
+      if(m_exception) {
+        std::rethrow_exception(m_exception);
+      }
+      m_pendingSize += buffer.GetSize();
+      m_pending.push_back(std::move(buffer));
+      if(m_isFlushPending) {
+        return;
+      }
+      m_isFlushPending = true;
+    }
     try {
       m_tasks.Push([=] {
         try {
-          m_destination->Write(data);
+          Flush();
         } catch(const std::exception&) {
-          if(!m_exception) {
+
+          /* The flush stays pending so that no further flush is scheduled,
+             and the Buffers that will never be written are released. */
+          {
+            auto lock = boost::lock_guard(m_mutex);
             m_exception = std::current_exception();
-            m_tasks.Break();
-            BOOST_THROW_EXCEPTION(PipeBrokenException());
+            m_pending.clear();
+            m_pendingSize = 0;
           }
+          m_tasks.Break();
+          BOOST_THROW_EXCEPTION(PipeBrokenException());
         }
       });
     } catch(const PipeBrokenException&) {
+      auto lock = boost::lock_guard(m_mutex);
       std::rethrow_exception(m_exception);
     }
   }
+
+  template<typename W>
+  void AsyncWriter<W>::Flush() {
+    if(m_corkWindow != boost::posix_time::seconds(0)) {
+      auto isCorked = [&] {
+        auto lock = boost::lock_guard(m_mutex);
+        return m_pendingSize < m_coalesceSize;
+      }();
+      if(isCorked) {
+        auto timer = Threading::LiveTimer(m_corkWindow);
+        timer.Start();
+        timer.Wait();
+      }
+    }
+    auto buffers = std::vector<SharedBuffer>();
+    while(true) {
+      auto size = std::size_t(0);
+      {
+        auto lock = boost::lock_guard(m_mutex);
+        if(m_pending.empty()) {
+          m_isFlushPending = false;
+          return;
+        }
+        auto count = std::size_t(0);
+        while(count != m_pending.size() && (count == 0 ||
+            size + m_pending[count].GetSize() <= m_coalesceSize)) {
+          size += m_pending[count].GetSize();
+          ++count;
+        }
+        if(count == m_pending.size()) {
+          buffers.swap(m_pending);
+          m_pending.clear();
+        } else {
+          buffers.assign(std::make_move_iterator(m_pending.begin()),
+            std::make_move_iterator(m_pending.begin() + count));
+          m_pending.erase(m_pending.begin(), m_pending.begin() + count);
+        }
+        m_pendingSize -= size;
+      }
+      if(buffers.size() == 1) {
+        m_destination->Write(buffers.front());
+      } else {
+        auto buffer = SharedBuffer();
+        buffer.Reserve(size);
+        auto index = std::size_t(0);
+        for(auto& pending : buffers) {
+          buffer.Write(index, pending.GetData(), pending.GetSize());
+          index += pending.GetSize();
+        }
+        m_destination->Write(buffer);
+      }
+    }
+  }
 }
 
   template<typename BufferType, typename W>
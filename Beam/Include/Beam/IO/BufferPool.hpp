@@ -0,0 +1,235 @@
+#ifndef BEAM_BUFFER_POOL_HPP
+#define BEAM_BUFFER_POOL_HPP
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <boost/throw_exception.hpp>
+#include "Beam/IO/IO.hpp"
+#ifdef _MSC_VER
+  #include <intrin.h>
+#endif
+
+#ifndef BEAM_SHARED_BUFFER_POOLING
+  #define BEAM_SHARED_BUFFER_POOLING 1
+#endif
+
+#ifndef BEAM_BUFFER_POOL_MAX_SIZE_CLASS
+  #define BEAM_BUFFER_POOL_MAX_SIZE_CLASS 14
+#endif
+
+#ifndef BEAM_BUFFER_POOL_CACHE_SIZE
+  #define BEAM_BUFFER_POOL_CACHE_SIZE 64
+#endif
+
+namespace Beam::IO {
+
+  /** Stores a snapshot of the calling thread's buffer pool. */
+  struct BufferPoolStatistics {
+
+    /** The number of blocks requested. */
+    std::uint64_t m_allocationCount;
+
+    /** The number of requested blocks taken from the pool. */
+    std::uint64_t m_reuseCount;
+
+    /** The number of blocks released. */
+    std::uint64_t m_releaseCount;
+
+    /** The number of blocks currently held by the pool. */
+    std::size_t m_cachedCount;
+  };
+
+  /** Returns the statistics of the calling thread's buffer pool. */
+  BufferPoolStatistics GetBufferPoolStatistics();
+
+namespace Details {
+  inline std::size_t FindNextPowerOfTwo(std::size_t current) {
+    if(current <= 1) {
+      return 1;
+    }
+    if(current > (std::numeric_limits<std::size_t>::max() >> 1) + 1) {
+      BOOST_THROW_EXCEPTION(std::bad_alloc());
+    }
+#ifdef _MSC_VER
+    auto index = 0UL;
+    _BitScanReverse64(&index, static_cast<unsigned __int64>(current - 1));
+    return std::size_t(2) << index;
+#else
+    return std::size_t(2) << (8 * sizeof(unsigned long long) - 1 -
+      __builtin_clzll(static_cast<unsigned long long>(current - 1)));
+#endif
+  }
+
+  inline std::size_t GetSizeClass(std::size_t powerOfTwo) {
+#ifdef _MSC_VER
+    auto index = 0UL;
+    _BitScanForward64(&index, static_cast<unsigned __int64>(powerOfTwo));
+    return index;
+#else
+    return __builtin_ctzll(static_cast<unsigned long long>(powerOfTwo));
+#endif
+  }
+
+  /**
+   * The header placed in front of a SharedBuffer's data, storing the
+   * reference count in the same allocation as the data.
+   */
+  struct alignas(std::max_align_t) BufferBlock {
+    std::atomic_size_t m_referenceCount;
+    std::size_t m_sizeClass;
+    BufferBlock* m_next;
+
+    char* GetData();
+  };
+
+  /** Caches released BufferBlocks by size class, one per thread. */
+  class BufferPool {
+    public:
+      static BufferPool& GetInstance();
+
+      ~BufferPool();
+
+      BufferBlock* Allocate(std::size_t capacity);
+
+      void Release(BufferBlock* block);
+
+      BufferPoolStatistics GetStatistics() const;
+
+    private:
+      static constexpr auto SIZE_CLASS_COUNT =
+        std::size_t(BEAM_BUFFER_POOL_MAX_SIZE_CLASS + 1);
+      std::array<BufferBlock*, SIZE_CLASS_COUNT> m_blocks;
+      std::array<std::size_t, SIZE_CLASS_COUNT> m_counts;
+      BufferPoolStatistics m_statistics;
+
+      static bool& IsDestroyed();
+      static BufferBlock* New(std::size_t sizeClass);
+      BufferPool();
+      BufferPool(const BufferPool&) = delete;
+      BufferPool& operator =(const BufferPool&) = delete;
+  };
+
+  /**
+   * Allocates a BufferBlock holding one reference.
+   * @param capacity The capacity of the block, a power of two.
+   */
+  inline BufferBlock* AllocateBufferBlock(std::size_t capacity) {
+    return BufferPool::GetInstance().Allocate(capacity);
+  }
+
+  /** Adds a reference to a BufferBlock. */
+  inline void AddReference(BufferBlock* block) {
+    if(block) {
+      block->m_referenceCount.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  /** Removes a reference to a BufferBlock, releasing it at zero. */
+  inline void RemoveReference(BufferBlock* block) {
+    if(block &&
+        block->m_referenceCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      BufferPool::GetInstance().Release(block);
+    }
+  }
+
+  /** Returns <code>true</code> iff a BufferBlock has a single reference. */
+  inline bool IsUnique(const BufferBlock* block) {
+    return block &&
+      block->m_referenceCount.load(std::memory_order_acquire) == 1;
+  }
+
+  inline char* BufferBlock::GetData() {
+    return reinterpret_cast<char*>(this + 1);
+  }
+
+  inline BufferPool& BufferPool::GetInstance() {
+    thread_local auto instance = BufferPool();
+    return instance;
+  }
+
+  inline BufferPool::~BufferPool() {
+    IsDestroyed() = true;
+    for(auto block : m_blocks) {
+      while(block) {
+        auto next = block->m_next;
+        block->~BufferBlock();
+        ::operator delete(block);
+        block = next;
+      }
+    }
+  }
+
+  inline BufferBlock* BufferPool::Allocate(std::size_t capacity) {
+    auto sizeClass = GetSizeClass(capacity);
+    if(IsDestroyed()) {
+      return New(sizeClass);
+    }
+    ++m_statistics.m_allocationCount;
+    if(BEAM_SHARED_BUFFER_POOLING && sizeClass < SIZE_CLASS_COUNT) {
+      if(auto block = m_blocks[sizeClass]) {
+        m_blocks[sizeClass] = block->m_next;
+        --m_counts[sizeClass];
+        --m_statistics.m_cachedCount;
+        ++m_statistics.m_reuseCount;
+        block->m_referenceCount.store(1, std::memory_order_relaxed);
+        return block;
+      }
+    }
+    return New(sizeClass);
+  }
+
+  inline void BufferPool::Release(BufferBlock* block) {
+    auto sizeClass = block->m_sizeClass;
+    if(!IsDestroyed()) {
+      ++m_statistics.m_releaseCount;
+      if(BEAM_SHARED_BUFFER_POOLING && sizeClass < SIZE_CLASS_COUNT &&
+          m_counts[sizeClass] < BEAM_BUFFER_POOL_CACHE_SIZE) {
+        block->m_next = m_blocks[sizeClass];
+        m_blocks[sizeClass] = block;
+        ++m_counts[sizeClass];
+        ++m_statistics.m_cachedCount;
+        return;
+      }
+    }
+    block->~BufferBlock();
+    ::operator delete(block);
+  }
+
+  inline BufferPoolStatistics BufferPool::GetStatistics() const {
+    return m_statistics;
+  }
+
+  inline bool& BufferPool::IsDestroyed() {
+
+    /* Trivially destructible so that buffers released by thread_local or
+       static objects destroyed after the pool can still be freed. */
+    thread_local auto isDestroyed = false;
+    return isDestroyed;
+  }
+
+  inline BufferBlock* BufferPool::New(std::size_t sizeClass) {
+    auto block = static_cast<BufferBlock*>(::operator new(
+      sizeof(BufferBlock) + (std::size_t(1) << sizeClass)));
+    new(block) BufferBlock();
+    block->m_referenceCount.store(1, std::memory_order_relaxed);
+    block->m_sizeClass = sizeClass;
+    block->m_next = nullptr;
+    return block;
+  }
+
+  inline BufferPool::BufferPool()
+      : m_statistics() {
+    m_blocks.fill(nullptr);
+    m_counts.fill(0);
+  }
+}
+
+  inline BufferPoolStatistics GetBufferPoolStatistics() {
+    return Details::BufferPool::GetInstance().GetStatistics();
+  }
+}
+
+#endif
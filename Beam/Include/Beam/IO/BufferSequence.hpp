@@ -0,0 +1,100 @@
+#ifndef BEAM_BUFFER_SEQUENCE_HPP
+#define BEAM_BUFFER_SEQUENCE_HPP
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include "Beam/IO/IO.hpp"
+
+namespace Beam::IO {
+
+  /**
+   * Stores an ordered sequence of Buffers to be written as one contiguous
+   * write without first copying them into a single Buffer.
+   * @param <B> The types of Buffers in the sequence, a reference type refers
+   *        to a Buffer that must outlive the write.
+   */
+  template<typename... B>
+  class BufferSequence {
+    public:
+
+      /**
+       * Constructs a BufferSequence.
+       * @param buffers The Buffers to write, in order.
+       */
+      explicit BufferSequence(B... buffers);
+
+      /** Returns the total size of all Buffers. */
+      std::size_t GetSize() const;
+
+      /** Returns the Buffers in the sequence. */
+      const std::tuple<B...>& GetBuffers() const;
+
+      /**
+       * Invokes a function on each Buffer, in order.
+       * @param f The function to invoke.
+       */
+      template<typename F>
+      void ForEach(F&& f) const;
+
+    private:
+      std::tuple<B...> m_buffers;
+  };
+
+  /**
+   * Specifies whether a Writer writes a BufferSequence as a single gathered
+   * write, Writers that do not are written to through a single copy.
+   * @param <W> The type of Writer.
+   */
+  template<typename W>
+  struct IsGatherWriter : std::false_type {};
+
+  /**
+   * Writes a BufferSequence to a Writer, using a gathered write if the Writer
+   * supports one and otherwise copying the Buffers into the Writer's Buffer.
+   * @param writer The Writer to write to.
+   * @param buffers The Buffers to write.
+   */
+  template<typename W, typename... B>
+  void WriteSequence(W& writer, const BufferSequence<B...>& buffers) {
+    if constexpr(IsGatherWriter<std::decay_t<W>>::value) {
+      writer.Write(buffers);
+    } else {
+      auto buffer = typename std::decay_t<W>::Buffer();
+      buffer.Reserve(buffers.GetSize());
+      auto index = std::size_t(0);
+      buffers.ForEach([&] (const auto& segment) {
+        buffer.Write(index, segment.GetData(), segment.GetSize());
+        index += segment.GetSize();
+      });
+      writer.Write(buffer);
+    }
+  }
+
+  template<typename... B>
+  BufferSequence<B...>::BufferSequence(B... buffers)
+    : m_buffers(std::forward<B>(buffers)...) {}
+
+  template<typename... B>
+  std::size_t BufferSequence<B...>::GetSize() const {
+    auto size = std::size_t(0);
+    ForEach([&] (const auto& buffer) {
+      size += buffer.GetSize();
+    });
+    return size;
+  }
+
+  template<typename... B>
+  const std::tuple<B...>& BufferSequence<B...>::GetBuffers() const {
+    return m_buffers;
+  }
+
+  template<typename... B>
+  template<typename F>
+  void BufferSequence<B...>::ForEach(F&& f) const {
+    std::apply([&] (const auto&... buffers) {
+      (f(buffers), ...);
+    }, m_buffers);
+  }
+}
+
+#endif
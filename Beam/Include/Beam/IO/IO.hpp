@@ -10,7 +10,9 @@ namespace Beam::IO {
   struct Buffer;
   class BufferBox;
   template<typename B> class BaseBufferOutputStream;
+  struct BufferPoolStatistics;
   template<typename B> class BufferSlice;
+  template<typename... B> class BufferSequence;
   class BufferView;
   template<typename I, typename C, typename R, typename W> struct Channel;
   class ChannelBox;
@@ -21,6 +23,7 @@ namespace Beam::IO {
   struct Connection;
   class ConnectionBox;
   class EndOfFileException;
+  template<std::size_t N> class InlineBuffer;
   class IOException;
   template<typename B> class LocalClientChannel;
   template<typename B> class LocalConnection;
@@ -42,6 +45,11 @@ namespace Beam::IO {
   template<typename C> struct ServerConnection;
   class ServerConnectionBox;
   class SharedBuffer;
+  class SharedMemoryChannel;
+  class SharedMemoryConnection;
+  class SharedMemoryReader;
+  class SharedMemoryServerConnection;
+  class SharedMemoryWriter;
   template<typename R> class SizeDeclarativeReader;
   template<typename W> class SizeDeclarativeWriter;
   template<std::size_t N> class StaticBuffer;
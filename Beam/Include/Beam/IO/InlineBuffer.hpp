@@ -0,0 +1,307 @@
+#ifndef BEAM_INLINE_BUFFER_HPP
+#define BEAM_INLINE_BUFFER_HPP
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include "Beam/IO/Buffer.hpp"
+#include "Beam/IO/BufferPool.hpp"
+#include "Beam/IO/BufferView.hpp"
+#include "Beam/IO/IO.hpp"
+
+namespace Beam {
+namespace IO {
+
+  /**
+   * Implements the Buffer Concept by storing small amounts of data inline and
+   * only allocating once the data grows past a fixed size.
+   * @param <N> The number of bytes stored inline.
+   */
+  template<std::size_t N>
+  class InlineBuffer {
+    public:
+
+      /** The number of bytes stored inline. */
+      static constexpr auto INLINE_SIZE = N;
+
+      /** Constructs an empty InlineBuffer. */
+      InlineBuffer();
+
+      /**
+       * Constructs an InlineBuffer with an initial size.
+       * @param initialSize The initial size of the buffer.
+       */
+      explicit InlineBuffer(std::size_t initialSize);
+
+      /**
+       * Constructs an InlineBuffer from raw data.
+       * @param data The data to copy.
+       * @param size The size of the data to copy.
+       */
+      InlineBuffer(const void* data, std::size_t size);
+
+      InlineBuffer(const InlineBuffer& buffer);
+
+      InlineBuffer(InlineBuffer&& buffer);
+
+      /**
+       * Copies a Buffer.
+       * @param buffer The Buffer to copy.
+       */
+      template<typename B, typename = std::enable_if_t<IsBufferView<B>>>
+      InlineBuffer(const B& buffer);
+
+      /** Returns <code>true</code> iff the data is stored inline. */
+      bool IsInline() const;
+
+      bool IsEmpty() const;
+
+      void Grow(std::size_t size);
+
+      void Shrink(std::size_t size);
+
+      void ShrinkFront(std::size_t size);
+
+      void Reserve(std::size_t size);
+
+      void Write(std::size_t index, const void* source, std::size_t size);
+
+      template<typename T>
+      void Write(std::size_t index, T value);
+
+      template<typename B>
+      std::enable_if_t<IsBufferView<B>> Append(const B& buffer);
+
+      void Append(const void* data, std::size_t size);
+
+      template<typename T>
+      std::enable_if_t<!IsBufferView<T>> Append(T value);
+
+      void Reset();
+
+      const char* GetData() const;
+
+      char* GetMutableData();
+
+      std::size_t GetSize() const;
+
+      template<typename T>
+      void Extract(std::size_t index, Out<T> value) const;
+
+      template<typename T>
+      T Extract(std::size_t index) const;
+
+      InlineBuffer& operator =(const InlineBuffer& rhs);
+
+      InlineBuffer& operator =(InlineBuffer&& rhs);
+
+      template<typename B>
+      std::enable_if_t<IsBufferView<B>, InlineBuffer&> operator =(
+        const B& rhs);
+
+    private:
+      std::size_t m_size;
+      std::size_t m_capacity;
+      char* m_front;
+      std::unique_ptr<char[]> m_heap;
+      std::array<char, N> m_data;
+
+      void Reallocate(std::size_t size);
+  };
+
+  template<std::size_t N>
+  InlineBuffer<N>::InlineBuffer()
+    : m_size(0),
+      m_capacity(N),
+      m_front(m_data.data()) {}
+
+  template<std::size_t N>
+  InlineBuffer<N>::InlineBuffer(std::size_t initialSize)
+      : InlineBuffer() {
+    Grow(initialSize);
+  }
+
+  template<std::size_t N>
+  InlineBuffer<N>::InlineBuffer(const void* data, std::size_t size)
+      : InlineBuffer() {
+    Append(data, size);
+  }
+
+  template<std::size_t N>
+  InlineBuffer<N>::InlineBuffer(const InlineBuffer& buffer)
+      : InlineBuffer() {
+    Append(buffer.GetData(), buffer.GetSize());
+  }
+
+  template<std::size_t N>
+  InlineBuffer<N>::InlineBuffer(InlineBuffer&& buffer)
+      : InlineBuffer() {
+    *this = std::move(buffer);
+  }
+
+  template<std::size_t N>
+  template<typename B, typename>
+  InlineBuffer<N>::InlineBuffer(const B& buffer)
+      : InlineBuffer() {
+    Append(buffer.GetData(), buffer.GetSize());
+  }
+
+  template<std::size_t N>
+  bool InlineBuffer<N>::IsInline() const {
+    return !m_heap;
+  }
+
+  template<std::size_t N>
+  bool InlineBuffer<N>::IsEmpty() const {
+    return m_size == 0;
+  }
+
+  template<std::size_t N>
+  void InlineBuffer<N>::Grow(std::size_t size) {
+    if(m_size + size > m_capacity) {
+      Reallocate(m_size + size);
+    }
+    m_size += size;
+  }
+
+  template<std::size_t N>
+  void InlineBuffer<N>::Shrink(std::size_t size) {
+    m_size -= std::min(size, m_size);
+  }
+
+  template<std::size_t N>
+  void InlineBuffer<N>::ShrinkFront(std::size_t size) {
+    assert(size <= m_size);
+    std::memmove(m_front, m_front + size, m_size - size);
+    m_size -= size;
+  }
+
+  template<std::size_t N>
+  void InlineBuffer<N>::Reserve(std::size_t size) {
+    Grow(size - m_size);
+  }
+
+  template<std::size_t N>
+  void InlineBuffer<N>::Write(std::size_t index, const void* source,
+      std::size_t size) {
+    assert(index <= m_size);
+    if(index + size > m_capacity) {
+      Reallocate(index + size);
+    }
+    std::memcpy(m_front + index, source, size);
+    m_size = std::max(index + size, m_size);
+  }
+
+  template<std::size_t N>
+  template<typename T>
+  void InlineBuffer<N>::Write(std::size_t index, T value) {
+    Write(index, &value, sizeof(T));
+  }
+
+  template<std::size_t N>
+  template<typename B>
+  std::enable_if_t<IsBufferView<B>> InlineBuffer<N>::Append(const B& buffer) {
+    Append(buffer.GetData(), buffer.GetSize());
+  }
+
+  template<std::size_t N>
+  void InlineBuffer<N>::Append(const void* data, std::size_t size) {
+    Write(m_size, data, size);
+  }
+
+  template<std::size_t N>
+  template<typename T>
+  std::enable_if_t<!IsBufferView<T>> InlineBuffer<N>::Append(T value) {
+    Append(&value, sizeof(T));
+  }
+
+  template<std::size_t N>
+  void InlineBuffer<N>::Reset() {
+    m_size = 0;
+  }
+
+  template<std::size_t N>
+  const char* InlineBuffer<N>::GetData() const {
+    return m_front;
+  }
+
+  template<std::size_t N>
+  char* InlineBuffer<N>::GetMutableData() {
+    return m_front;
+  }
+
+  template<std::size_t N>
+  std::size_t InlineBuffer<N>::GetSize() const {
+    return m_size;
+  }
+
+  template<std::size_t N>
+  template<typename T>
+  void InlineBuffer<N>::Extract(std::size_t index, Out<T> value) const {
+    std::memcpy(reinterpret_cast<char*>(&*value), m_front + index, sizeof(T));
+  }
+
+  template<std::size_t N>
+  template<typename T>
+  T InlineBuffer<N>::Extract(std::size_t index) const {
+    auto value = T();
+    std::memcpy(reinterpret_cast<char*>(&value), m_front + index, sizeof(T));
+    return value;
+  }
+
+  template<std::size_t N>
+  InlineBuffer<N>& InlineBuffer<N>::operator =(const InlineBuffer& rhs) {
+    if(this != &rhs) {
+      Reset();
+      Append(rhs.GetData(), rhs.GetSize());
+    }
+    return *this;
+  }
+
+  template<std::size_t N>
+  InlineBuffer<N>& InlineBuffer<N>::operator =(InlineBuffer&& rhs) {
+    if(this == &rhs) {
+      return *this;
+    }
+    if(rhs.m_heap) {
+      m_heap = std::move(rhs.m_heap);
+      m_front = m_heap.get();
+      m_capacity = rhs.m_capacity;
+      m_size = rhs.m_size;
+      rhs.m_front = rhs.m_data.data();
+      rhs.m_capacity = N;
+    } else {
+      Reset();
+      Append(rhs.GetData(), rhs.GetSize());
+    }
+    rhs.m_size = 0;
+    return *this;
+  }
+
+  template<std::size_t N>
+  template<typename B>
+  std::enable_if_t<IsBufferView<B>, InlineBuffer<N>&>
+      InlineBuffer<N>::operator =(const B& rhs) {
+    Reset();
+    Append(rhs.GetData(), rhs.GetSize());
+    return *this;
+  }
+
+  template<std::size_t N>
+  void InlineBuffer<N>::Reallocate(std::size_t size) {
+    auto capacity = Details::FindNextPowerOfTwo(size);
+    auto heap = std::unique_ptr<char[]>(new char[capacity]);
+    std::memcpy(heap.get(), m_front, m_size);
+    m_heap = std::move(heap);
+    m_front = m_heap.get();
+    m_capacity = capacity;
+  }
+}
+
+  template<std::size_t N>
+  struct ImplementsConcept<IO::InlineBuffer<N>, IO::Buffer> : std::true_type {};
+}
+
+#endif
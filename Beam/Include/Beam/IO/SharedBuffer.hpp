@@ -1,30 +1,20 @@
 #ifndef BEAM_SHARED_BUFFER_HPP
 #define BEAM_SHARED_BUFFER_HPP
+#include <cassert>
 #include <cstring>
 #include <new>
-#include <boost/shared_array.hpp>
 #include <boost/throw_exception.hpp>
+#include "Beam/IO/BufferPool.hpp"
 #include "Beam/IO/BufferView.hpp"
 #include "Beam/Utilities/BeamWorkaround.hpp"
 
 namespace Beam {
 namespace IO {
-namespace Details {
-  inline std::size_t FindNextPowerOfTwo(std::size_t current) {
-    auto nextPowerOfTwo = std::size_t(1);
-    auto lastPowerOfTwo = nextPowerOfTwo;
-    while(nextPowerOfTwo < current) {
-      nextPowerOfTwo *= 2;
-      if(nextPowerOfTwo < lastPowerOfTwo) {
-        BOOST_THROW_EXCEPTION(std::bad_alloc());
-      }
-      lastPowerOfTwo = nextPowerOfTwo;
-    }
-    return nextPowerOfTwo;
-  }
-}
 
-  /** Implements the Buffer Concept using copy-on-write data. */
+  /**
+   * Implements the Buffer Concept using copy-on-write data, allocated from
+   * the calling thread's buffer pool.
+   */
   class SharedBuffer {
     public:
 
@@ -46,6 +36,8 @@ namespace Details {
 
       SharedBuffer(SharedBuffer&& buffer);
 
+      ~SharedBuffer();
+
       bool IsEmpty() const;
 
       void Grow(std::size_t size);
@@ -95,7 +87,7 @@ namespace Details {
     private:
       std::size_t m_size;
       std::size_t m_availableSize;
-      boost::shared_array<char> m_data;
+      Details::BufferBlock* m_block;
       char* m_front;
 
       void Reallocate();
@@ -104,40 +96,54 @@ namespace Details {
   inline SharedBuffer::SharedBuffer()
     : m_size(0),
       m_availableSize(0),
+      m_block(nullptr),
       m_front(nullptr) {}
 
   inline SharedBuffer::SharedBuffer(std::size_t initialSize)
     : m_size(initialSize),
       m_availableSize(Details::FindNextPowerOfTwo(initialSize)),
-      m_data(new char[m_availableSize]),
-      m_front(m_data.get()) {}
+      m_block(Details::AllocateBufferBlock(m_availableSize)),
+      m_front(m_block->GetData()) {}
 
   inline SharedBuffer::SharedBuffer(const void* data, std::size_t size)
       : m_size(0),
         m_availableSize(0),
+        m_block(nullptr),
         m_front(nullptr) {
     Append(data, size);
   }
 
   inline SharedBuffer::SharedBuffer(const SharedBuffer& buffer)
-    : m_size(buffer.m_size),
-      m_availableSize(buffer.m_availableSize),
-      m_data(buffer.m_data),
-      m_front(buffer.m_front) {}
+      : m_size(buffer.m_size),
+        m_availableSize(buffer.m_availableSize),
+        m_block(buffer.m_block),
+        m_front(buffer.m_front) {
+    Details::AddReference(m_block);
+  }
 
   template<typename B, typename>
   SharedBuffer::SharedBuffer(const B& buffer)
       : m_size(0),
         m_availableSize(0),
+        m_block(nullptr),
         m_front(nullptr) {
     Append(buffer);
   }
 
   inline SharedBuffer::SharedBuffer(SharedBuffer&& buffer)
-    : m_size(std::move(buffer.m_size)),
-      m_availableSize(std::move(buffer.m_availableSize)),
-      m_data(std::move(buffer.m_data)),
-      m_front(std::move(buffer.m_front)) {}
+      : m_size(buffer.m_size),
+        m_availableSize(buffer.m_availableSize),
+        m_block(buffer.m_block),
+        m_front(buffer.m_front) {
+    buffer.m_size = 0;
+    buffer.m_availableSize = 0;
+    buffer.m_block = nullptr;
+    buffer.m_front = nullptr;
+  }
+
+  inline SharedBuffer::~SharedBuffer() {
+    Details::RemoveReference(m_block);
+  }
 
   inline bool SharedBuffer::IsEmpty() const {
     return m_size == 0;
@@ -154,19 +160,19 @@ namespace Details {
   inline void SharedBuffer::Shrink(std::size_t size) {
     if(size >= m_size) {
       m_size = 0;
-      m_front = m_data.get();
       return;
     }
     m_size -= size;
   }
 
   inline void SharedBuffer::ShrinkFront(std::size_t size) {
-    assert(size >= 0);
-    auto data = boost::shared_array<char>{new char[m_availableSize]};
-    std::memcpy(data.get(), m_data.get() + size, m_size - size);
-    data.swap(m_data);
+    assert(size <= m_size);
+    auto block = Details::AllocateBufferBlock(m_availableSize);
+    std::memcpy(block->GetData(), m_front + size, m_size - size);
+    Details::RemoveReference(m_block);
+    m_block = block;
     m_size -= size;
-    m_front = m_data.get();
+    m_front = m_block->GetData();
   }
 
   inline void SharedBuffer::Reserve(std::size_t size) {
@@ -179,7 +185,7 @@ namespace Details {
     if(m_availableSize < index + size) {
       m_availableSize = Details::FindNextPowerOfTwo(index + size);
       Reallocate();
-    } else if(!m_data.unique()) {
+    } else if(!Details::IsUnique(m_block)) {
       Reallocate();
     }
     std::memcpy(m_front + index, source, size);
@@ -209,7 +215,7 @@ namespace Details {
     if(m_availableSize < m_size + size) {
       m_availableSize = Details::FindNextPowerOfTwo(m_size + size);
       Reallocate();
-    } else if(!m_data.unique()) {
+    } else if(!Details::IsUnique(m_block)) {
       Reallocate();
     }
     std::memcpy(m_front + m_size, data, size);
@@ -223,7 +229,6 @@ namespace Details {
 
   inline void SharedBuffer::Reset() {
     m_size = 0;
-    m_front = m_data.get();
   }
 
   inline const char* SharedBuffer::GetData() const {
@@ -231,7 +236,7 @@ namespace Details {
   }
 
   inline char* SharedBuffer::GetMutableData() {
-    if(!m_data.unique()) {
+    if(m_block && !Details::IsUnique(m_block)) {
       Reallocate();
     }
     return m_front;
@@ -254,9 +259,11 @@ namespace Details {
   }
 
   inline SharedBuffer& SharedBuffer::operator =(const SharedBuffer& rhs) {
+    Details::AddReference(rhs.m_block);
+    Details::RemoveReference(m_block);
     m_size = rhs.m_size;
     m_availableSize = rhs.m_availableSize;
-    m_data = rhs.m_data;
+    m_block = rhs.m_block;
     m_front = rhs.m_front;
     return *this;
   }
@@ -269,18 +276,32 @@ namespace Details {
   }
 
   inline SharedBuffer& SharedBuffer::operator =(SharedBuffer&& rhs) {
-    m_size = std::move(rhs.m_size);
-    m_availableSize = std::move(rhs.m_availableSize);
-    m_data = std::move(rhs.m_data);
-    m_front = std::move(rhs.m_front);
+    if(this == &rhs) {
+      return *this;
+    }
+    Details::RemoveReference(m_block);
+    m_size = rhs.m_size;
+    m_availableSize = rhs.m_availableSize;
+    m_block = rhs.m_block;
+    m_front = rhs.m_front;
+    rhs.m_size = 0;
+    rhs.m_availableSize = 0;
+    rhs.m_block = nullptr;
+    rhs.m_front = nullptr;
     return *this;
   }
 
   inline void SharedBuffer::Reallocate() {
-    auto oldData = std::move(m_data);
-    m_data.reset(new char[m_availableSize]);
-    std::memcpy(m_data.get(), oldData.get(), m_size);
-    m_front = m_data.get() + (m_front - oldData.get());
+    if(m_availableSize == 0) {
+      m_availableSize = 1;
+    }
+    auto block = Details::AllocateBufferBlock(m_availableSize);
+    if(m_block) {
+      std::memcpy(block->GetData(), m_front, m_size);
+      Details::RemoveReference(m_block);
+    }
+    m_block = block;
+    m_front = m_block->GetData();
   }
 }
 
@@ -0,0 +1,164 @@
+#ifndef BEAM_SHARED_MEMORY_CHANNEL_HPP
+#define BEAM_SHARED_MEMORY_CHANNEL_HPP
+#include <atomic>
+#include <memory>
+#include <string>
+#include "Beam/IO/Channel.hpp"
+#include "Beam/IO/ConnectException.hpp"
+#include "Beam/IO/IO.hpp"
+#include "Beam/IO/NamedChannelIdentifier.hpp"
+#include "Beam/IO/SharedMemoryConnection.hpp"
+#include "Beam/IO/SharedMemoryDetails.hpp"
+#include "Beam/IO/SharedMemoryReader.hpp"
+#include "Beam/IO/SharedMemoryWriter.hpp"
+
+namespace Beam {
+namespace IO {
+
+  /**
+   * Implements a Channel to a process on the same host using a pair of
+   * single producer, single consumer rings in POSIX shared memory.
+   */
+  class SharedMemoryChannel {
+    public:
+      using Identifier = NamedChannelIdentifier;
+      using Connection = SharedMemoryConnection;
+      using Reader = SharedMemoryReader;
+      using Writer = SharedMemoryWriter;
+
+      /**
+       * Constructs a SharedMemoryChannel connected to a
+       * SharedMemoryServerConnection.
+       * @param name The name of the server to connect to.
+       */
+      explicit SharedMemoryChannel(const std::string& name);
+
+      const Identifier& GetIdentifier() const;
+
+      Connection& GetConnection();
+
+      Reader& GetReader();
+
+      Writer& GetWriter();
+
+    private:
+      friend class SharedMemoryServerConnection;
+      Identifier m_identifier;
+      std::shared_ptr<Details::SharedMemoryEntry> m_entry;
+      Connection m_connection;
+      Reader m_reader;
+      Writer m_writer;
+
+      SharedMemoryChannel(std::string name,
+        std::shared_ptr<Details::SharedMemoryEntry> entry);
+      SharedMemoryChannel(const SharedMemoryChannel&) = delete;
+      SharedMemoryChannel& operator =(const SharedMemoryChannel&) = delete;
+      static std::shared_ptr<Details::SharedMemoryEntry> Connect(
+        const std::string& name);
+  };
+
+  inline SharedMemoryChannel::SharedMemoryChannel(const std::string& name)
+    : SharedMemoryChannel("client@" + name, Connect(name)) {}
+
+  inline const SharedMemoryChannel::Identifier&
+      SharedMemoryChannel::GetIdentifier() const {
+    return m_identifier;
+  }
+
+  inline SharedMemoryChannel::Connection& SharedMemoryChannel::GetConnection() {
+    return m_connection;
+  }
+
+  inline SharedMemoryChannel::Reader& SharedMemoryChannel::GetReader() {
+    return m_reader;
+  }
+
+  inline SharedMemoryChannel::Writer& SharedMemoryChannel::GetWriter() {
+    return m_writer;
+  }
+
+  inline SharedMemoryChannel::SharedMemoryChannel(std::string name,
+    std::shared_ptr<Details::SharedMemoryEntry> entry)
+    : m_identifier(std::move(name)),
+      m_entry(std::move(entry)),
+      m_connection(m_entry),
+      m_reader(m_entry),
+      m_writer(m_entry) {}
+
+  inline std::shared_ptr<Details::SharedMemoryEntry>
+      SharedMemoryChannel::Connect(const std::string& name) {
+    static auto nextId = std::atomic_int(0);
+    auto segmentName = "/" + name + "." + std::to_string(::getpid()) + "." +
+      std::to_string(++nextId);
+    if(segmentName.size() >= Details::SharedMemoryListener::NAME_SIZE) {
+      BOOST_THROW_EXCEPTION(ConnectException("Server name is too long."));
+    }
+    auto size = Details::SharedMemorySegment::GetSize(
+      BEAM_SHARED_MEMORY_RING_SIZE);
+
+    /* A segment left behind by a prior process with the same id is
+       replaced. */
+    ::shm_unlink(segmentName.c_str());
+    auto segment = new(Details::MapSharedMemory(segmentName, size, true))
+      Details::SharedMemorySegment();
+    segment->m_capacity = BEAM_SHARED_MEMORY_RING_SIZE;
+    segment->m_clientPid.store(::getpid());
+    auto entry = std::make_shared<Details::SharedMemoryEntry>(*segment, size,
+      false);
+    try {
+      auto listener = static_cast<Details::SharedMemoryListener*>(
+        Details::MapSharedMemory("/" + name,
+        sizeof(Details::SharedMemoryListener), false));
+      auto serverPid = listener->m_pid.load();
+      listener->Lock();
+      auto tail = listener->m_tail.load();
+      auto isQueued = listener->m_isOpen.load() &&
+        tail - listener->m_head.load() < BEAM_SHARED_MEMORY_BACKLOG;
+      if(isQueued) {
+        std::strcpy(listener->m_names[tail % BEAM_SHARED_MEMORY_BACKLOG],
+          segmentName.c_str());
+        listener->m_tail.store(tail + 1);
+      }
+      listener->Unlock();
+      if(isQueued) {
+        listener->m_event.Notify();
+      }
+      ::munmap(listener, sizeof(Details::SharedMemoryListener));
+      if(!isQueued) {
+        BOOST_THROW_EXCEPTION(ConnectException("Server unavailable."));
+      }
+
+      /* A server that exits or stops accepting leaves the segment pending,
+         withdrawing it keeps a later Accept from taking it. */
+      auto isAnswered = segment->m_response.m_dataEvent.Wait([&] {
+        return segment->m_state.load() != Details::SharedMemorySegment::PENDING;
+      }, serverPid, boost::posix_time::microseconds(
+        BEAM_SHARED_MEMORY_CONNECT_TIMEOUT));
+      auto expected = std::uint32_t(Details::SharedMemorySegment::PENDING);
+      if(!isAnswered && segment->m_state.compare_exchange_strong(expected,
+          Details::SharedMemorySegment::CLOSED)) {
+        BOOST_THROW_EXCEPTION(ConnectException("Server unavailable."));
+      }
+    } catch(const std::exception&) {
+      ::shm_unlink(segmentName.c_str());
+      BOOST_RETHROW;
+    }
+    ::shm_unlink(segmentName.c_str());
+
+    /* The server may accept and close the channel before this wakes, only a
+       rejected connection is reported as a failure to connect. */
+    if(!segment->m_isAccepted.load()) {
+      BOOST_THROW_EXCEPTION(ConnectException("Connection rejected."));
+    }
+    return entry;
+  }
+}
+
+  template<>
+  struct ImplementsConcept<IO::SharedMemoryChannel, IO::Channel<
+    IO::SharedMemoryChannel::Identifier, IO::SharedMemoryChannel::Connection,
+    IO::SharedMemoryChannel::Reader, IO::SharedMemoryChannel::Writer>> :
+    std::true_type {};
+}
+
+#endif
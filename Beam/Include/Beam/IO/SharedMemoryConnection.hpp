@@ -0,0 +1,52 @@
+#ifndef BEAM_SHARED_MEMORY_CONNECTION_HPP
+#define BEAM_SHARED_MEMORY_CONNECTION_HPP
+#include <memory>
+#include "Beam/IO/Connection.hpp"
+#include "Beam/IO/IO.hpp"
+#include "Beam/IO/OpenState.hpp"
+#include "Beam/IO/SharedMemoryDetails.hpp"
+
+namespace Beam {
+namespace IO {
+
+  /** Implements a Connection over a shared memory segment. */
+  class SharedMemoryConnection {
+    public:
+      ~SharedMemoryConnection();
+
+      void Close();
+
+    private:
+      friend class SharedMemoryChannel;
+      std::shared_ptr<Details::SharedMemoryEntry> m_entry;
+      OpenState m_openState;
+
+      SharedMemoryConnection(std::shared_ptr<Details::SharedMemoryEntry> entry);
+      SharedMemoryConnection(const SharedMemoryConnection&) = delete;
+      SharedMemoryConnection& operator =(
+        const SharedMemoryConnection&) = delete;
+  };
+
+  inline SharedMemoryConnection::~SharedMemoryConnection() {
+    Close();
+  }
+
+  inline void SharedMemoryConnection::Close() {
+    if(m_openState.SetClosing()) {
+      return;
+    }
+    m_entry->Close();
+    m_openState.Close();
+  }
+
+  inline SharedMemoryConnection::SharedMemoryConnection(
+    std::shared_ptr<Details::SharedMemoryEntry> entry)
+    : m_entry(std::move(entry)) {}
+}
+
+  template<>
+  struct ImplementsConcept<IO::SharedMemoryConnection, IO::Connection> :
+    std::true_type {};
+}
+
+#endif
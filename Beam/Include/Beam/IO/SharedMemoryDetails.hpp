@@ -0,0 +1,420 @@
+#ifndef BEAM_SHARED_MEMORY_DETAILS_HPP
+#define BEAM_SHARED_MEMORY_DETAILS_HPP
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <new>
+#include <string>
+#include <thread>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/throw_exception.hpp>
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include "Beam/IO/ConnectException.hpp"
+#include "Beam/IO/EndOfFileException.hpp"
+#include "Beam/IO/IO.hpp"
+#include "Beam/Threading/Mutex.hpp"
+#include "Beam/Threading/SpinWait.hpp"
+#include "Beam/Threading/ThreadPool.hpp"
+
+#ifndef BEAM_SHARED_MEMORY_RING_SIZE
+  #define BEAM_SHARED_MEMORY_RING_SIZE (1 << 20)
+#endif
+
+#ifndef BEAM_SHARED_MEMORY_SPIN_TIME
+  #define BEAM_SHARED_MEMORY_SPIN_TIME 50
+#endif
+
+#ifndef BEAM_SHARED_MEMORY_PARK_TIME
+  #define BEAM_SHARED_MEMORY_PARK_TIME 1000
+#endif
+
+#ifndef BEAM_SHARED_MEMORY_LIVENESS_TIME
+  #define BEAM_SHARED_MEMORY_LIVENESS_TIME 100000
+#endif
+
+#ifndef BEAM_SHARED_MEMORY_CONNECT_TIMEOUT
+  #define BEAM_SHARED_MEMORY_CONNECT_TIMEOUT 10000000
+#endif
+
+#ifndef BEAM_SHARED_MEMORY_BACKLOG
+  #define BEAM_SHARED_MEMORY_BACKLOG 64
+#endif
+
+namespace Beam::IO::Details {
+  static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t) &&
+    std::atomic<std::uint32_t>::is_always_lock_free);
+  static_assert(std::atomic<std::uint64_t>::is_always_lock_free);
+  static_assert(std::atomic<pid_t>::is_always_lock_free);
+  static_assert((BEAM_SHARED_MEMORY_RING_SIZE &
+    (BEAM_SHARED_MEMORY_RING_SIZE - 1)) == 0);
+
+  inline void FutexWait(std::atomic<std::uint32_t>& word,
+      std::uint32_t expected, boost::posix_time::time_duration timeout) {
+    auto time = timespec();
+    time.tv_sec = static_cast<time_t>(timeout.total_seconds());
+    time.tv_nsec = static_cast<long>(
+      (timeout.total_microseconds() % 1000000) * 1000);
+    ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAIT,
+      expected, &time, nullptr, 0);
+  }
+
+  inline void FutexWake(std::atomic<std::uint32_t>& word) {
+    ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAKE,
+      INT_MAX, nullptr, nullptr, 0);
+  }
+
+  /** Returns whether a process exists, a pid of 0 is treated as alive. */
+  inline bool IsProcessAlive(pid_t pid) {
+    return pid == 0 || ::kill(pid, 0) == 0 || errno == EPERM;
+  }
+
+  /**
+   * A futex shared between processes that waiters park on until a condition
+   * is signaled. Notifying is free when no one is parked.
+   */
+  struct SharedMemoryEvent {
+    std::atomic<std::uint32_t> m_sequence;
+    std::atomic<std::uint32_t> m_waiters;
+
+    /** Wakes any waiters, must follow the update to the condition. */
+    void Notify() {
+      if(m_waiters.load() != 0) {
+        m_sequence.fetch_add(1);
+        FutexWake(m_sequence);
+      }
+    }
+
+    /**
+     * Waits for a condition, spinning briefly on multi-core hosts before
+     * parking the calling routine's wait on a pooled thread. Each parked wait
+     * blocks in the futex for twice as long as the last, starting from
+     * BEAM_SHARED_MEMORY_PARK_TIME and capped at the liveness interval, so an
+     * idle waiter costs a few wake-ups a second while a pooled thread is
+     * still returned periodically.
+     * @param condition The condition to wait for.
+     * @param peer The process expected to signal the condition, the wait
+     *        ends early if it exits, 0 if no process is checked.
+     * @param timeout The maximum time to wait for.
+     * @return <code>true</code> iff the condition holds.
+     */
+    template<typename F>
+    bool Wait(const F& condition, pid_t peer = 0,
+        boost::posix_time::time_duration timeout =
+          boost::posix_time::pos_infin) {
+      static const auto SPIN_TIME = [] {
+        if(std::thread::hardware_concurrency() > 1) {
+          return boost::posix_time::microseconds(BEAM_SHARED_MEMORY_SPIN_TIME);
+        }
+        return boost::posix_time::microseconds(0);
+      }();
+      const auto MAX_PARK_TIME =
+        std::chrono::microseconds(BEAM_SHARED_MEMORY_LIVENESS_TIME);
+      if(Threading::SpinUntil(condition, SPIN_TIME)) {
+        return true;
+      }
+      auto start = std::chrono::steady_clock::now();
+      auto deadline = timeout.is_special() ?
+        std::chrono::steady_clock::time_point::max() :
+        start + std::chrono::microseconds(timeout.total_microseconds());
+      auto nextCheck = start + MAX_PARK_TIME;
+      auto parkTime = std::min(
+        std::chrono::microseconds(BEAM_SHARED_MEMORY_PARK_TIME), MAX_PARK_TIME);
+      while(true) {
+        if(deadline != std::chrono::steady_clock::time_point::max()) {
+          parkTime = std::clamp(
+            std::chrono::duration_cast<std::chrono::microseconds>(
+            deadline - std::chrono::steady_clock::now()),
+            std::chrono::microseconds(0), parkTime);
+        }
+        if(Threading::Park([&] {
+            auto sequence = m_sequence.load();
+            m_waiters.fetch_add(1);
+            if(!condition()) {
+              FutexWait(m_sequence, sequence,
+                boost::posix_time::microseconds(parkTime.count()));
+            }
+            m_waiters.fetch_sub(1);
+            return condition();
+          })) {
+          return true;
+        }
+        auto now = std::chrono::steady_clock::now();
+        if(now >= deadline) {
+          return condition();
+        }
+        if(now >= nextCheck) {
+          if(!IsProcessAlive(peer)) {
+            return condition();
+          }
+          nextCheck = now + MAX_PARK_TIME;
+        }
+        parkTime = std::min(2 * parkTime, MAX_PARK_TIME);
+      }
+    }
+  };
+
+  /**
+   * The header of a single producer, single consumer byte ring, the head and
+   * tail count bytes ever read and written.
+   */
+  struct SharedMemoryRing {
+    alignas(64) std::atomic<std::uint64_t> m_head;
+    alignas(64) std::atomic<std::uint64_t> m_tail;
+    alignas(64) SharedMemoryEvent m_dataEvent;
+    alignas(64) SharedMemoryEvent m_spaceEvent;
+  };
+
+  /**
+   * The segment shared by both ends of a channel, the ring data follows the
+   * header.
+   */
+  struct SharedMemorySegment {
+    enum State : std::uint32_t {
+      PENDING,
+      ACCEPTED,
+      CLOSED
+    };
+    alignas(64) std::atomic<std::uint32_t> m_state;
+    std::atomic<std::uint32_t> m_isAccepted;
+    std::uint64_t m_capacity;
+
+    /** The client's process, checked by a server waiting on it. */
+    std::atomic<pid_t> m_clientPid;
+
+    /** The server's process, stored before the segment is accepted. */
+    std::atomic<pid_t> m_serverPid;
+
+    /** The ring written by the client and read by the server. */
+    SharedMemoryRing m_request;
+
+    /** The ring written by the server and read by the client. */
+    SharedMemoryRing m_response;
+
+    static std::size_t GetSize(std::uint64_t capacity) {
+      return sizeof(SharedMemorySegment) + 2 * capacity;
+    }
+
+    char* GetRequestData() {
+      return reinterpret_cast<char*>(this + 1);
+    }
+
+    char* GetResponseData() {
+      return GetRequestData() + m_capacity;
+    }
+
+    bool IsClosed() const {
+      return m_state.load() == CLOSED;
+    }
+  };
+
+  /** The segment a server publishes for clients to queue their segments. */
+  struct SharedMemoryListener {
+    static constexpr auto NAME_SIZE = std::size_t(64);
+    alignas(64) std::atomic<std::uint32_t> m_isOpen;
+
+    /** The server's process. */
+    std::atomic<pid_t> m_pid;
+
+    /** The process holding the lock, or 0. */
+    std::atomic<pid_t> m_lock;
+    std::atomic<std::uint32_t> m_head;
+    std::atomic<std::uint32_t> m_tail;
+    SharedMemoryEvent m_event;
+    char m_names[BEAM_SHARED_MEMORY_BACKLOG][NAME_SIZE];
+
+    void Lock() {
+      auto pid = ::getpid();
+      auto expected = pid_t(0);
+      while(!m_lock.compare_exchange_weak(expected, pid)) {
+
+        /* A holder that exited without unlocking is replaced, every critical
+           section publishes its update with its final store so the queue is
+           left consistent. */
+        if(expected != 0 && !IsProcessAlive(expected) &&
+            m_lock.compare_exchange_strong(expected, pid)) {
+          return;
+        }
+        expected = 0;
+        std::this_thread::yield();
+      }
+    }
+
+    void Unlock() {
+      m_lock.store(0);
+    }
+  };
+
+  /** Maps a shared memory object, optionally creating it. */
+  inline void* MapSharedMemory(const std::string& name, std::size_t size,
+      bool create) {
+    auto fd = create ?
+      ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600) :
+      ::shm_open(name.c_str(), O_RDWR, 0);
+    if(fd == -1) {
+      BOOST_THROW_EXCEPTION(ConnectException(
+        "Unable to open shared memory " + name + ": " + std::strerror(errno)));
+    }
+    if(create && ::ftruncate(fd, static_cast<off_t>(size)) == -1) {
+      auto error = errno;
+      ::close(fd);
+      ::shm_unlink(name.c_str());
+      BOOST_THROW_EXCEPTION(ConnectException(
+        "Unable to size shared memory " + name + ": " + std::strerror(error)));
+    }
+    auto address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED,
+      fd, 0);
+    auto error = errno;
+    ::close(fd);
+    if(address == MAP_FAILED) {
+      if(create) {
+        ::shm_unlink(name.c_str());
+      }
+      BOOST_THROW_EXCEPTION(ConnectException(
+        "Unable to map shared memory " + name + ": " + std::strerror(error)));
+    }
+    return address;
+  }
+
+  /** Returns the size of an existing shared memory object. */
+  inline std::size_t GetSharedMemorySize(const std::string& name) {
+    auto fd = ::shm_open(name.c_str(), O_RDONLY, 0);
+    if(fd == -1) {
+      BOOST_THROW_EXCEPTION(ConnectException(
+        "Unable to open shared memory " + name + ": " + std::strerror(errno)));
+    }
+    struct stat status = {};
+    auto result = ::fstat(fd, &status);
+    ::close(fd);
+    if(result == -1) {
+      BOOST_THROW_EXCEPTION(ConnectException(
+        "Unable to stat shared memory " + name + "."));
+    }
+    return static_cast<std::size_t>(status.st_size);
+  }
+
+  /** One direction of a channel as seen by one end. */
+  struct SharedMemoryStream {
+    SharedMemoryRing* m_ring;
+    char* m_data;
+    std::uint64_t m_capacity;
+
+    std::size_t GetAvailableSize() const {
+      return static_cast<std::size_t>(m_ring->m_tail.load() -
+        m_ring->m_head.load(std::memory_order_relaxed));
+    }
+
+    std::size_t GetFreeSize() const {
+      return static_cast<std::size_t>(m_capacity - (
+        m_ring->m_tail.load(std::memory_order_relaxed) -
+        m_ring->m_head.load()));
+    }
+
+    std::size_t Read(char* destination, std::size_t size) {
+      auto head = m_ring->m_head.load(std::memory_order_relaxed);
+      auto tail = m_ring->m_tail.load();
+      auto count = static_cast<std::size_t>(
+        std::min<std::uint64_t>(tail - head, size));
+      if(count == 0) {
+        return 0;
+      }
+      auto offset = static_cast<std::size_t>(head & (m_capacity - 1));
+      auto first = std::min<std::size_t>(count, m_capacity - offset);
+      std::memcpy(destination, m_data + offset, first);
+      std::memcpy(destination + first, m_data, count - first);
+      m_ring->m_head.store(head + count);
+      m_ring->m_spaceEvent.Notify();
+      return count;
+    }
+
+    std::size_t Write(const char* source, std::size_t size) {
+      auto tail = m_ring->m_tail.load(std::memory_order_relaxed);
+      auto head = m_ring->m_head.load();
+      auto count = static_cast<std::size_t>(
+        std::min<std::uint64_t>(m_capacity - (tail - head), size));
+      if(count == 0) {
+        return 0;
+      }
+      auto offset = static_cast<std::size_t>(tail & (m_capacity - 1));
+      auto first = std::min<std::size_t>(count, m_capacity - offset);
+      std::memcpy(m_data + offset, source, first);
+      std::memcpy(m_data, source + first, count - first);
+      m_ring->m_tail.store(tail + count);
+      m_ring->m_dataEvent.Notify();
+      return count;
+    }
+  };
+
+  /** Stores one end of a channel over a mapped SharedMemorySegment. */
+  struct SharedMemoryEntry {
+    SharedMemorySegment* m_segment;
+    std::size_t m_size;
+    SharedMemoryStream m_input;
+    SharedMemoryStream m_output;
+    bool m_isServer;
+    Threading::Mutex m_readMutex;
+    Threading::Mutex m_writeMutex;
+
+    SharedMemoryEntry(SharedMemorySegment& segment, std::size_t size,
+        bool isServer)
+        : m_segment(&segment),
+          m_size(size),
+          m_isServer(isServer) {
+      auto request = SharedMemoryStream{&segment.m_request,
+        segment.GetRequestData(), segment.m_capacity};
+      auto response = SharedMemoryStream{&segment.m_response,
+        segment.GetResponseData(), segment.m_capacity};
+      m_input = isServer ? request : response;
+      m_output = isServer ? response : request;
+    }
+
+    ~SharedMemoryEntry() {
+      Close();
+      ::munmap(m_segment, m_size);
+    }
+
+    /** Returns the process on the other end, or 0 if not yet known. */
+    pid_t GetPeerPid() const {
+      if(m_isServer) {
+        return m_segment->m_clientPid.load();
+      }
+      return m_segment->m_serverPid.load();
+    }
+
+    /**
+     * Waits for a condition signaled by the peer, closing the channel if the
+     * peer exits first.
+     */
+    template<typename F>
+    void Wait(SharedMemoryEvent& event, const F& condition) {
+      if(!event.Wait(condition, GetPeerPid())) {
+        Close();
+      }
+    }
+
+    void Close() {
+      if(m_segment->m_state.exchange(SharedMemorySegment::CLOSED) ==
+          SharedMemorySegment::CLOSED) {
+        return;
+      }
+      for(auto ring : {&m_segment->m_request, &m_segment->m_response}) {
+        for(auto event : {&ring->m_dataEvent, &ring->m_spaceEvent}) {
+          event->m_sequence.fetch_add(1);
+          FutexWake(event->m_sequence);
+        }
+      }
+    }
+  };
+}
+
+#endif
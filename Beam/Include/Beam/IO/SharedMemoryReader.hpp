@@ -0,0 +1,88 @@
+#ifndef BEAM_SHARED_MEMORY_READER_HPP
+#define BEAM_SHARED_MEMORY_READER_HPP
+#include <algorithm>
+#include <memory>
+#include "Beam/IO/EndOfFileException.hpp"
+#include "Beam/IO/IO.hpp"
+#include "Beam/IO/Reader.hpp"
+#include "Beam/IO/SharedMemoryDetails.hpp"
+
+namespace Beam {
+namespace IO {
+
+  /** Reads from the ring a shared memory channel's peer writes to. */
+  class SharedMemoryReader {
+    public:
+      bool IsDataAvailable() const;
+
+      template<typename Buffer>
+      std::size_t Read(Out<Buffer> destination);
+
+      std::size_t Read(char* destination, std::size_t size);
+
+      template<typename Buffer>
+      std::size_t Read(Out<Buffer> destination, std::size_t size);
+
+    private:
+      friend class SharedMemoryChannel;
+      static constexpr auto DEFAULT_READ_SIZE = std::size_t(64 * 1024);
+      std::shared_ptr<Details::SharedMemoryEntry> m_entry;
+
+      SharedMemoryReader(std::shared_ptr<Details::SharedMemoryEntry> entry);
+      SharedMemoryReader(const SharedMemoryReader&) = delete;
+      SharedMemoryReader& operator =(const SharedMemoryReader&) = delete;
+  };
+
+  inline bool SharedMemoryReader::IsDataAvailable() const {
+    return m_entry->m_input.GetAvailableSize() != 0;
+  }
+
+  template<typename Buffer>
+  std::size_t SharedMemoryReader::Read(Out<Buffer> destination) {
+    return Read(Store(destination), DEFAULT_READ_SIZE);
+  }
+
+  inline std::size_t SharedMemoryReader::Read(char* destination,
+      std::size_t size) {
+    if(size == 0) {
+      return 0;
+    }
+    auto lock = std::lock_guard(m_entry->m_readMutex);
+    auto& input = m_entry->m_input;
+    auto& segment = *m_entry->m_segment;
+    while(true) {
+      if(auto count = input.Read(destination, size)) {
+        return count;
+      }
+      if(segment.IsClosed()) {
+        BOOST_THROW_EXCEPTION(EndOfFileException());
+      }
+      m_entry->Wait(input.m_ring->m_dataEvent, [&] {
+        return input.GetAvailableSize() != 0 || segment.IsClosed();
+      });
+    }
+  }
+
+  template<typename Buffer>
+  std::size_t SharedMemoryReader::Read(Out<Buffer> destination,
+      std::size_t size) {
+    auto initialSize = destination->GetSize();
+    auto readSize = std::min(size,
+      std::max(DEFAULT_READ_SIZE, m_entry->m_input.GetAvailableSize()));
+    destination->Grow(readSize);
+    auto result = Read(destination->GetMutableData() + initialSize, readSize);
+    destination->Shrink(readSize - result);
+    return result;
+  }
+
+  inline SharedMemoryReader::SharedMemoryReader(
+    std::shared_ptr<Details::SharedMemoryEntry> entry)
+    : m_entry(std::move(entry)) {}
+}
+
+  template<>
+  struct ImplementsConcept<IO::SharedMemoryReader, IO::Reader> :
+    std::true_type {};
+}
+
+#endif
@@ -0,0 +1,155 @@
+#ifndef BEAM_SHARED_MEMORY_SERVER_CONNECTION_HPP
+#define BEAM_SHARED_MEMORY_SERVER_CONNECTION_HPP
+#include <memory>
+#include <string>
+#include "Beam/IO/ConnectException.hpp"
+#include "Beam/IO/EndOfFileException.hpp"
+#include "Beam/IO/IO.hpp"
+#include "Beam/IO/OpenState.hpp"
+#include "Beam/IO/ServerConnection.hpp"
+#include "Beam/IO/SharedMemoryChannel.hpp"
+#include "Beam/IO/SharedMemoryDetails.hpp"
+
+namespace Beam {
+namespace IO {
+
+  /**
+   * Accepts SharedMemoryChannels from processes on the same host. Clients
+   * create their own segment and queue its name in a segment published by the
+   * server under its name.
+   */
+  class SharedMemoryServerConnection {
+    public:
+      using Channel = SharedMemoryChannel;
+
+      /**
+       * Constructs a SharedMemoryServerConnection.
+       * @param name The name clients connect to, replacing any segment left
+       *        behind by a prior server of the same name.
+       */
+      explicit SharedMemoryServerConnection(std::string name);
+
+      ~SharedMemoryServerConnection();
+
+      std::unique_ptr<Channel> Accept();
+
+      void Close();
+
+    private:
+      std::string m_name;
+      Details::SharedMemoryListener* m_listener;
+      OpenState m_openState;
+
+      SharedMemoryServerConnection(
+        const SharedMemoryServerConnection&) = delete;
+      SharedMemoryServerConnection& operator =(
+        const SharedMemoryServerConnection&) = delete;
+      std::shared_ptr<Details::SharedMemoryEntry> Open(
+        const std::string& segmentName);
+  };
+
+  inline SharedMemoryServerConnection::SharedMemoryServerConnection(
+      std::string name)
+      : m_name("/" + std::move(name)) {
+    ::shm_unlink(m_name.c_str());
+    m_listener = new(Details::MapSharedMemory(m_name,
+      sizeof(Details::SharedMemoryListener), true))
+      Details::SharedMemoryListener();
+    m_listener->m_pid.store(::getpid());
+    m_listener->m_isOpen.store(1);
+  }
+
+  inline SharedMemoryServerConnection::~SharedMemoryServerConnection() {
+    Close();
+    ::munmap(m_listener, sizeof(Details::SharedMemoryListener));
+  }
+
+  inline std::unique_ptr<typename SharedMemoryServerConnection::Channel>
+      SharedMemoryServerConnection::Accept() {
+    while(true) {
+      m_listener->m_event.Wait([&] {
+        return !m_listener->m_isOpen.load() ||
+          m_listener->m_head.load() != m_listener->m_tail.load();
+      });
+      m_listener->Lock();
+      if(!m_listener->m_isOpen.load()) {
+        m_listener->Unlock();
+        BOOST_THROW_EXCEPTION(EndOfFileException());
+      }
+      auto head = m_listener->m_head.load();
+      if(head == m_listener->m_tail.load()) {
+        m_listener->Unlock();
+        continue;
+      }
+      auto segmentName = std::string(
+        m_listener->m_names[head % BEAM_SHARED_MEMORY_BACKLOG]);
+      m_listener->m_head.store(head + 1);
+      m_listener->Unlock();
+      if(auto entry = Open(segmentName)) {
+        entry->m_segment->m_serverPid.store(::getpid());
+        entry->m_segment->m_isAccepted.store(1);
+        auto expected = std::uint32_t(Details::SharedMemorySegment::PENDING);
+        if(entry->m_segment->m_state.compare_exchange_strong(expected,
+            Details::SharedMemorySegment::ACCEPTED)) {
+          entry->m_segment->m_response.m_dataEvent.Notify();
+          return std::unique_ptr<Channel>(
+            new Channel(segmentName.substr(1), std::move(entry)));
+        }
+      }
+    }
+  }
+
+  inline void SharedMemoryServerConnection::Close() {
+    if(m_openState.SetClosing()) {
+      return;
+    }
+    m_listener->Lock();
+    m_listener->m_isOpen.store(0);
+    auto head = m_listener->m_head.load();
+    auto tail = m_listener->m_tail.load();
+    m_listener->m_head.store(tail);
+    m_listener->Unlock();
+    for(; head != tail; ++head) {
+      if(auto entry = Open(m_listener->m_names[
+          head % BEAM_SHARED_MEMORY_BACKLOG])) {
+        entry->Close();
+      }
+    }
+    m_listener->m_event.Notify();
+    ::shm_unlink(m_name.c_str());
+    m_openState.Close();
+  }
+
+  inline std::shared_ptr<Details::SharedMemoryEntry>
+      SharedMemoryServerConnection::Open(const std::string& segmentName) {
+
+    /* The client may have given up and removed its segment, in which case
+       it is skipped. */
+    try {
+      auto size = Details::GetSharedMemorySize(segmentName);
+      if(size < sizeof(Details::SharedMemorySegment)) {
+        return nullptr;
+      }
+      auto segment = static_cast<Details::SharedMemorySegment*>(
+        Details::MapSharedMemory(segmentName, size, false));
+      auto capacity = segment->m_capacity;
+      if(capacity == 0 || (capacity & (capacity - 1)) != 0 ||
+          Details::SharedMemorySegment::GetSize(capacity) != size) {
+        ::munmap(segment, size);
+        return nullptr;
+      }
+      return std::make_shared<Details::SharedMemoryEntry>(*segment, size,
+        true);
+    } catch(const ConnectException&) {
+      return nullptr;
+    }
+  }
+}
+
+  template<>
+  struct ImplementsConcept<IO::SharedMemoryServerConnection,
+    IO::ServerConnection<IO::SharedMemoryServerConnection::Channel>> :
+    std::true_type {};
+}
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef BEAM_SHARED_MEMORY_WRITER_HPP
+#define BEAM_SHARED_MEMORY_WRITER_HPP
+#include <memory>
+#include "Beam/IO/EndOfFileException.hpp"
+#include "Beam/IO/IO.hpp"
+#include "Beam/IO/SharedBuffer.hpp"
+#include "Beam/IO/SharedMemoryDetails.hpp"
+#include "Beam/IO/Writer.hpp"
+
+namespace Beam {
+namespace IO {
+
+  /** Writes to the ring a shared memory channel's peer reads from. */
+  class SharedMemoryWriter {
+    public:
+      using Buffer = SharedBuffer;
+
+      void Write(const void* data, std::size_t size);
+
+      template<typename BufferType>
+      void Write(const BufferType& data);
+
+    private:
+      friend class SharedMemoryChannel;
+      std::shared_ptr<Details::SharedMemoryEntry> m_entry;
+
+      SharedMemoryWriter(std::shared_ptr<Details::SharedMemoryEntry> entry);
+      SharedMemoryWriter(const SharedMemoryWriter&) = delete;
+      SharedMemoryWriter& operator =(const SharedMemoryWriter&) = delete;
+  };
+
+  inline void SharedMemoryWriter::Write(const void* data, std::size_t size) {
+    auto lock = std::lock_guard(m_entry->m_writeMutex);
+    auto& output = m_entry->m_output;
+    auto& segment = *m_entry->m_segment;
+    auto source = static_cast<const char*>(data);
+    while(true) {
+      if(segment.IsClosed()) {
+        BOOST_THROW_EXCEPTION(EndOfFileException());
+      }
+      auto count = output.Write(source, size);
+      source += count;
+      size -= count;
+      if(size == 0) {
+        return;
+      }
+      m_entry->Wait(output.m_ring->m_spaceEvent, [&] {
+        return output.GetFreeSize() != 0 || segment.IsClosed();
+      });
+    }
+  }
+
+  template<typename BufferType>
+  void SharedMemoryWriter::Write(const BufferType& data) {
+    Write(data.GetData(), data.GetSize());
+  }
+
+  inline SharedMemoryWriter::SharedMemoryWriter(
+    std::shared_ptr<Details::SharedMemoryEntry> entry)
+    : m_entry(std::move(entry)) {}
+}
+
+  template<typename BufferType>
+  struct ImplementsConcept<IO::SharedMemoryWriter, IO::Writer<BufferType>> :
+    std::true_type {};
+}
+
+#endif
@@ -2,6 +2,7 @@
 #define BEAM_WRITER_HPP
 #include <type_traits>
 #include "Beam/IO/Buffer.hpp"
+#include "Beam/IO/BufferSequence.hpp"
 #include "Beam/Utilities/Concept.hpp"
 #include "Beam/Utilities/StaticMemberChecks.hpp"
 
@@ -35,6 +36,15 @@ namespace Details {
      * @param result The result of the write.
      */
     void Write(const Buffer& data);
+
+    /**
+     * Writes a sequence of Buffers as one contiguous write, only Writers for
+     * which IsGatherWriter holds provide this, all others are written to
+     * through WriteSequence.
+     * @param buffers The Buffers to write.
+     */
+    template<typename... S>
+    void Write(const BufferSequence<S...>& buffers);
   };
 
   /**
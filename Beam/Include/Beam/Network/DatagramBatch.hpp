@@ -0,0 +1,214 @@
+#ifndef BEAM_DATAGRAM_BATCH_HPP
+#define BEAM_DATAGRAM_BATCH_HPP
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include <boost/asio/ip/udp.hpp>
+#include <boost/throw_exception.hpp>
+#include "Beam/Network/IpAddress.hpp"
+#include "Beam/Network/Network.hpp"
+#ifdef __linux__
+  #include <sys/socket.h>
+  #include <sys/uio.h>
+#endif
+
+namespace Beam::Network {
+
+  /**
+   * Stores a batch of datagrams in a single arena so that they can be sent
+   * or received with one system call. The arena is allocated once and reused
+   * by every batch operation.
+   */
+  class DatagramBatch {
+    public:
+
+      /**
+       * Constructs a DatagramBatch.
+       * @param capacity The maximum number of datagrams in the batch.
+       * @param maxDatagramSize The maximum size of a single datagram.
+       */
+      DatagramBatch(std::size_t capacity, std::size_t maxDatagramSize);
+
+      /** Returns the maximum number of datagrams in the batch. */
+      std::size_t GetCapacity() const;
+
+      /** Returns the maximum size of a single datagram. */
+      std::size_t GetMaxDatagramSize() const;
+
+      /** Returns the number of datagrams in the batch. */
+      std::size_t GetSize() const;
+
+      /** Returns <code>true</code> iff the batch has no datagrams. */
+      bool IsEmpty() const;
+
+      /** Returns <code>true</code> iff no more datagrams can be added. */
+      bool IsFull() const;
+
+      /**
+       * Returns the data of a datagram.
+       * @param index The index of the datagram.
+       */
+      const char* GetData(std::size_t index) const;
+
+      /**
+       * Returns the size of a datagram.
+       * @param index The index of the datagram.
+       */
+      std::size_t GetDatagramSize(std::size_t index) const;
+
+      /**
+       * Returns the address a datagram was received from or is sent to.
+       * @param index The index of the datagram.
+       */
+      IpAddress GetAddress(std::size_t index) const;
+
+      /**
+       * Returns the endpoint a datagram was received from or is sent to.
+       * @param index The index of the datagram.
+       */
+      const boost::asio::ip::udp::endpoint& GetEndpoint(
+        std::size_t index) const;
+
+      /**
+       * Adds a datagram to send, throwing an std::length_error if the batch
+       * is full or the datagram is larger than the maximum datagram size.
+       * @param data The datagram's data.
+       * @param size The size of the datagram.
+       * @param destination The datagram's destination.
+       */
+      void Add(const void* data, std::size_t size,
+        const IpAddress& destination);
+
+      /**
+       * Adds a datagram to send, throwing an std::length_error if the batch
+       * is full or the datagram is larger than the maximum datagram size.
+       * @param data The datagram's data.
+       * @param size The size of the datagram.
+       * @param destination The datagram's destination.
+       */
+      void Add(const void* data, std::size_t size,
+        const boost::asio::ip::udp::endpoint& destination);
+
+      /** Removes all datagrams, keeping the arena. */
+      void Reset();
+
+    private:
+      friend class UdpSocketReceiver;
+      friend class UdpSocketSender;
+      std::size_t m_maxDatagramSize;
+      std::size_t m_size;
+      std::unique_ptr<char[]> m_arena;
+      std::vector<std::size_t> m_sizes;
+      std::vector<boost::asio::ip::udp::endpoint> m_endpoints;
+#ifdef __linux__
+      mutable std::vector<iovec> m_vectors;
+      mutable std::vector<mmsghdr> m_headers;
+
+      mmsghdr* PrepareHeaders(std::size_t count, bool isReceive) const;
+#endif
+      char* GetMutableData(std::size_t index);
+  };
+
+  inline DatagramBatch::DatagramBatch(std::size_t capacity,
+      std::size_t maxDatagramSize)
+      : m_maxDatagramSize(maxDatagramSize),
+        m_size(0),
+        m_arena(std::make_unique<char[]>(capacity * maxDatagramSize)),
+        m_sizes(capacity, 0),
+        m_endpoints(capacity) {
+#ifdef __linux__
+    m_vectors.resize(capacity);
+    m_headers.resize(capacity);
+#endif
+  }
+
+  inline std::size_t DatagramBatch::GetCapacity() const {
+    return m_sizes.size();
+  }
+
+  inline std::size_t DatagramBatch::GetMaxDatagramSize() const {
+    return m_maxDatagramSize;
+  }
+
+  inline std::size_t DatagramBatch::GetSize() const {
+    return m_size;
+  }
+
+  inline bool DatagramBatch::IsEmpty() const {
+    return m_size == 0;
+  }
+
+  inline bool DatagramBatch::IsFull() const {
+    return m_size == GetCapacity();
+  }
+
+  inline const char* DatagramBatch::GetData(std::size_t index) const {
+    return m_arena.get() + index * m_maxDatagramSize;
+  }
+
+  inline std::size_t DatagramBatch::GetDatagramSize(std::size_t index) const {
+    return m_sizes[index];
+  }
+
+  inline IpAddress DatagramBatch::GetAddress(std::size_t index) const {
+    return IpAddress(m_endpoints[index].address().to_string(),
+      m_endpoints[index].port());
+  }
+
+  inline const boost::asio::ip::udp::endpoint& DatagramBatch::GetEndpoint(
+      std::size_t index) const {
+    return m_endpoints[index];
+  }
+
+  inline void DatagramBatch::Add(const void* data, std::size_t size,
+      const IpAddress& destination) {
+    Add(data, size, boost::asio::ip::udp::endpoint(
+      boost::asio::ip::address::from_string(destination.GetHost()),
+      destination.GetPort()));
+  }
+
+  inline void DatagramBatch::Add(const void* data, std::size_t size,
+      const boost::asio::ip::udp::endpoint& destination) {
+    if(IsFull()) {
+      BOOST_THROW_EXCEPTION(std::length_error("Datagram batch is full."));
+    } else if(size > m_maxDatagramSize) {
+      BOOST_THROW_EXCEPTION(std::length_error(
+        "Datagram exceeds the batch's maximum datagram size."));
+    }
+    std::memcpy(GetMutableData(m_size), data, size);
+    m_sizes[m_size] = size;
+    m_endpoints[m_size] = destination;
+    ++m_size;
+  }
+
+  inline void DatagramBatch::Reset() {
+    m_size = 0;
+  }
+
+#ifdef __linux__
+  inline mmsghdr* DatagramBatch::PrepareHeaders(std::size_t count,
+      bool isReceive) const {
+    for(auto i = std::size_t(0); i != count; ++i) {
+      auto& vector = m_vectors[i];
+      vector.iov_base = const_cast<char*>(GetData(i));
+      vector.iov_len = isReceive ? m_maxDatagramSize : m_sizes[i];
+      auto& header = m_headers[i];
+      header = mmsghdr();
+      header.msg_hdr.msg_name =
+        const_cast<boost::asio::ip::udp::endpoint&>(m_endpoints[i]).data();
+      header.msg_hdr.msg_namelen = static_cast<socklen_t>(isReceive ?
+        m_endpoints[i].capacity() : m_endpoints[i].size());
+      header.msg_hdr.msg_iov = &vector;
+      header.msg_hdr.msg_iovlen = 1;
+    }
+    return m_headers.data();
+  }
+#endif
+
+  inline char* DatagramBatch::GetMutableData(std::size_t index) {
+    return m_arena.get() + index * m_maxDatagramSize;
+  }
+}
+
+#endif
@@ -0,0 +1,221 @@
+#ifndef BEAM_IO_URING_DETAILS_HPP
+#define BEAM_IO_URING_DETAILS_HPP
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <utility>
+#include <boost/thread/mutex.hpp>
+#include <linux/io_uring.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "Beam/IO/EndOfFileException.hpp"
+#include "Beam/Network/IoUringService.hpp"
+#include "Beam/Network/Network.hpp"
+#include "Beam/Network/SocketException.hpp"
+#include "Beam/Threading/ConditionVariable.hpp"
+#include "Beam/Threading/Mutex.hpp"
+
+#ifndef BEAM_IO_URING_RECEIVE_BUFFER_COUNT
+  #define BEAM_IO_URING_RECEIVE_BUFFER_COUNT 16
+#endif
+
+#ifndef BEAM_IO_URING_RECEIVE_BUFFER_SIZE
+  #define BEAM_IO_URING_RECEIVE_BUFFER_SIZE 16384
+#endif
+
+namespace Beam::Network::Details {
+  template<typename F>
+  struct UringFunctionOperation final : IoUringService::Operation {
+    F m_function;
+
+    UringFunctionOperation(F function)
+      : m_function(std::move(function)) {}
+
+    void Complete(int result, std::uint32_t flags) override {
+      m_function(result, flags);
+    }
+  };
+
+  template<typename F>
+  UringFunctionOperation<std::decay_t<F>> MakeUringOperation(F&& function) {
+    return UringFunctionOperation<std::decay_t<F>>(std::forward<F>(function));
+  }
+
+  /**
+   * Stores a socket driven by io_uring. Data is received by a single
+   * multishot receive into a group of buffers provided to the kernel, the
+   * reader copies out of those buffers and provides them back to the kernel
+   * along with the next submission.
+   */
+  struct UringSocketEntry :
+      std::enable_shared_from_this<UringSocketEntry> {
+    static constexpr auto BUFFER_COUNT =
+      std::uint16_t(BEAM_IO_URING_RECEIVE_BUFFER_COUNT);
+    static constexpr auto BUFFER_SIZE =
+      std::uint32_t(BEAM_IO_URING_RECEIVE_BUFFER_SIZE);
+    struct ReceiveOperation final : IoUringService::Operation {
+      UringSocketEntry* m_entry;
+
+      void Complete(int result, std::uint32_t flags) override {
+        m_entry->OnReceive(result, flags);
+      }
+    };
+    struct Chunk {
+      std::uint16_t m_id;
+      std::uint32_t m_offset;
+      std::uint32_t m_size;
+    };
+    IoUringService* m_service;
+    int m_fd;
+    boost::mutex m_mutex;
+    bool m_isOpen;
+    bool m_isReceiving;
+    bool m_isEndOfFile;
+    int m_errorCode;
+    bool m_isReadPending;
+    int m_pendingWrites;
+    Threading::ConditionVariable m_receiveCondition;
+    Threading::ConditionVariable m_isPendingCondition;
+    Threading::Mutex m_writeMutex;
+    std::unique_ptr<char[]> m_buffers;
+    std::uint16_t m_group;
+    std::deque<Chunk> m_chunks;
+    ReceiveOperation m_receiveOperation;
+    std::shared_ptr<UringSocketEntry> m_receiveReference;
+
+    UringSocketEntry(IoUringService& service)
+        : m_service(&service),
+          m_fd(-1),
+          m_isOpen(false),
+          m_isReceiving(false),
+          m_isEndOfFile(false),
+          m_errorCode(0),
+          m_isReadPending(false),
+          m_pendingWrites(0),
+          m_group(service.AllocateBufferGroup()) {
+      m_receiveOperation.m_entry = this;
+    }
+
+    ~UringSocketEntry() {
+      m_service->ReleaseBufferGroup(m_group, BUFFER_COUNT);
+      if(m_fd != -1) {
+        ::close(m_fd);
+      }
+    }
+
+    void Open() {
+      m_buffers = std::make_unique<char[]>(
+        std::size_t(BUFFER_COUNT) * BUFFER_SIZE);
+      auto lock = boost::lock_guard(m_mutex);
+      m_service->Queue(nullptr, [&] (auto& entry) {
+        entry.opcode = IORING_OP_PROVIDE_BUFFERS;
+        entry.fd = BUFFER_COUNT;
+        entry.addr = reinterpret_cast<std::uint64_t>(m_buffers.get());
+        entry.len = BUFFER_SIZE;
+        entry.buf_group = m_group;
+      });
+      m_isOpen = true;
+      Receive();
+    }
+
+    void Close() {
+      auto lock = boost::unique_lock(m_mutex);
+      if(!m_isOpen) {
+        return;
+      }
+      m_isOpen = false;
+      ::shutdown(m_fd, SHUT_RDWR);
+      m_service->Cancel(m_fd);
+      m_receiveCondition.notify_all();
+      while(m_isReadPending || m_pendingWrites != 0) {
+        m_isPendingCondition.wait(lock);
+      }
+    }
+
+    void BeginReadOperation() {
+      m_isReadPending = true;
+    }
+
+    void EndReadOperation() {
+      m_isReadPending = false;
+      if(!m_isOpen) {
+        m_isPendingCondition.notify_all();
+      }
+    }
+
+    void BeginWriteOperation() {
+      auto lock = boost::lock_guard(m_mutex);
+      if(!m_isOpen) {
+        BOOST_THROW_EXCEPTION(IO::EndOfFileException());
+      }
+      ++m_pendingWrites;
+    }
+
+    void EndWriteOperation() {
+      auto lock = boost::lock_guard(m_mutex);
+      --m_pendingWrites;
+      if(m_pendingWrites == 0 && !m_isOpen) {
+        m_isPendingCondition.notify_all();
+      }
+    }
+
+    /** Arms the multishot receive, the mutex must be held. */
+    void Receive() {
+      if(m_isReceiving || m_isEndOfFile || !m_isOpen) {
+        return;
+      }
+      m_isReceiving = true;
+      m_receiveReference = shared_from_this();
+      m_service->Submit(&m_receiveOperation, [&] (auto& entry) {
+        entry.opcode = IORING_OP_RECV;
+        entry.fd = m_fd;
+        entry.ioprio = IORING_RECV_MULTISHOT;
+        entry.flags = IOSQE_BUFFER_SELECT;
+        entry.buf_group = m_group;
+      });
+    }
+
+    /** Provides a buffer back to the kernel, the mutex must be held. */
+    void Recycle(std::uint16_t id) {
+      m_service->Queue(nullptr, [&] (auto& entry) {
+        entry.opcode = IORING_OP_PROVIDE_BUFFERS;
+        entry.fd = 1;
+        entry.addr = reinterpret_cast<std::uint64_t>(GetBuffer(id));
+        entry.len = BUFFER_SIZE;
+        entry.buf_group = m_group;
+        entry.off = id;
+      });
+    }
+
+    const char* GetBuffer(std::uint16_t id) const {
+      return m_buffers.get() + id * BUFFER_SIZE;
+    }
+
+    void OnReceive(int result, std::uint32_t flags) {
+      auto reference = std::shared_ptr<UringSocketEntry>();
+      auto lock = boost::lock_guard(m_mutex);
+      if(result > 0 && (flags & IORING_CQE_F_BUFFER)) {
+        m_chunks.push_back({static_cast<std::uint16_t>(
+          flags >> IORING_CQE_BUFFER_SHIFT), 0,
+          static_cast<std::uint32_t>(result)});
+      } else if(result == 0 || result == -ECANCELED) {
+        m_isEndOfFile = true;
+      } else if(result != -ENOBUFS) {
+
+        /* Running out of buffers only stops the receive until the reader
+           recycles one, any other error is reported to the reader. */
+        m_isEndOfFile = true;
+        m_errorCode = -result;
+      }
+      if(!(flags & IORING_CQE_F_MORE)) {
+        m_isReceiving = false;
+        reference = std::move(m_receiveReference);
+      }
+      m_receiveCondition.notify_all();
+    }
+  };
+}
+
+#endif
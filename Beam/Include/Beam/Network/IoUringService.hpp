@@ -0,0 +1,532 @@
+#ifndef BEAM_IO_URING_SERVICE_HPP
+#define BEAM_IO_URING_SERVICE_HPP
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/throw_exception.hpp>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include "Beam/Network/Network.hpp"
+#include "Beam/Network/SocketException.hpp"
+#include "Beam/Utilities/Singleton.hpp"
+
+#ifndef BEAM_IO_URING_QUEUE_SIZE
+  #define BEAM_IO_URING_QUEUE_SIZE 4096
+#endif
+
+namespace Beam::Network {
+
+  /**
+   * Owns the io_uring instance shared by all io_uring sockets along with the
+   * thread dispatching its completions. Submissions made concurrently are
+   * combined into a single system call.
+   */
+  class IoUringService : public Singleton<IoUringService> {
+    public:
+
+      /** The base class of an operation awaiting its completion. */
+      struct Operation {
+        virtual ~Operation() = default;
+
+        /**
+         * Called by the completion thread once the operation completes.
+         * @param result The operation's result, a negated errno on failure.
+         * @param flags The completion's IORING_CQE_F_* flags.
+         */
+        virtual void Complete(int result, std::uint32_t flags) = 0;
+      };
+
+      /**
+       * Returns <code>true</code> iff the running kernel supports the io_uring
+       * operations used by the io_uring sockets, including multishot receives
+       * and canceling by file descriptor. The kernel is probed once and the
+       * result is cached, callers should fall back to the asio sockets when
+       * this returns <code>false</code>.
+       */
+      static bool IsAvailable();
+
+      ~IoUringService();
+
+      /**
+       * Submits an operation.
+       * @param operation The operation to notify upon completion, or
+       *        <code>nullptr</code> to discard the completion.
+       * @param prepare Fills in the submission queue entry.
+       */
+      template<typename F>
+      void Submit(Operation* operation, F&& prepare);
+
+      /**
+       * Cancels all pending operations on a file descriptor.
+       * @param fd The file descriptor whose operations are canceled.
+       */
+      void Cancel(int fd);
+
+      /**
+       * Queues an operation without submitting it, it is submitted along with
+       * the next call to Submit.
+       * @param operation The operation to notify upon completion, or
+       *        <code>nullptr</code> to discard the completion.
+       * @param prepare Fills in the submission queue entry.
+       */
+      template<typename F>
+      void Queue(Operation* operation, F&& prepare);
+
+      /** Returns an unused id for a group of provided buffers. */
+      std::uint16_t AllocateBufferGroup();
+
+      /**
+       * Releases a group of provided buffers, removing any buffers the kernel
+       * still holds.
+       * @param group The id of the buffer group to release.
+       * @param count The maximum number of buffers in the group.
+       */
+      void ReleaseBufferGroup(std::uint16_t group, std::uint32_t count);
+
+    private:
+      friend class Singleton<IoUringService>;
+      struct ProbeOperation;
+      int m_fd;
+      void* m_submissionRing;
+      std::size_t m_submissionRingSize;
+      void* m_completionRing;
+      std::size_t m_completionRingSize;
+      io_uring_sqe* m_entries;
+      std::size_t m_entriesSize;
+      unsigned* m_submissionHead;
+      unsigned* m_submissionTail;
+      unsigned m_submissionMask;
+      unsigned m_submissionCount;
+      unsigned* m_completionHead;
+      unsigned* m_completionTail;
+      unsigned m_completionMask;
+      io_uring_cqe* m_completions;
+      boost::mutex m_mutex;
+      unsigned m_pendingCount;
+      bool m_isSubmitting;
+      std::vector<std::uint16_t> m_availableGroups;
+      std::uint16_t m_nextGroup;
+      std::atomic_bool m_isClosing;
+      std::thread m_completionThread;
+
+      IoUringService();
+      IoUringService(const IoUringService&) = delete;
+      IoUringService& operator =(const IoUringService&) = delete;
+      static bool HasSupportedOperations();
+      static bool HasSupportedFlags();
+      [[noreturn]] static void ThrowError(int code);
+      template<typename F>
+      void Push(boost::unique_lock<boost::mutex>& lock, Operation* operation,
+        F&& prepare);
+      void Flush(boost::unique_lock<boost::mutex>& lock);
+      void Fail(boost::unique_lock<boost::mutex>& lock, int code);
+      void Run();
+  };
+
+  struct IoUringService::ProbeOperation final : Operation {
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::deque<std::pair<int, std::uint32_t>> m_completions;
+
+    void Complete(int result, std::uint32_t flags) override {
+      auto lock = std::lock_guard(m_mutex);
+      m_completions.emplace_back(result, flags);
+      m_condition.notify_all();
+    }
+
+    std::pair<int, std::uint32_t> Wait() {
+      auto lock = std::unique_lock(m_mutex);
+      m_condition.wait(lock, [&] {
+        return !m_completions.empty();
+      });
+      auto completion = m_completions.front();
+      m_completions.pop_front();
+      return completion;
+    }
+  };
+
+  inline bool IoUringService::IsAvailable() {
+    static const auto isAvailable = [] {
+      if(!HasSupportedOperations()) {
+        return false;
+      }
+      try {
+        return HasSupportedFlags();
+      } catch(const std::exception&) {
+        return false;
+      }
+    }();
+    return isAvailable;
+  }
+
+  inline IoUringService::~IoUringService() {
+    m_isClosing = true;
+    Submit(nullptr, [] (auto& entry) {
+      entry.opcode = IORING_OP_NOP;
+    });
+    m_completionThread.join();
+    ::munmap(m_entries, m_entriesSize);
+    if(m_completionRing != m_submissionRing) {
+      ::munmap(m_completionRing, m_completionRingSize);
+    }
+    ::munmap(m_submissionRing, m_submissionRingSize);
+    ::close(m_fd);
+  }
+
+  template<typename F>
+  void IoUringService::Submit(Operation* operation, F&& prepare) {
+    auto lock = boost::unique_lock(m_mutex);
+    Push(lock, operation, std::forward<F>(prepare));
+    if(!m_isSubmitting) {
+      Flush(lock);
+    }
+  }
+
+  template<typename F>
+  void IoUringService::Queue(Operation* operation, F&& prepare) {
+    auto lock = boost::unique_lock(m_mutex);
+    Push(lock, operation, std::forward<F>(prepare));
+  }
+
+  inline void IoUringService::Cancel(int fd) {
+    Submit(nullptr, [&] (auto& entry) {
+      entry.opcode = IORING_OP_ASYNC_CANCEL;
+      entry.fd = fd;
+      entry.cancel_flags = IORING_ASYNC_CANCEL_FD | IORING_ASYNC_CANCEL_ALL;
+    });
+  }
+
+  inline std::uint16_t IoUringService::AllocateBufferGroup() {
+    auto lock = boost::lock_guard(m_mutex);
+    if(m_availableGroups.empty()) {
+      auto group = m_nextGroup;
+      ++m_nextGroup;
+      return group;
+    }
+    auto group = m_availableGroups.back();
+    m_availableGroups.pop_back();
+    return group;
+  }
+
+  inline void IoUringService::ReleaseBufferGroup(std::uint16_t group,
+      std::uint32_t count) {
+
+    /* Entries are submitted in order, so the removal is processed before any
+       buffers provided by the group's next owner. */
+    Submit(nullptr, [&] (auto& entry) {
+      entry.opcode = IORING_OP_REMOVE_BUFFERS;
+      entry.fd = static_cast<int>(count);
+      entry.buf_group = group;
+    });
+    auto lock = boost::lock_guard(m_mutex);
+    m_availableGroups.push_back(group);
+  }
+
+  inline IoUringService::IoUringService()
+      : m_pendingCount(0),
+        m_isSubmitting(false),
+        m_nextGroup(0),
+        m_isClosing(false) {
+    auto parameters = io_uring_params();
+    parameters.flags = IORING_SETUP_CLAMP;
+    m_fd = static_cast<int>(::syscall(__NR_io_uring_setup,
+      BEAM_IO_URING_QUEUE_SIZE, &parameters));
+    if(m_fd < 0) {
+      ThrowError(errno);
+    }
+    m_submissionRingSize =
+      parameters.sq_off.array + parameters.sq_entries * sizeof(unsigned);
+    m_completionRingSize =
+      parameters.cq_off.cqes + parameters.cq_entries * sizeof(io_uring_cqe);
+    auto isSingleMap = (parameters.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if(isSingleMap) {
+      m_submissionRingSize =
+        std::max(m_submissionRingSize, m_completionRingSize);
+    }
+    m_submissionRing = ::mmap(nullptr, m_submissionRingSize,
+      PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd,
+      IORING_OFF_SQ_RING);
+    if(m_submissionRing == MAP_FAILED) {
+      auto code = errno;
+      ::close(m_fd);
+      ThrowError(code);
+    }
+    if(isSingleMap) {
+      m_completionRing = m_submissionRing;
+    } else {
+      m_completionRing = ::mmap(nullptr, m_completionRingSize,
+        PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd,
+        IORING_OFF_CQ_RING);
+      if(m_completionRing == MAP_FAILED) {
+        auto code = errno;
+        ::munmap(m_submissionRing, m_submissionRingSize);
+        ::close(m_fd);
+        ThrowError(code);
+      }
+    }
+    m_entriesSize = parameters.sq_entries * sizeof(io_uring_sqe);
+    m_entries = static_cast<io_uring_sqe*>(::mmap(nullptr, m_entriesSize,
+      PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd,
+      IORING_OFF_SQES));
+    if(m_entries == MAP_FAILED) {
+      auto code = errno;
+      if(m_completionRing != m_submissionRing) {
+        ::munmap(m_completionRing, m_completionRingSize);
+      }
+      ::munmap(m_submissionRing, m_submissionRingSize);
+      ::close(m_fd);
+      ThrowError(code);
+    }
+    auto submissionRing = static_cast<char*>(m_submissionRing);
+    m_submissionHead =
+      reinterpret_cast<unsigned*>(submissionRing + parameters.sq_off.head);
+    m_submissionTail =
+      reinterpret_cast<unsigned*>(submissionRing + parameters.sq_off.tail);
+    m_submissionMask = *reinterpret_cast<unsigned*>(
+      submissionRing + parameters.sq_off.ring_mask);
+    m_submissionCount = parameters.sq_entries;
+
+    /* Entries are always submitted in order, so the index array maps each
+       slot to itself once up front. */
+    auto array =
+      reinterpret_cast<unsigned*>(submissionRing + parameters.sq_off.array);
+    for(auto i = unsigned(0); i != parameters.sq_entries; ++i) {
+      array[i] = i;
+    }
+    auto completionRing = static_cast<char*>(m_completionRing);
+    m_completionHead =
+      reinterpret_cast<unsigned*>(completionRing + parameters.cq_off.head);
+    m_completionTail =
+      reinterpret_cast<unsigned*>(completionRing + parameters.cq_off.tail);
+    m_completionMask = *reinterpret_cast<unsigned*>(
+      completionRing + parameters.cq_off.ring_mask);
+    m_completions =
+      reinterpret_cast<io_uring_cqe*>(completionRing + parameters.cq_off.cqes);
+    m_completionThread = std::thread([=] {
+      Run();
+    });
+  }
+
+  inline bool IoUringService::HasSupportedOperations() {
+    auto parameters = io_uring_params();
+    auto fd = static_cast<int>(::syscall(__NR_io_uring_setup, 1, &parameters));
+    if(fd < 0) {
+      return false;
+    }
+    const auto OPERATION_COUNT = 256;
+    auto probe = std::vector<char>(sizeof(io_uring_probe) +
+      OPERATION_COUNT * sizeof(io_uring_probe_op));
+    auto header = reinterpret_cast<io_uring_probe*>(probe.data());
+    auto result = ::syscall(__NR_io_uring_register, fd, IORING_REGISTER_PROBE,
+      header, OPERATION_COUNT);
+    ::close(fd);
+    if(result < 0) {
+      return false;
+    }
+    for(auto operation : {IORING_OP_ACCEPT, IORING_OP_ASYNC_CANCEL,
+        IORING_OP_CONNECT, IORING_OP_NOP, IORING_OP_PROVIDE_BUFFERS,
+        IORING_OP_RECV, IORING_OP_REMOVE_BUFFERS, IORING_OP_SEND,
+        IORING_OP_SENDMSG}) {
+      if(operation > header->last_op ||
+          !(header->ops[operation].flags & IO_URING_OP_SUPPORTED)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  inline bool IoUringService::HasSupportedFlags() {
+
+    /* The opcode probe doesn't cover flags, multishot receives need Linux 6.0
+       and canceling by file descriptor needs 5.19, so both are exercised on a
+       socket pair. Older kernels fail them with EINVAL. */
+    auto sockets = std::array<int, 2>();
+    if(::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets.data()) != 0) {
+      return false;
+    }
+    auto& service = GetInstance();
+    auto group = service.AllocateBufferGroup();
+    static char buffer[16];
+    auto provide = ProbeOperation();
+    service.Submit(&provide, [&] (auto& entry) {
+      entry.opcode = IORING_OP_PROVIDE_BUFFERS;
+      entry.fd = 1;
+      entry.addr = reinterpret_cast<std::uint64_t>(buffer);
+      entry.len = sizeof(buffer);
+      entry.buf_group = group;
+    });
+    auto isSupported = provide.Wait().first >= 0;
+    if(isSupported) {
+      auto receive = ProbeOperation();
+      service.Submit(&receive, [&] (auto& entry) {
+        entry.opcode = IORING_OP_RECV;
+        entry.fd = sockets[0];
+        entry.ioprio = IORING_RECV_MULTISHOT;
+        entry.flags = IOSQE_BUFFER_SELECT;
+        entry.buf_group = group;
+      });
+      auto data = char(0);
+      ::send(sockets[1], &data, sizeof(data), 0);
+      auto completion = receive.Wait();
+      isSupported = completion.first == sizeof(data) &&
+        (completion.second & IORING_CQE_F_MORE);
+      if(completion.second & IORING_CQE_F_MORE) {
+        auto cancel = ProbeOperation();
+        service.Submit(&cancel, [&] (auto& entry) {
+          entry.opcode = IORING_OP_ASYNC_CANCEL;
+          entry.fd = sockets[0];
+          entry.cancel_flags =
+            IORING_ASYNC_CANCEL_FD | IORING_ASYNC_CANCEL_ALL;
+        });
+        if(cancel.Wait().first < 0) {
+          isSupported = false;
+          service.Submit(&cancel, [&] (auto& entry) {
+            entry.opcode = IORING_OP_ASYNC_CANCEL;
+            entry.addr = reinterpret_cast<std::uint64_t>(
+              static_cast<Operation*>(&receive));
+          });
+          cancel.Wait();
+        }
+        while(receive.Wait().second & IORING_CQE_F_MORE) {}
+      }
+    }
+    service.ReleaseBufferGroup(group, 1);
+    ::close(sockets[0]);
+    ::close(sockets[1]);
+    return isSupported;
+  }
+
+  inline void IoUringService::ThrowError(int code) {
+    BOOST_THROW_EXCEPTION(SocketException(code, std::strerror(code)));
+  }
+
+  template<typename F>
+  void IoUringService::Push(boost::unique_lock<boost::mutex>& lock,
+      Operation* operation, F&& prepare) {
+    auto tail = *m_submissionTail;
+    while(tail - __atomic_load_n(m_submissionHead, __ATOMIC_ACQUIRE) ==
+        m_submissionCount) {
+      if(m_isSubmitting) {
+        lock.unlock();
+        std::this_thread::yield();
+        lock.lock();
+      } else {
+        Flush(lock);
+      }
+      tail = *m_submissionTail;
+    }
+    auto& entry = m_entries[tail & m_submissionMask];
+    std::memset(&entry, 0, sizeof(entry));
+    prepare(entry);
+    entry.user_data = reinterpret_cast<std::uint64_t>(operation);
+    __atomic_store_n(m_submissionTail, tail + 1, __ATOMIC_RELEASE);
+    ++m_pendingCount;
+  }
+
+  inline void IoUringService::Flush(boost::unique_lock<boost::mutex>& lock) {
+
+    /* Entries queued by other threads while the system call is in progress
+       are picked up by the next iteration rather than by another call. */
+    m_isSubmitting = true;
+    while(m_pendingCount != 0) {
+      auto count = m_pendingCount;
+      m_pendingCount = 0;
+      lock.unlock();
+      auto result = long();
+      auto code = 0;
+      do {
+        result = ::syscall(__NR_io_uring_enter, m_fd, count, 0, 0, nullptr, 0);
+        code = errno;
+      } while(result < 0 && code == EINTR);
+      lock.lock();
+      if(result < 0) {
+        if(code == EAGAIN || code == EBUSY || code == ENOMEM) {
+
+          /* The entries are still in the submission ring, they are retried
+             once the completion thread has made room. */
+          m_pendingCount += count;
+          lock.unlock();
+          std::this_thread::sleep_for(std::chrono::microseconds(50));
+          lock.lock();
+          continue;
+        }
+        Fail(lock, code);
+        continue;
+      } else if(static_cast<unsigned>(result) < count) {
+        m_pendingCount += count - static_cast<unsigned>(result);
+        if(result == 0) {
+          lock.unlock();
+          std::this_thread::yield();
+          lock.lock();
+        }
+      }
+    }
+    m_isSubmitting = false;
+  }
+
+  inline void IoUringService::Fail(boost::unique_lock<boost::mutex>& lock,
+      int code) {
+
+    /* The kernel has not consumed the unsubmitted entries, so they are
+       withdrawn from the ring and their operations complete with the error
+       outside of the lock, since completions may submit further entries. */
+    auto operations = std::vector<Operation*>();
+    auto head = __atomic_load_n(m_submissionHead, __ATOMIC_ACQUIRE);
+    auto tail = *m_submissionTail;
+    for(auto i = head; i != tail; ++i) {
+      if(auto operation = reinterpret_cast<Operation*>(
+          m_entries[i & m_submissionMask].user_data)) {
+        operations.push_back(operation);
+      }
+    }
+    __atomic_store_n(m_submissionTail, head, __ATOMIC_RELEASE);
+    m_pendingCount = 0;
+    lock.unlock();
+    for(auto operation : operations) {
+      operation->Complete(-code, 0);
+    }
+    lock.lock();
+  }
+
+  inline void IoUringService::Run() {
+    while(true) {
+      auto head = *m_completionHead;
+      auto tail = __atomic_load_n(m_completionTail, __ATOMIC_ACQUIRE);
+      if(head == tail) {
+        if(m_isClosing) {
+          return;
+        }
+        ::syscall(__NR_io_uring_enter, m_fd, 0, 1, IORING_ENTER_GETEVENTS,
+          nullptr, 0);
+        continue;
+      }
+      while(head != tail) {
+        auto completion = m_completions[head & m_completionMask];
+        ++head;
+        __atomic_store_n(m_completionHead, head, __ATOMIC_RELEASE);
+        if(auto operation =
+            reinterpret_cast<Operation*>(completion.user_data)) {
+          operation->Complete(completion.res, completion.flags);
+        }
+      }
+    }
+  }
+}
+
+#endif
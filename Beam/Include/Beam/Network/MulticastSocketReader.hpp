@@ -1,6 +1,7 @@
 #ifndef BEAM_MULTICAST_SOCKET_READER_HPP
 #define BEAM_MULTICAST_SOCKET_READER_HPP
 #include "Beam/IO/Reader.hpp"
+#include "Beam/Network/DatagramBatch.hpp"
 #include "Beam/Network/MulticastSocket.hpp"
 #include "Beam/Network/Network.hpp"
 #include "Beam/Network/UdpSocketReceiver.hpp"
@@ -21,6 +22,13 @@ namespace Network {
       template<typename Buffer>
       std::size_t Read(Out<Buffer> destination, std::size_t size);
 
+      /**
+       * Reads as many datagrams as are available in a single system call.
+       * @param batch Replaced with the datagrams read.
+       * @return The number of datagrams read.
+       */
+      std::size_t ReadBatch(Out<DatagramBatch> batch);
+
     private:
       friend class MulticastSocketChannel;
       std::shared_ptr<MulticastSocket> m_socket;
@@ -60,6 +68,11 @@ namespace Network {
       Store(m_destination));
   }
 
+  inline std::size_t MulticastSocketReader::ReadBatch(
+      Out<DatagramBatch> batch) {
+    return m_socket->GetReceiver().Receive(Store(batch));
+  }
+
   inline MulticastSocketReader::MulticastSocketReader(
     std::shared_ptr<MulticastSocket> socket, IpAddress destination)
     : m_socket(std::move(socket)),
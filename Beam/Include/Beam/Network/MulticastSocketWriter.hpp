@@ -2,6 +2,7 @@
 #define BEAM_MULTICAST_SOCKET_WRITER_HPP
 #include "Beam/IO/SharedBuffer.hpp"
 #include "Beam/IO/Writer.hpp"
+#include "Beam/Network/DatagramBatch.hpp"
 #include "Beam/Network/MulticastSocket.hpp"
 #include "Beam/Network/UdpSocketSender.hpp"
 
@@ -18,6 +19,13 @@ namespace Network {
       template<typename BufferType>
       void Write(const BufferType& data);
 
+      /**
+       * Writes a batch of datagrams in as few system calls as possible, each
+       * datagram is sent to the destination it was added with.
+       * @param batch The datagrams to write.
+       */
+      void WriteBatch(const DatagramBatch& batch);
+
     private:
       friend class MulticastSocketChannel;
       std::shared_ptr<MulticastSocket> m_socket;
@@ -38,6 +46,10 @@ namespace Network {
     Write(data.GetData(), data.GetSize());
   }
 
+  inline void MulticastSocketWriter::WriteBatch(const DatagramBatch& batch) {
+    m_socket->GetSender().Send(batch);
+  }
+
   inline MulticastSocketWriter::MulticastSocketWriter(
     std::shared_ptr<MulticastSocket> socket, IpAddress destination)
     : m_socket(std::move(socket)),
@@ -2,13 +2,19 @@
 #define BEAM_NETWORK_HPP
 
 namespace Beam::Network {
+  class DatagramBatch;
   template<typename B> class DatagramPacket;
+  class IoUringService;
   class IpAddress;
   class MulticastSocket;
   class MulticastSocketChannel;
   class MulticastSocketConnection;
   class MulticastSocketReader;
   class MulticastSocketWriter;
+  class SecureContextFactory;
+  class SecureHandshakeCounters;
+  class SecureServerSocket;
+  class SecureSessionCache;
   class SecureSocketChannel;
   class SecureSocketConnection;
   struct SecureSocketOptions;
@@ -30,6 +36,11 @@ namespace Beam::Network {
   class UdpSocketReceiver;
   class UdpSocketSender;
   class UdpSocketWriter;
+  class UringServerSocket;
+  class UringSocketChannel;
+  class UringSocketConnection;
+  class UringSocketReader;
+  class UringSocketWriter;
 }
 
 #endif
@@ -1,6 +1,7 @@
 #ifndef BEAM_NETWORK_DETAILS_HPP
 #define BEAM_NETWORK_DETAILS_HPP
 #include <memory>
+#include <string>
 #include <utility>
 #include <boost/asio/io_service.hpp>
 #include <boost/asio/ssl.hpp>
@@ -8,6 +9,8 @@
 #include <boost/asio/ip/udp.hpp>
 #include "Beam/IO/EndOfFileException.hpp"
 #include "Beam/Network/Network.hpp"
+#include "Beam/Network/SocketException.hpp"
+#include "Beam/Routines/Async.hpp"
 #include "Beam/Threading/ConditionVariable.hpp"
 #include "Beam/Threading/Mutex.hpp"
 
@@ -71,6 +74,26 @@ namespace Beam::Network::Details {
         m_isPendingCondition.notify_all();
       }
     }
+
+    /** Suspends until the socket is ready to be read from or written to. */
+    void Wait(boost::asio::socket_base::wait_type type) {
+      auto waitResult = Routines::Async<void>();
+      {
+        auto lock = std::lock_guard(m_mutex);
+        if(!m_isOpen) {
+          BOOST_THROW_EXCEPTION(IO::EndOfFileException());
+        }
+        m_socket.async_wait(type, [&] (const auto& error) {
+          if(error) {
+            waitResult.GetEval().SetException(SocketException(error.value(),
+              error.message()));
+          } else {
+            waitResult.GetEval().SetResult();
+          }
+        });
+      }
+      waitResult.Get();
+    }
   };
 
 
@@ -78,7 +101,8 @@ namespace Beam::Network::Details {
     using Socket = boost::asio::ssl::stream<boost::asio::ip::tcp::socket>;
     Threading::Mutex m_mutex;
     boost::asio::io_service* m_ioService;
-    boost::asio::ssl::context m_context;
+    std::shared_ptr<boost::asio::ssl::context> m_context;
+    std::string m_sessionKey;
     Socket m_socket;
     bool m_isOpen;
     bool m_isReadPending;
@@ -86,10 +110,11 @@ namespace Beam::Network::Details {
     Threading::ConditionVariable m_isPendingCondition;
 
     template<typename... Args>
-    SecureSocketEntry(boost::asio::io_service& ioService, Args&&... args)
+    SecureSocketEntry(std::shared_ptr<boost::asio::ssl::context> context,
+      boost::asio::io_service& ioService, Args&&... args)
       : m_ioService(&ioService),
-        m_context(boost::asio::ssl::context::sslv23),
-        m_socket(std::forward<Args>(args)..., m_context),
+        m_context(std::move(context)),
+        m_socket(std::forward<Args>(args)..., *m_context),
         m_isOpen(false),
         m_isReadPending(false),
         m_pendingWrites(0) {}
@@ -0,0 +1,139 @@
+#ifndef BEAM_SECURE_CONTEXT_FACTORY_HPP
+#define BEAM_SECURE_CONTEXT_FACTORY_HPP
+#include <cstring>
+#include <memory>
+#include <string>
+#include <boost/asio/ssl.hpp>
+#include "Beam/Network/Network.hpp"
+#include "Beam/Network/SecureHandshakeCounters.hpp"
+#include "Beam/Network/SecureSessionCache.hpp"
+#include "Beam/Utilities/Singleton.hpp"
+
+namespace Beam::Network {
+
+  /**
+   * Builds the TLS contexts shared by secure sockets. Clients share a single
+   * context whose sessions are cached by endpoint, and each server shares one
+   * context across all of its connections so that its session tickets can be
+   * resumed by any of them.
+   */
+  class SecureContextFactory : public Singleton<SecureContextFactory> {
+    public:
+
+      /** Returns the context shared by all client sockets. */
+      const std::shared_ptr<boost::asio::ssl::context>&
+        GetClientContext() const;
+
+      /**
+       * Makes a context for a server socket with session tickets enabled.
+       * @param certificateChain The PEM encoded certificate chain.
+       * @param privateKey The PEM encoded private key.
+       */
+      std::shared_ptr<boost::asio::ssl::context> MakeServerContext(
+        const std::string& certificateChain,
+        const std::string& privateKey) const;
+
+      /** Returns the cache of client sessions. */
+      SecureSessionCache& GetSessionCache();
+
+      /** Returns the counters for handshakes performed by clients. */
+      SecureHandshakeCounters& GetClientCounters();
+
+      /** Returns the counters for handshakes performed by servers. */
+      SecureHandshakeCounters& GetServerCounters();
+
+      /**
+       * Prepares a client connection to resume the session stored for its
+       * endpoint and to store any session it negotiates.
+       * @param ssl The connection about to perform its handshake.
+       * @param key The endpoint's key, must outlive the connection.
+       * @return <code>true</code> iff a session was offered for resumption.
+       */
+      bool PrepareClient(SSL* ssl, const std::string& key);
+
+    private:
+      friend class Singleton<SecureContextFactory>;
+      static constexpr auto SESSION_ID_CONTEXT = "Beam";
+      int m_keyIndex;
+      SecureSessionCache m_sessionCache;
+      SecureHandshakeCounters m_clientCounters;
+      SecureHandshakeCounters m_serverCounters;
+      std::shared_ptr<boost::asio::ssl::context> m_clientContext;
+
+      SecureContextFactory();
+      static int OnNewSession(SSL* ssl, SSL_SESSION* session);
+  };
+
+  inline const std::shared_ptr<boost::asio::ssl::context>&
+      SecureContextFactory::GetClientContext() const {
+    return m_clientContext;
+  }
+
+  inline std::shared_ptr<boost::asio::ssl::context>
+      SecureContextFactory::MakeServerContext(
+        const std::string& certificateChain,
+        const std::string& privateKey) const {
+    auto context = std::make_shared<boost::asio::ssl::context>(
+      boost::asio::ssl::context::sslv23);
+    context->use_certificate_chain(
+      boost::asio::buffer(certificateChain.data(), certificateChain.size()));
+    context->use_private_key(
+      boost::asio::buffer(privateKey.data(), privateKey.size()),
+      boost::asio::ssl::context::pem);
+    auto handle = context->native_handle();
+    SSL_CTX_set_session_cache_mode(handle, SSL_SESS_CACHE_SERVER);
+    SSL_CTX_set_session_id_context(handle,
+      reinterpret_cast<const unsigned char*>(SESSION_ID_CONTEXT),
+      static_cast<unsigned int>(std::strlen(SESSION_ID_CONTEXT)));
+    SSL_CTX_clear_options(handle, SSL_OP_NO_TICKET);
+    return context;
+  }
+
+  inline SecureSessionCache& SecureContextFactory::GetSessionCache() {
+    return m_sessionCache;
+  }
+
+  inline SecureHandshakeCounters& SecureContextFactory::GetClientCounters() {
+    return m_clientCounters;
+  }
+
+  inline SecureHandshakeCounters& SecureContextFactory::GetServerCounters() {
+    return m_serverCounters;
+  }
+
+  inline bool SecureContextFactory::PrepareClient(SSL* ssl,
+      const std::string& key) {
+    SSL_set_ex_data(ssl, m_keyIndex, const_cast<std::string*>(&key));
+    return m_sessionCache.Load(key, ssl);
+  }
+
+  inline SecureContextFactory::SecureContextFactory()
+      : m_keyIndex(SSL_get_ex_new_index(0, nullptr, nullptr, nullptr,
+          nullptr)),
+        m_clientContext(std::make_shared<boost::asio::ssl::context>(
+          boost::asio::ssl::context::sslv23)) {
+
+    /* Sessions are stored by endpoint rather than by OpenSSL's internal
+       cache, which is keyed by session id and unusable by clients. Under
+       TLS 1.3 the session arrives after the handshake, so it is captured
+       through the callback rather than read back once connected. */
+    auto handle = m_clientContext->native_handle();
+    SSL_CTX_set_session_cache_mode(handle,
+      SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+    SSL_CTX_sess_set_new_cb(handle, &SecureContextFactory::OnNewSession);
+  }
+
+  inline int SecureContextFactory::OnNewSession(SSL* ssl,
+      SSL_SESSION* session) {
+    auto& factory = GetInstance();
+    auto key = static_cast<const std::string*>(
+      SSL_get_ex_data(ssl, factory.m_keyIndex));
+    if(!key) {
+      return 0;
+    }
+    factory.m_sessionCache.Store(*key, session);
+    return 0;
+  }
+}
+
+#endif
@@ -0,0 +1,85 @@
+#ifndef BEAM_SECURE_HANDSHAKE_COUNTERS_HPP
+#define BEAM_SECURE_HANDSHAKE_COUNTERS_HPP
+#include <atomic>
+#include <cstdint>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include "Beam/Network/Network.hpp"
+
+namespace Beam::Network {
+
+  /** Counts TLS handshakes and the time spent performing them. */
+  class SecureHandshakeCounters {
+    public:
+
+      /** Constructs SecureHandshakeCounters with every count at zero. */
+      SecureHandshakeCounters();
+
+      /** Returns the number of handshakes that negotiated a new session. */
+      std::int64_t GetFullHandshakeCount() const;
+
+      /** Returns the number of handshakes that resumed a prior session. */
+      std::int64_t GetResumedHandshakeCount() const;
+
+      /** Returns the total time spent in full handshakes. */
+      boost::posix_time::time_duration GetFullHandshakeTime() const;
+
+      /** Returns the total time spent in resumed handshakes. */
+      boost::posix_time::time_duration GetResumedHandshakeTime() const;
+
+      /**
+       * Records a completed handshake.
+       * @param isResumed Whether the handshake resumed a prior session.
+       * @param time The time taken by the handshake.
+       */
+      void Record(bool isResumed, boost::posix_time::time_duration time);
+
+    private:
+      std::atomic<std::int64_t> m_fullHandshakeCount;
+      std::atomic<std::int64_t> m_resumedHandshakeCount;
+      std::atomic<std::int64_t> m_fullHandshakeMicroseconds;
+      std::atomic<std::int64_t> m_resumedHandshakeMicroseconds;
+
+      SecureHandshakeCounters(const SecureHandshakeCounters&) = delete;
+      SecureHandshakeCounters& operator =(
+        const SecureHandshakeCounters&) = delete;
+  };
+
+  inline SecureHandshakeCounters::SecureHandshakeCounters()
+    : m_fullHandshakeCount(0),
+      m_resumedHandshakeCount(0),
+      m_fullHandshakeMicroseconds(0),
+      m_resumedHandshakeMicroseconds(0) {}
+
+  inline std::int64_t SecureHandshakeCounters::GetFullHandshakeCount() const {
+    return m_fullHandshakeCount;
+  }
+
+  inline std::int64_t
+      SecureHandshakeCounters::GetResumedHandshakeCount() const {
+    return m_resumedHandshakeCount;
+  }
+
+  inline boost::posix_time::time_duration
+      SecureHandshakeCounters::GetFullHandshakeTime() const {
+    return boost::posix_time::microseconds(m_fullHandshakeMicroseconds.load());
+  }
+
+  inline boost::posix_time::time_duration
+      SecureHandshakeCounters::GetResumedHandshakeTime() const {
+    return boost::posix_time::microseconds(
+      m_resumedHandshakeMicroseconds.load());
+  }
+
+  inline void SecureHandshakeCounters::Record(bool isResumed,
+      boost::posix_time::time_duration time) {
+    if(isResumed) {
+      ++m_resumedHandshakeCount;
+      m_resumedHandshakeMicroseconds += time.total_microseconds();
+    } else {
+      ++m_fullHandshakeCount;
+      m_fullHandshakeMicroseconds += time.total_microseconds();
+    }
+  }
+}
+
+#endif
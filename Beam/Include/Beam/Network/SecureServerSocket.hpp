@@ -0,0 +1,151 @@
+#ifndef BEAM_SECURE_SERVER_SOCKET_HPP
+#define BEAM_SECURE_SERVER_SOCKET_HPP
+#include <string>
+#include <boost/optional/optional.hpp>
+#include "Beam/IO/ConnectException.hpp"
+#include "Beam/IO/EndOfFileException.hpp"
+#include "Beam/IO/OpenState.hpp"
+#include "Beam/IO/ServerConnection.hpp"
+#include "Beam/Network/Network.hpp"
+#include "Beam/Network/SecureContextFactory.hpp"
+#include "Beam/Network/SecureSocketChannel.hpp"
+#include "Beam/Network/SocketException.hpp"
+#include "Beam/Threading/ServiceThreadPool.hpp"
+
+namespace Beam {
+namespace Network {
+
+  /**
+   * Implements a server socket accepting SSL connections over TCP. All
+   * accepted connections share a single context so that clients can resume
+   * sessions negotiated with any of them.
+   */
+  class SecureServerSocket {
+    public:
+      using Channel = SecureSocketChannel;
+
+      /**
+       * Constructs a SecureServerSocket.
+       * @param interface The interface to bind to.
+       * @param context The context to use, typically built by the
+       *        SecureContextFactory.
+       */
+      SecureServerSocket(const IpAddress& interface,
+        std::shared_ptr<boost::asio::ssl::context> context);
+
+      /**
+       * Constructs a SecureServerSocket.
+       * @param interface The interface to bind to.
+       * @param context The context to use, typically built by the
+       *        SecureContextFactory.
+       * @param options The set of SecureSocketOptions to apply.
+       */
+      SecureServerSocket(const IpAddress& interface,
+        std::shared_ptr<boost::asio::ssl::context> context,
+        const SecureSocketOptions& options);
+
+      ~SecureServerSocket();
+
+      std::unique_ptr<Channel> Accept();
+
+      void Close();
+
+    private:
+      std::shared_ptr<boost::asio::ssl::context> m_context;
+      SecureSocketOptions m_options;
+      boost::asio::io_service* m_ioService;
+      boost::optional<boost::asio::ip::tcp::acceptor> m_acceptor;
+      IO::OpenState m_openState;
+
+      SecureServerSocket(const SecureServerSocket&) = delete;
+      SecureServerSocket& operator =(const SecureServerSocket&) = delete;
+  };
+
+  inline SecureServerSocket::SecureServerSocket(const IpAddress& interface,
+    std::shared_ptr<boost::asio::ssl::context> context)
+    : SecureServerSocket(interface, std::move(context),
+        SecureSocketOptions()) {}
+
+  inline SecureServerSocket::SecureServerSocket(const IpAddress& interface,
+      std::shared_ptr<boost::asio::ssl::context> context,
+      const SecureSocketOptions& options)
+      : m_context(std::move(context)),
+        m_options(options),
+        m_ioService(&Threading::ServiceThreadPool::GetInstance().GetService()) {
+    try {
+      auto resolver = boost::asio::ip::tcp::resolver(*m_ioService);
+      auto query = boost::asio::ip::tcp::resolver::query(interface.GetHost(),
+        std::to_string(interface.GetPort()));
+      auto error = boost::system::error_code();
+      auto endpointIterator = resolver.resolve(query, error);
+      if(error) {
+        BOOST_THROW_EXCEPTION(SocketException(error.value(), error.message()));
+      }
+      m_acceptor.emplace(*m_ioService, *endpointIterator);
+    } catch(const boost::system::system_error& e) {
+      Close();
+      try {
+        throw SocketException(e.code().value(), e.code().message());
+      } catch(const std::exception&) {
+        std::throw_with_nested(IO::ConnectException("Unable to open server."));
+      }
+    } catch(const std::exception&) {
+      Close();
+      std::throw_with_nested(IO::ConnectException("Unable to open server."));
+    }
+  }
+
+  inline SecureServerSocket::~SecureServerSocket() {
+    Close();
+  }
+
+  inline std::unique_ptr<typename SecureServerSocket::Channel>
+      SecureServerSocket::Accept() {
+    auto acceptAsync = Routines::Async<void>();
+    auto acceptEval = acceptAsync.GetEval();
+    auto channel = std::unique_ptr<Channel>(new SecureSocketChannel(m_context,
+      Threading::ServiceThreadPool::GetInstance().GetNextService()));
+    m_acceptor->async_accept(channel->m_socket->m_socket.lowest_layer(),
+      [&] (const auto& error) {
+        if(error) {
+          acceptEval.SetException(SocketException(error.value(),
+            error.message()));
+          return;
+        }
+        try {
+          auto& socket = channel->m_socket->m_socket.lowest_layer();
+          channel->SetAddress(IpAddress(
+            socket.remote_endpoint().address().to_string(),
+            socket.remote_endpoint().port()));
+          acceptEval.SetResult();
+        } catch(const std::exception&) {
+          acceptEval.SetException(std::current_exception());
+        }
+      });
+    try {
+      acceptAsync.Get();
+      channel->GetConnection().Accept(m_options);
+    } catch(const std::exception&) {
+      std::throw_with_nested(IO::EndOfFileException("Failed to accept."));
+    }
+    return channel;
+  }
+
+  inline void SecureServerSocket::Close() {
+    if(m_openState.SetClosing()) {
+      return;
+    }
+    if(m_acceptor) {
+      m_acceptor->close();
+    }
+    m_openState.Close();
+  }
+}
+
+  template<>
+  struct ImplementsConcept<Network::SecureServerSocket,
+    IO::ServerConnection<Network::SecureServerSocket::Channel>> :
+    std::true_type {};
+}
+
+#endif
@@ -0,0 +1,131 @@
+#ifndef BEAM_SECURE_SESSION_CACHE_HPP
+#define BEAM_SECURE_SESSION_CACHE_HPP
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <boost/thread/mutex.hpp>
+#include <openssl/ssl.h>
+#include "Beam/Network/Network.hpp"
+
+#ifndef BEAM_SECURE_SESSION_CACHE_SIZE
+  #define BEAM_SECURE_SESSION_CACHE_SIZE 1024
+#endif
+
+namespace Beam::Network {
+
+  /**
+   * Stores the most recent TLS session negotiated with each endpoint so that
+   * reconnecting clients can resume it rather than perform a full handshake.
+   */
+  class SecureSessionCache {
+    public:
+
+      /** Constructs a SecureSessionCache with the default capacity. */
+      SecureSessionCache();
+
+      /**
+       * Constructs a SecureSessionCache.
+       * @param capacity The maximum number of endpoints to store sessions for.
+       */
+      explicit SecureSessionCache(std::size_t capacity);
+
+      /** Returns the number of sessions stored. */
+      std::size_t GetSize() const;
+
+      /**
+       * Offers the session stored for an endpoint to a connection about to
+       * perform its handshake.
+       * @param key The endpoint's key.
+       * @param ssl The connection to resume the session with.
+       * @return <code>true</code> iff a resumable session was offered.
+       */
+      bool Load(const std::string& key, SSL* ssl) const;
+
+      /**
+       * Stores a session, replacing any prior session for the endpoint.
+       * @param key The endpoint's key.
+       * @param session The session to store, the cache keeps a copy of it.
+       */
+      void Store(const std::string& key, SSL_SESSION* session);
+
+      /**
+       * Removes the session stored for an endpoint.
+       * @param key The endpoint's key.
+       */
+      void Remove(const std::string& key);
+
+    private:
+      struct SessionDeleter {
+        void operator ()(SSL_SESSION* session) const;
+      };
+      mutable boost::mutex m_mutex;
+      std::size_t m_capacity;
+      std::unordered_map<std::string,
+        std::unique_ptr<SSL_SESSION, SessionDeleter>> m_sessions;
+
+      SecureSessionCache(const SecureSessionCache&) = delete;
+      SecureSessionCache& operator =(const SecureSessionCache&) = delete;
+  };
+
+  inline void SecureSessionCache::SessionDeleter::operator ()(
+      SSL_SESSION* session) const {
+    SSL_SESSION_free(session);
+  }
+
+  inline SecureSessionCache::SecureSessionCache()
+    : SecureSessionCache(BEAM_SECURE_SESSION_CACHE_SIZE) {}
+
+  inline SecureSessionCache::SecureSessionCache(std::size_t capacity)
+    : m_capacity(capacity) {}
+
+  inline std::size_t SecureSessionCache::GetSize() const {
+    auto lock = boost::lock_guard(m_mutex);
+    return m_sessions.size();
+  }
+
+  inline bool SecureSessionCache::Load(const std::string& key,
+      SSL* ssl) const {
+    auto lock = boost::lock_guard(m_mutex);
+    auto session = m_sessions.find(key);
+    if(session == m_sessions.end() ||
+        !SSL_SESSION_is_resumable(session->second.get())) {
+      return false;
+    }
+
+    /* OpenSSL marks a connection's session unresumable when the connection
+       ends without a close_notify, so each connection is handed its own
+       copy rather than the cached session. */
+    auto copy = std::unique_ptr<SSL_SESSION, SessionDeleter>(
+      SSL_SESSION_dup(session->second.get()));
+    return copy && SSL_set_session(ssl, copy.get()) == 1;
+  }
+
+  inline void SecureSessionCache::Store(const std::string& key,
+      SSL_SESSION* session) {
+    auto entry = std::unique_ptr<SSL_SESSION, SessionDeleter>(
+      SSL_SESSION_dup(session));
+    if(!entry) {
+      return;
+    }
+    auto lock = boost::lock_guard(m_mutex);
+    auto existing = m_sessions.find(key);
+    if(existing != m_sessions.end()) {
+      existing->second = std::move(entry);
+      return;
+    }
+    if(m_sessions.size() >= m_capacity) {
+      if(m_capacity == 0) {
+        return;
+      }
+      m_sessions.erase(m_sessions.begin());
+    }
+    m_sessions.emplace(key, std::move(entry));
+  }
+
+  inline void SecureSessionCache::Remove(const std::string& key) {
+    auto lock = boost::lock_guard(m_mutex);
+    m_sessions.erase(key);
+  }
+}
+
+#endif
@@ -4,6 +4,7 @@
 #include "Beam/IO/Channel.hpp"
 #include "Beam/Network/Network.hpp"
 #include "Beam/Network/NetworkDetails.hpp"
+#include "Beam/Network/SecureContextFactory.hpp"
 #include "Beam/Network/SecureSocketConnection.hpp"
 #include "Beam/Network/SecureSocketOptions.hpp"
 #include "Beam/Network/SecureSocketReader.hpp"
@@ -100,7 +101,8 @@ namespace Network {
       Reader m_reader;
       Writer m_writer;
 
-      SecureSocketChannel();
+      SecureSocketChannel(std::shared_ptr<boost::asio::ssl::context> context,
+        boost::asio::io_service& ioService);
       SecureSocketChannel(const SecureSocketChannel&) = delete;
       SecureSocketChannel& operator =(const SecureSocketChannel&) = delete;
       void SetAddress(const IpAddress& address);
@@ -129,6 +131,7 @@ namespace Network {
   inline SecureSocketChannel::SecureSocketChannel(
     const std::vector<IpAddress>& addresses, const SecureSocketOptions& options)
     : m_socket(std::make_shared<Details::SecureSocketEntry>(
+        SecureContextFactory::GetInstance().GetClientContext(),
         Threading::ServiceThreadPool::GetInstance().GetService(),
         Threading::ServiceThreadPool::GetInstance().GetService())),
       m_identifier(addresses.front()),
@@ -144,6 +147,7 @@ namespace Network {
     const std::vector<IpAddress>& addresses, const IpAddress& interface,
     const SecureSocketOptions& options)
     : m_socket(std::make_shared<Details::SecureSocketEntry>(
+        SecureContextFactory::GetInstance().GetClientContext(),
         Threading::ServiceThreadPool::GetInstance().GetService(),
         Threading::ServiceThreadPool::GetInstance().GetService())),
       m_identifier(addresses.front()),
@@ -168,10 +172,11 @@ namespace Network {
     return m_writer;
   }
 
-  inline SecureSocketChannel::SecureSocketChannel()
-    : m_socket(std::make_shared<Details::SecureSocketEntry>(
-        Threading::ServiceThreadPool::GetInstance().GetService(),
-        Threading::ServiceThreadPool::GetInstance().GetService())),
+  inline SecureSocketChannel::SecureSocketChannel(
+    std::shared_ptr<boost::asio::ssl::context> context,
+    boost::asio::io_service& ioService)
+    : m_socket(std::make_shared<Details::SecureSocketEntry>(std::move(context),
+        ioService, ioService)),
       m_connection(m_socket),
       m_reader(m_socket),
       m_writer(m_socket) {}
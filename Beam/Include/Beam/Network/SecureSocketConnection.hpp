@@ -1,6 +1,7 @@
 #ifndef BEAM_SECURE_SOCKET_CONNECTION_HPP
 #define BEAM_SECURE_SOCKET_CONNECTION_HPP
 #include <string>
+#include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/optional/optional.hpp>
 #include <boost/throw_exception.hpp>
 #include "Beam/IO/Connection.hpp"
@@ -8,8 +9,10 @@
 #include "Beam/IO/OpenState.hpp"
 #include "Beam/Network/IpAddress.hpp"
 #include "Beam/Network/NetworkDetails.hpp"
-#include "Beam/Network/SocketException.hpp"
+#include "Beam/Network/SecureContextFactory.hpp"
 #include "Beam/Network/SecureSocketOptions.hpp"
+#include "Beam/Network/SocketException.hpp"
+#include "Beam/Routines/Async.hpp"
 
 namespace Beam {
 namespace Network {
@@ -46,6 +49,8 @@ namespace Network {
       void Open(const SecureSocketOptions& options,
         const std::vector<IpAddress>& addresses,
         const boost::optional<IpAddress>& interface);
+      void Accept(const SecureSocketOptions& options);
+      void SetOptions(const SecureSocketOptions& options);
   };
 
   inline SecureSocketConnection::~SecureSocketConnection() {
@@ -139,6 +144,8 @@ namespace Network {
           ++endpointIterator;
         }
         if(!errorCode) {
+          m_socket->m_sessionKey =
+            address.GetHost() + ":" + std::to_string(address.GetPort());
           break;
         }
       }
@@ -146,25 +153,23 @@ namespace Network {
         BOOST_THROW_EXCEPTION(SocketException(errorCode.value(),
           errorCode.message()));
       }
-      auto bufferSize = boost::asio::socket_base::send_buffer_size(
-        options.m_writeBufferSize);
-      m_socket->m_socket.lowest_layer().set_option(bufferSize, errorCode);
-      if(errorCode) {
-        BOOST_THROW_EXCEPTION(SocketException(errorCode.value(),
-          errorCode.message()));
-      }
-      auto noDelay = boost::asio::ip::tcp::no_delay(options.m_noDelayEnabled);
-      m_socket->m_socket.lowest_layer().set_option(noDelay, errorCode);
-      if(errorCode) {
-        BOOST_THROW_EXCEPTION(SocketException(errorCode.value(),
-          errorCode.message()));
-      }
+      SetOptions(options);
+      auto& factory = SecureContextFactory::GetInstance();
+      auto isResuming = factory.PrepareClient(
+        m_socket->m_socket.native_handle(), m_socket->m_sessionKey);
+      auto start = boost::posix_time::microsec_clock::universal_time();
       m_socket->m_socket.handshake(boost::asio::ssl::stream_base::client,
         errorCode);
       if(errorCode) {
+        if(isResuming) {
+          factory.GetSessionCache().Remove(m_socket->m_sessionKey);
+        }
         BOOST_THROW_EXCEPTION(SocketException(errorCode.value(),
           errorCode.message()));
       }
+      factory.GetClientCounters().Record(
+        SSL_session_reused(m_socket->m_socket.native_handle()) == 1,
+        boost::posix_time::microsec_clock::universal_time() - start);
     } catch(const IO::ConnectException&) {
       Close();
       BOOST_RETHROW;
@@ -174,6 +179,50 @@ namespace Network {
     }
     m_socket->m_isOpen = true;
   }
+
+  inline void SecureSocketConnection::Accept(
+      const SecureSocketOptions& options) {
+    try {
+      SetOptions(options);
+      auto handshakeAsync = Routines::Async<void>();
+      auto start = boost::posix_time::microsec_clock::universal_time();
+      m_socket->m_socket.async_handshake(boost::asio::ssl::stream_base::server,
+        [&] (const auto& error) {
+          if(error) {
+            handshakeAsync.GetEval().SetException(SocketException(
+              error.value(), error.message()));
+          } else {
+            handshakeAsync.GetEval().SetResult();
+          }
+        });
+      handshakeAsync.Get();
+      SecureContextFactory::GetInstance().GetServerCounters().Record(
+        SSL_session_reused(m_socket->m_socket.native_handle()) == 1,
+        boost::posix_time::microsec_clock::universal_time() - start);
+    } catch(const std::exception&) {
+      Close();
+      std::throw_with_nested(IO::ConnectException("Unable to accept socket."));
+    }
+    m_socket->m_isOpen = true;
+  }
+
+  inline void SecureSocketConnection::SetOptions(
+      const SecureSocketOptions& options) {
+    auto errorCode = boost::system::error_code();
+    auto bufferSize = boost::asio::socket_base::send_buffer_size(
+      options.m_writeBufferSize);
+    m_socket->m_socket.lowest_layer().set_option(bufferSize, errorCode);
+    if(errorCode) {
+      BOOST_THROW_EXCEPTION(SocketException(errorCode.value(),
+        errorCode.message()));
+    }
+    auto noDelay = boost::asio::ip::tcp::no_delay(options.m_noDelayEnabled);
+    m_socket->m_socket.lowest_layer().set_option(noDelay, errorCode);
+    if(errorCode) {
+      BOOST_THROW_EXCEPTION(SocketException(errorCode.value(),
+        errorCode.message()));
+    }
+  }
 }
 
   template<>
@@ -1,7 +1,10 @@
 #ifndef BEAM_SECURE_SOCKET_WRITER_HPP
 #define BEAM_SECURE_SOCKET_WRITER_HPP
+#include <array>
+#include <tuple>
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/write.hpp>
+#include "Beam/IO/BufferSequence.hpp"
 #include "Beam/IO/EndOfFileException.hpp"
 #include "Beam/IO/IO.hpp"
 #include "Beam/IO/SharedBuffer.hpp"
@@ -25,6 +28,9 @@ namespace Network {
       template<typename BufferType>
       void Write(const BufferType& data);
 
+      template<typename... B>
+      void Write(const IO::BufferSequence<B...>& buffers);
+
     private:
       friend class SecureSocketChannel;
       std::shared_ptr<Details::SecureSocketEntry> m_socket;
@@ -33,16 +39,37 @@ namespace Network {
       SecureSocketWriter(std::shared_ptr<Details::SecureSocketEntry> socket);
       SecureSocketWriter(const SecureSocketWriter&) = delete;
       SecureSocketWriter& operator =(const SecureSocketWriter&) = delete;
+      template<typename Buffers>
+      void WriteBuffers(const Buffers& buffers);
   };
 
   inline void SecureSocketWriter::Write(const void* data, std::size_t size) {
+    WriteBuffers(boost::asio::buffer(data, size));
+  }
+
+  template<typename BufferType>
+  void SecureSocketWriter::Write(const BufferType& data) {
+    Write(data.GetData(), data.GetSize());
+  }
+
+  template<typename... B>
+  void SecureSocketWriter::Write(const IO::BufferSequence<B...>& buffers) {
+    auto sequence = std::apply([] (const auto&... buffer) {
+      return std::array{boost::asio::buffer(buffer.GetData(),
+        buffer.GetSize())...};
+    }, buffers.GetBuffers());
+    WriteBuffers(sequence);
+  }
+
+  template<typename Buffers>
+  void SecureSocketWriter::WriteBuffers(const Buffers& buffers) {
     auto writeResult = Routines::Async<void>();
     m_socket->BeginWriteOperation();
     m_tasks.Add(
       [&] {
         auto lock = std::lock_guard(m_socket->m_mutex);
         boost::asio::async_write(m_socket->m_socket,
-          boost::asio::buffer(data, size),
+          buffers,
           [&] (const auto& error, auto writeSize) {
             if(error) {
               writeResult.GetEval().SetException(SocketException(
@@ -61,11 +88,6 @@ namespace Network {
     }
   }
 
-  template<typename BufferType>
-  void SecureSocketWriter::Write(const BufferType& data) {
-    Write(data.GetData(), data.GetSize());
-  }
-
   inline SecureSocketWriter::SecureSocketWriter(
     std::shared_ptr<Details::SecureSocketEntry> socket)
     : m_socket(std::move(socket)) {}
@@ -74,6 +96,11 @@ namespace Network {
   template<typename BufferType>
   struct ImplementsConcept<Network::SecureSocketWriter,
     IO::Writer<BufferType>> : std::true_type {};
+
+namespace IO {
+  template<>
+  struct IsGatherWriter<Network::SecureSocketWriter> : std::true_type {};
+}
 }
 
 #endif
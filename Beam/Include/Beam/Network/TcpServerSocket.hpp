@@ -103,7 +103,8 @@ namespace Network {
       TcpServerSocket::Accept() {
     auto acceptAsync = Routines::Async<void>();
     auto acceptEval = acceptAsync.GetEval();
-    auto channel = std::unique_ptr<Channel>(new TcpSocketChannel());
+    auto channel = std::unique_ptr<Channel>(new TcpSocketChannel(
+      Threading::ServiceThreadPool::GetInstance().GetNextService()));
     m_acceptor->async_accept(channel->m_socket->m_socket,
       [&] (const auto& error) {
         if(error) {
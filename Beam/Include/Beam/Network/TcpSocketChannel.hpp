@@ -100,7 +100,7 @@ namespace Network {
       Reader m_reader;
       Writer m_writer;
 
-      TcpSocketChannel();
+      TcpSocketChannel(boost::asio::io_service& ioService);
       TcpSocketChannel(const TcpSocketChannel&) = delete;
       TcpSocketChannel& operator =(const TcpSocketChannel&) = delete;
       void SetAddress(const IpAddress& address);
@@ -167,10 +167,10 @@ namespace Network {
     return m_writer;
   }
 
-  inline TcpSocketChannel::TcpSocketChannel()
-    : m_socket(std::make_shared<Details::TcpSocketEntry>(
-        Threading::ServiceThreadPool::GetInstance().GetService(),
-        Threading::ServiceThreadPool::GetInstance().GetService())),
+  inline TcpSocketChannel::TcpSocketChannel(
+    boost::asio::io_service& ioService)
+    : m_socket(std::make_shared<Details::TcpSocketEntry>(ioService,
+        ioService)),
       m_connection(m_socket),
       m_reader(m_socket),
       m_writer(m_socket) {}
@@ -1,7 +1,10 @@
 #ifndef BEAM_TCP_SOCKET_WRITER_HPP
 #define BEAM_TCP_SOCKET_WRITER_HPP
+#include <array>
+#include <tuple>
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/write.hpp>
+#include "Beam/IO/BufferSequence.hpp"
 #include "Beam/IO/EndOfFileException.hpp"
 #include "Beam/IO/IO.hpp"
 #include "Beam/IO/SharedBuffer.hpp"
@@ -25,6 +28,9 @@ namespace Network {
       template<typename BufferType>
       void Write(const BufferType& data);
 
+      template<typename... B>
+      void Write(const IO::BufferSequence<B...>& buffers);
+
     private:
       friend class TcpSocketChannel;
       std::shared_ptr<Details::TcpSocketEntry> m_socket;
@@ -33,15 +39,36 @@ namespace Network {
       TcpSocketWriter(std::shared_ptr<Details::TcpSocketEntry> socket);
       TcpSocketWriter(const TcpSocketWriter&) = delete;
       TcpSocketWriter& operator =(const TcpSocketWriter&) = delete;
+      template<typename Buffers>
+      void WriteBuffers(const Buffers& buffers);
   };
 
   inline void TcpSocketWriter::Write(const void* data, std::size_t size) {
+    WriteBuffers(boost::asio::buffer(data, size));
+  }
+
+  template<typename BufferType>
+  void TcpSocketWriter::Write(const BufferType& data) {
+    Write(data.GetData(), data.GetSize());
+  }
+
+  template<typename... B>
+  void TcpSocketWriter::Write(const IO::BufferSequence<B...>& buffers) {
+    auto sequence = std::apply([] (const auto&... buffer) {
+      return std::array{boost::asio::buffer(buffer.GetData(),
+        buffer.GetSize())...};
+    }, buffers.GetBuffers());
+    WriteBuffers(sequence);
+  }
+
+  template<typename Buffers>
+  void TcpSocketWriter::WriteBuffers(const Buffers& buffers) {
     auto writeResult = Routines::Async<void>();
     m_socket->BeginWriteOperation();
     m_tasks.Add([&] {
       auto lock = std::lock_guard(m_socket->m_mutex);
       boost::asio::async_write(m_socket->m_socket,
-        boost::asio::buffer(data, size),
+        buffers,
         [&] (const auto& error, auto writeSize) {
           if(error) {
             writeResult.GetEval().SetException(
@@ -60,11 +87,6 @@ namespace Network {
     }
   }
 
-  template<typename BufferType>
-  void TcpSocketWriter::Write(const BufferType& data) {
-    Write(data.GetData(), data.GetSize());
-  }
-
   inline TcpSocketWriter::TcpSocketWriter(
     std::shared_ptr<Details::TcpSocketEntry> socket)
     : m_socket(std::move(socket)) {}
@@ -73,6 +95,11 @@ namespace Network {
   template<typename BufferType>
   struct ImplementsConcept<Network::TcpSocketWriter, IO::Writer<BufferType>> :
     std::true_type {};
+
+namespace IO {
+  template<>
+  struct IsGatherWriter<Network::TcpSocketWriter> : std::true_type {};
+}
 }
 
 #endif
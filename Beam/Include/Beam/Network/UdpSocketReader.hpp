@@ -1,6 +1,7 @@
 #ifndef BEAM_UDP_SOCKET_READER_HPP
 #define BEAM_UDP_SOCKET_READER_HPP
 #include "Beam/IO/Reader.hpp"
+#include "Beam/Network/DatagramBatch.hpp"
 #include "Beam/Network/UdpSocket.hpp"
 #include "Beam/Network/UdpSocketReceiver.hpp"
 
@@ -20,6 +21,13 @@ namespace Network {
       template<typename Buffer>
       std::size_t Read(Out<Buffer> destination, std::size_t size);
 
+      /**
+       * Reads as many datagrams as are available in a single system call.
+       * @param batch Replaced with the datagrams read.
+       * @return The number of datagrams read.
+       */
+      std::size_t ReadBatch(Out<DatagramBatch> batch);
+
     private:
       friend class UdpSocketChannel;
       std::shared_ptr<UdpSocket> m_socket;
@@ -58,6 +66,10 @@ namespace Network {
       Store(address));
   }
 
+  inline std::size_t UdpSocketReader::ReadBatch(Out<DatagramBatch> batch) {
+    return m_socket->GetReceiver().Receive(Store(batch));
+  }
+
   inline UdpSocketReader::UdpSocketReader(std::shared_ptr<UdpSocket> socket)
     : m_socket(std::move(socket)) {}
 }
@@ -1,8 +1,13 @@
 #ifndef BEAM_UDP_SOCKET_RECEIVER_HPP
 #define BEAM_UDP_SOCKET_RECEIVER_HPP
+#include <cerrno>
+#include <cstring>
+#include <vector>
 #include <boost/asio/ip/udp.hpp>
 #include <boost/asio/steady_timer.hpp>
+#include <boost/optional/optional.hpp>
 #include "Beam/IO/EndOfFileException.hpp"
+#include "Beam/Network/DatagramBatch.hpp"
 #include "Beam/Network/DatagramPacket.hpp"
 #include "Beam/Network/Network.hpp"
 #include "Beam/Network/NetworkDetails.hpp"
@@ -76,6 +81,26 @@ namespace Beam::Network {
       std::size_t Receive(Out<Buffer> destination, std::size_t size,
         Out<IpAddress> address);
 
+      /**
+       * Receives as many datagrams as are available with a single system
+       * call, suspending until at least one arrives.
+       * @param batch Replaced with the datagrams received, up to its
+       *        capacity.
+       * @return The number of datagrams received.
+       */
+      std::size_t Receive(Out<DatagramBatch> batch);
+
+      /**
+       * Receives as many DatagramPackets as are available with a single
+       * system call, suspending until at least one arrives.
+       * @param packets The list to append the DatagramPackets received to.
+       * @param count The maximum number of DatagramPackets to receive.
+       * @return The number of DatagramPackets received.
+       */
+      template<typename Buffer>
+      std::size_t Receive(Out<std::vector<DatagramPacket<Buffer>>> packets,
+        std::size_t count);
+
     private:
       mutable Threading::Mutex m_mutex;
       bool m_isOpen;
@@ -84,9 +109,13 @@ namespace Beam::Network {
       UdpSocketOptions m_options;
       std::shared_ptr<Details::UdpSocketEntry> m_socket;
       boost::asio::basic_waitable_timer<boost::chrono::steady_clock> m_deadline;
+      Threading::Mutex m_batchMutex;
+      boost::optional<DatagramBatch> m_batch;
 
       UdpSocketReceiver(const UdpSocketReceiver&) = delete;
       UdpSocketReceiver& operator =(const UdpSocketReceiver&) = delete;
+      bool StartDeadline();
+      std::size_t Receive(DatagramBatch& batch, std::size_t count);
       void CheckDeadline(const boost::system::error_code& error);
   };
 
@@ -147,15 +176,7 @@ namespace Beam::Network {
           readResult.GetEval().SetResult(readSize);
         });
     }
-    auto hasTimeout = m_options.m_timeout != boost::posix_time::pos_infin;
-    if(hasTimeout) {
-      auto lock = boost::lock_guard(m_mutex);
-      m_isDeadlinePending = true;
-      m_deadline.expires_from_now(boost::chrono::microseconds{
-        m_options.m_timeout.total_microseconds()});
-      m_deadline.async_wait(std::bind(&UdpSocketReceiver::CheckDeadline, this,
-        std::placeholders::_1));
-    }
+    auto hasTimeout = StartDeadline();
     try {
       auto result = readResult.Get();
       if(hasTimeout) {
@@ -194,6 +215,99 @@ namespace Beam::Network {
     return result;
   }
 
+  inline std::size_t UdpSocketReceiver::Receive(Out<DatagramBatch> batch) {
+    return Receive(*batch, batch->GetCapacity());
+  }
+
+  template<typename Buffer>
+  std::size_t UdpSocketReceiver::Receive(
+      Out<std::vector<DatagramPacket<Buffer>>> packets, std::size_t count) {
+    auto lock = std::lock_guard(m_batchMutex);
+    if(!m_batch || m_batch->GetCapacity() < count) {
+      m_batch.emplace(count, m_options.m_maxDatagramSize);
+    }
+    auto size = Receive(*m_batch, count);
+    for(auto i = std::size_t(0); i != size; ++i) {
+      auto& packet = packets->emplace_back();
+      packet.GetData().Append(m_batch->GetData(i),
+        m_batch->GetDatagramSize(i));
+      packet.GetAddress() = m_batch->GetAddress(i);
+    }
+    return size;
+  }
+
+  inline bool UdpSocketReceiver::StartDeadline() {
+    if(m_options.m_timeout == boost::posix_time::pos_infin) {
+      return false;
+    }
+    auto lock = boost::lock_guard(m_mutex);
+    m_isDeadlinePending = true;
+    m_deadline.expires_from_now(boost::chrono::microseconds{
+      m_options.m_timeout.total_microseconds()});
+    m_deadline.async_wait(std::bind(&UdpSocketReceiver::CheckDeadline, this,
+      std::placeholders::_1));
+    return true;
+  }
+
+  inline std::size_t UdpSocketReceiver::Receive(DatagramBatch& batch,
+      std::size_t count) {
+    batch.Reset();
+    count = std::min(count, batch.GetCapacity());
+    if(count == 0) {
+      return 0;
+    }
+#ifdef __linux__
+    {
+      auto lock = std::lock_guard(m_socket->m_mutex);
+      if(!m_socket->m_isOpen) {
+        BOOST_THROW_EXCEPTION(IO::EndOfFileException());
+      }
+      m_socket->m_isReadPending = true;
+    }
+    auto hasTimeout = StartDeadline();
+    try {
+      auto headers = batch.PrepareHeaders(count, true);
+      while(true) {
+        auto result = 0;
+        auto error = 0;
+        {
+          auto lock = std::lock_guard(m_socket->m_mutex);
+          result = ::recvmmsg(m_socket->m_socket.native_handle(), headers,
+            static_cast<unsigned int>(count), MSG_DONTWAIT, nullptr);
+          error = errno;
+        }
+        if(result > 0) {
+          for(auto i = 0; i != result; ++i) {
+            batch.m_sizes[i] = headers[i].msg_len;
+            batch.m_endpoints[i].resize(headers[i].msg_hdr.msg_namelen);
+          }
+          batch.m_size = static_cast<std::size_t>(result);
+          break;
+        } else if(error != EAGAIN && error != EWOULDBLOCK && error != EINTR) {
+          BOOST_THROW_EXCEPTION(SocketException(error, std::strerror(error)));
+        }
+        m_socket->Wait(boost::asio::socket_base::wait_read);
+      }
+      if(hasTimeout) {
+        m_deadline.cancel();
+      }
+      m_socket->EndReadOperation();
+    } catch(const std::exception&) {
+      m_socket->EndReadOperation();
+      std::throw_with_nested(IO::EndOfFileException());
+    }
+#else
+    auto address = IpAddress();
+    batch.m_sizes[0] = Receive(batch.GetMutableData(0),
+      batch.GetMaxDatagramSize(), Store(address));
+    batch.m_endpoints[0] = boost::asio::ip::udp::endpoint(
+      boost::asio::ip::address::from_string(address.GetHost()),
+      address.GetPort());
+    batch.m_size = 1;
+#endif
+    return batch.GetSize();
+  }
+
   inline void UdpSocketReceiver::CheckDeadline(
       const boost::system::error_code& error) {
     {
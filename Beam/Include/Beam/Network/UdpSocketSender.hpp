@@ -1,13 +1,19 @@
 #ifndef BEAM_UDP_SOCKET_SENDER_HPP
 #define BEAM_UDP_SOCKET_SENDER_HPP
+#include <cerrno>
+#include <cstring>
+#include <vector>
 #include <boost/asio/ip/udp.hpp>
+#include <boost/optional/optional.hpp>
 #include "Beam/IO/EndOfFileException.hpp"
+#include "Beam/Network/DatagramBatch.hpp"
 #include "Beam/Network/DatagramPacket.hpp"
 #include "Beam/Network/Network.hpp"
 #include "Beam/Network/NetworkDetails.hpp"
 #include "Beam/Network/SocketException.hpp"
 #include "Beam/Network/UdpSocketOptions.hpp"
 #include "Beam/Routines/Async.hpp"
+#include "Beam/Threading/Mutex.hpp"
 #include "Beam/Threading/TaskRunner.hpp"
 
 namespace Beam::Network {
@@ -39,8 +45,26 @@ namespace Beam::Network {
       void Send(const void* data, std::size_t size,
         const IpAddress& destination);
 
+      /**
+       * Sends every datagram in a batch with as few system calls as the
+       * socket's send buffer allows.
+       * @param batch The datagrams to send.
+       */
+      void Send(const DatagramBatch& batch);
+
+      /**
+       * Sends a list of DatagramPackets with as few system calls as the
+       * socket's send buffer allows.
+       * @param packets The DatagramPackets to send.
+       */
+      template<typename Buffer>
+      void Send(const std::vector<DatagramPacket<Buffer>>& packets);
+
     private:
       std::shared_ptr<Details::UdpSocketEntry> m_socket;
+      std::size_t m_maxDatagramSize;
+      Threading::Mutex m_batchMutex;
+      boost::optional<DatagramBatch> m_batch;
       Threading::TaskRunner m_tasks;
 
       UdpSocketSender(const UdpSocketSender&) = delete;
@@ -49,7 +73,8 @@ namespace Beam::Network {
 
   inline UdpSocketSender::UdpSocketSender(const UdpSocketOptions& options,
     std::shared_ptr<Details::UdpSocketEntry> socket)
-    : m_socket(std::move(socket)) {}
+    : m_socket(std::move(socket)),
+      m_maxDatagramSize(options.m_maxDatagramSize) {}
 
   template<typename Buffer>
   void UdpSocketSender::Send(const DatagramPacket<Buffer>& packet) {
@@ -83,6 +108,70 @@ namespace Beam::Network {
       std::throw_with_nested(IO::EndOfFileException());
     }
   }
+
+  inline void UdpSocketSender::Send(const DatagramBatch& batch) {
+#ifdef __linux__
+    m_socket->BeginWriteOperation();
+    try {
+      auto headers = batch.PrepareHeaders(batch.GetSize(), false);
+      auto count = std::size_t(0);
+      while(count != batch.GetSize()) {
+        auto result = 0;
+        auto error = 0;
+        {
+          auto lock = std::lock_guard(m_socket->m_mutex);
+          result = ::sendmmsg(m_socket->m_socket.native_handle(),
+            headers + count, static_cast<unsigned int>(
+            batch.GetSize() - count), MSG_DONTWAIT);
+          error = errno;
+        }
+        if(result > 0) {
+          count += static_cast<std::size_t>(result);
+        } else if(error == EAGAIN || error == EWOULDBLOCK || error == EINTR) {
+          m_socket->Wait(boost::asio::socket_base::wait_write);
+        } else {
+          BOOST_THROW_EXCEPTION(SocketException(error, std::strerror(error)));
+        }
+      }
+      m_socket->EndWriteOperation();
+    } catch(const std::exception&) {
+      m_socket->EndWriteOperation();
+      std::throw_with_nested(IO::EndOfFileException());
+    }
+#else
+    for(auto i = std::size_t(0); i != batch.GetSize(); ++i) {
+      Send(batch.GetData(i), batch.GetDatagramSize(i), batch.GetAddress(i));
+    }
+#endif
+  }
+
+  template<typename Buffer>
+  void UdpSocketSender::Send(
+      const std::vector<DatagramPacket<Buffer>>& packets) {
+    auto lock = std::lock_guard(m_batchMutex);
+    if(!m_batch || m_batch->GetCapacity() < packets.size()) {
+      m_batch.emplace(packets.size(), m_maxDatagramSize);
+    }
+    m_batch->Reset();
+    for(auto& packet : packets) {
+
+      /* A datagram too large for the batch's arena is sent on its own after
+         the datagrams before it, preserving their order. */
+      if(packet.GetData().GetSize() > m_batch->GetMaxDatagramSize()) {
+        if(!m_batch->IsEmpty()) {
+          Send(*m_batch);
+          m_batch->Reset();
+        }
+        Send(packet);
+      } else {
+        m_batch->Add(packet.GetData().GetData(), packet.GetData().GetSize(),
+          packet.GetAddress());
+      }
+    }
+    if(!m_batch->IsEmpty()) {
+      Send(*m_batch);
+    }
+  }
 }
 
 #endif
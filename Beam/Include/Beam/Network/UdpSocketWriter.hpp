@@ -2,6 +2,7 @@
 #define BEAM_UDP_SOCKET_WRITER_HPP
 #include "Beam/IO/SharedBuffer.hpp"
 #include "Beam/IO/Writer.hpp"
+#include "Beam/Network/DatagramBatch.hpp"
 #include "Beam/Network/Network.hpp"
 #include "Beam/Network/UdpSocket.hpp"
 #include "Beam/Network/UdpSocketSender.hpp"
@@ -19,6 +20,13 @@ namespace Network {
       template<typename BufferType>
       void Write(const BufferType& data);
 
+      /**
+       * Writes a batch of datagrams in as few system calls as possible, each
+       * datagram is sent to the destination it was added with.
+       * @param batch The datagrams to write.
+       */
+      void WriteBatch(const DatagramBatch& batch);
+
     private:
       friend class UdpSocketChannel;
       std::shared_ptr<UdpSocket> m_socket;
@@ -37,6 +45,10 @@ namespace Network {
     Write(data.GetData(), data.GetSize());
   }
 
+  inline void UdpSocketWriter::WriteBatch(const DatagramBatch& batch) {
+    m_socket->GetSender().Send(batch);
+  }
+
   inline UdpSocketWriter::UdpSocketWriter(std::shared_ptr<UdpSocket> socket)
     : m_socket(std::move(socket)) {}
 }
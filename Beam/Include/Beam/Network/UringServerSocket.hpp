@@ -0,0 +1,163 @@
+#ifndef BEAM_URING_SERVER_SOCKET_HPP
+#define BEAM_URING_SERVER_SOCKET_HPP
+#include <memory>
+#include <string>
+#include <boost/optional/optional.hpp>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include "Beam/IO/ConnectException.hpp"
+#include "Beam/IO/EndOfFileException.hpp"
+#include "Beam/IO/OpenState.hpp"
+#include "Beam/IO/ServerConnection.hpp"
+#include "Beam/Network/IoUringService.hpp"
+#include "Beam/Network/Network.hpp"
+#include "Beam/Network/SocketException.hpp"
+#include "Beam/Network/UringSocketChannel.hpp"
+#include "Beam/Routines/Async.hpp"
+
+namespace Beam {
+namespace Network {
+
+  /** Implements a TCP server socket driven by io_uring. */
+  class UringServerSocket {
+    public:
+      using Channel = UringSocketChannel;
+
+      /** Constructs a UringServerSocket. */
+      UringServerSocket();
+
+      /**
+       * Constructs a UringServerSocket.
+       * @param options The set of TcpSocketOptions to apply.
+       */
+      UringServerSocket(const TcpSocketOptions& options);
+
+      /**
+       * Constructs a UringServerSocket.
+       * @param interface The interface to bind to.
+       */
+      UringServerSocket(const IpAddress& interface);
+
+      /**
+       * Constructs a UringServerSocket.
+       * @param interface The interface to bind to.
+       * @param options The set of TcpSocketOptions to apply.
+       */
+      UringServerSocket(const IpAddress& interface,
+        const TcpSocketOptions& options);
+
+      ~UringServerSocket();
+
+      std::unique_ptr<Channel> Accept();
+
+      void Close();
+
+    private:
+      TcpSocketOptions m_options;
+      IoUringService* m_service;
+      int m_fd;
+      IO::OpenState m_openState;
+
+      UringServerSocket(const UringServerSocket&) = delete;
+      UringServerSocket& operator =(const UringServerSocket&) = delete;
+  };
+
+  inline UringServerSocket::UringServerSocket()
+    : UringServerSocket(TcpSocketOptions()) {}
+
+  inline UringServerSocket::UringServerSocket(const TcpSocketOptions& options)
+    : UringServerSocket(IpAddress("0.0.0.0", 0), options) {}
+
+  inline UringServerSocket::UringServerSocket(const IpAddress& interface)
+    : UringServerSocket(interface, TcpSocketOptions()) {}
+
+  inline UringServerSocket::UringServerSocket(const IpAddress& interface,
+      const TcpSocketOptions& options)
+      : m_options(options),
+        m_service(&IoUringService::GetInstance()),
+        m_fd(-1) {
+    try {
+      auto endpoint = Details::ResolveUringAddress(interface);
+      m_fd = ::socket(endpoint->ai_family,
+        endpoint->ai_socktype | SOCK_CLOEXEC, endpoint->ai_protocol);
+      if(m_fd == -1) {
+        auto code = errno;
+        ::freeaddrinfo(endpoint);
+        Details::ThrowUringError(code);
+      }
+      auto reuseAddress = 1;
+      ::setsockopt(m_fd, SOL_SOCKET, SO_REUSEADDR, &reuseAddress,
+        sizeof(reuseAddress));
+      auto result = ::bind(m_fd, endpoint->ai_addr, endpoint->ai_addrlen);
+      auto code = errno;
+      ::freeaddrinfo(endpoint);
+      if(result != 0) {
+        Details::ThrowUringError(code);
+      }
+      if(::listen(m_fd, SOMAXCONN) != 0) {
+        Details::ThrowUringError(errno);
+      }
+    } catch(const std::exception&) {
+      Close();
+      std::throw_with_nested(IO::ConnectException("Unable to open server."));
+    }
+  }
+
+  inline UringServerSocket::~UringServerSocket() {
+    Close();
+  }
+
+  inline std::unique_ptr<typename UringServerSocket::Channel>
+      UringServerSocket::Accept() {
+    auto acceptAsync = Routines::Async<int>();
+    auto operation = Details::MakeUringOperation(
+      [&] (int result, std::uint32_t flags) {
+        acceptAsync.GetEval().SetResult(result);
+      });
+    auto address = sockaddr_in();
+    auto addressSize = socklen_t(sizeof(address));
+    m_service->Submit(&operation, [&] (auto& entry) {
+      entry.opcode = IORING_OP_ACCEPT;
+      entry.fd = m_fd;
+      entry.addr = reinterpret_cast<std::uint64_t>(&address);
+      entry.addr2 = reinterpret_cast<std::uint64_t>(&addressSize);
+      entry.accept_flags = SOCK_CLOEXEC;
+    });
+    auto channel = std::unique_ptr<Channel>(new UringSocketChannel());
+    try {
+      auto fd = acceptAsync.Get();
+      if(fd < 0) {
+        Details::ThrowUringError(-fd);
+      }
+      channel->m_socket->m_fd = fd;
+      char host[INET_ADDRSTRLEN];
+      ::inet_ntop(AF_INET, &address.sin_addr, host, sizeof(host));
+      channel->SetAddress(IpAddress(host, ntohs(address.sin_port)));
+      channel->GetConnection().Open(m_options, {}, boost::none);
+    } catch(const std::exception&) {
+      std::throw_with_nested(IO::EndOfFileException("Failed to accept."));
+    }
+    return channel;
+  }
+
+  inline void UringServerSocket::Close() {
+    if(m_openState.SetClosing()) {
+      return;
+    }
+    if(m_fd != -1) {
+      ::shutdown(m_fd, SHUT_RDWR);
+      m_service->Cancel(m_fd);
+      ::close(m_fd);
+    }
+    m_openState.Close();
+  }
+}
+
+  template<>
+  struct ImplementsConcept<Network::UringServerSocket,
+    IO::ServerConnection<Network::UringServerSocket::Channel>> :
+    std::true_type {};
+}
+
+#endif
@@ -0,0 +1,191 @@
+#ifndef BEAM_URING_SOCKET_CHANNEL_HPP
+#define BEAM_URING_SOCKET_CHANNEL_HPP
+#include <vector>
+#include "Beam/IO/Channel.hpp"
+#include "Beam/Network/IoUringDetails.hpp"
+#include "Beam/Network/IoUringService.hpp"
+#include "Beam/Network/Network.hpp"
+#include "Beam/Network/SocketIdentifier.hpp"
+#include "Beam/Network/TcpSocketOptions.hpp"
+#include "Beam/Network/UringSocketConnection.hpp"
+#include "Beam/Network/UringSocketReader.hpp"
+#include "Beam/Network/UringSocketWriter.hpp"
+
+namespace Beam {
+namespace Network {
+
+  /**
+   * Implements the Channel interface using a TCP socket driven by io_uring
+   * rather than by asio's reactor.
+   */
+  class UringSocketChannel {
+    public:
+      using Identifier = SocketIdentifier;
+      using Connection = UringSocketConnection;
+      using Reader = UringSocketReader;
+      using Writer = UringSocketWriter;
+
+      /**
+       * Constructs a UringSocketChannel.
+       * @param address The IP address to connect to.
+       */
+      UringSocketChannel(const IpAddress& address);
+
+      /**
+       * Constructs a UringSocketChannel.
+       * @param address The IP address to connect to.
+       * @param options The set of TcpSocketOptions to apply.
+       */
+      UringSocketChannel(const IpAddress& address,
+        const TcpSocketOptions& options);
+
+      /**
+       * Constructs a UringSocketChannel.
+       * @param address The IP address to connect to.
+       * @param interface The interface to bind to.
+       */
+      UringSocketChannel(const IpAddress& address, const IpAddress& interface);
+
+      /**
+       * Constructs a UringSocketChannel.
+       * @param address The IP address to connect to.
+       * @param interface The interface to bind to.
+       * @param options The set of TcpSocketOptions to apply.
+       */
+      UringSocketChannel(const IpAddress& address, const IpAddress& interface,
+        const TcpSocketOptions& options);
+
+      /**
+       * Constructs a UringSocketChannel.
+       * @param addresses The list of IP addresses to try to connect to.
+       */
+      UringSocketChannel(const std::vector<IpAddress>& addresses);
+
+      /**
+       * Constructs a UringSocketChannel.
+       * @param addresses The list of IP addresses to try to connect to.
+       * @param options The set of TcpSocketOptions to apply.
+       */
+      UringSocketChannel(const std::vector<IpAddress>& addresses,
+        const TcpSocketOptions& options);
+
+      /**
+       * Constructs a UringSocketChannel.
+       * @param addresses The list of IP addresses to try to connect to.
+       * @param interface The interface to bind to.
+       */
+      UringSocketChannel(const std::vector<IpAddress>& addresses,
+        const IpAddress& interface);
+
+      /**
+       * Constructs a UringSocketChannel.
+       * @param addresses The list of IP addresses to try to connect to.
+       * @param interface The interface to bind to.
+       * @param options The set of TcpSocketOptions to apply.
+       */
+      UringSocketChannel(const std::vector<IpAddress>& addresses,
+        const IpAddress& interface, const TcpSocketOptions& options);
+
+      const Identifier& GetIdentifier() const;
+
+      Connection& GetConnection();
+
+      Reader& GetReader();
+
+      Writer& GetWriter();
+
+    private:
+      friend class UringServerSocket;
+      std::shared_ptr<Details::UringSocketEntry> m_socket;
+      Identifier m_identifier;
+      Connection m_connection;
+      Reader m_reader;
+      Writer m_writer;
+
+      UringSocketChannel();
+      UringSocketChannel(const UringSocketChannel&) = delete;
+      UringSocketChannel& operator =(const UringSocketChannel&) = delete;
+      void SetAddress(const IpAddress& address);
+  };
+
+  inline UringSocketChannel::UringSocketChannel(const IpAddress& address)
+    : UringSocketChannel(address, TcpSocketOptions()) {}
+
+  inline UringSocketChannel::UringSocketChannel(const IpAddress& address,
+    const TcpSocketOptions& options)
+    : UringSocketChannel(std::vector<IpAddress>{address}, options) {}
+
+  inline UringSocketChannel::UringSocketChannel(const IpAddress& address,
+    const IpAddress& interface)
+    : UringSocketChannel(address, interface, TcpSocketOptions()) {}
+
+  inline UringSocketChannel::UringSocketChannel(const IpAddress& address,
+    const IpAddress& interface, const TcpSocketOptions& options)
+    : UringSocketChannel(std::vector<IpAddress>{address}, interface,
+        options) {}
+
+  inline UringSocketChannel::UringSocketChannel(
+    const std::vector<IpAddress>& addresses)
+    : UringSocketChannel(addresses, TcpSocketOptions()) {}
+
+  inline UringSocketChannel::UringSocketChannel(
+    const std::vector<IpAddress>& addresses, const TcpSocketOptions& options)
+    : m_socket(std::make_shared<Details::UringSocketEntry>(
+        IoUringService::GetInstance())),
+      m_identifier(addresses.front()),
+      m_connection(m_socket, options, addresses),
+      m_reader(m_socket),
+      m_writer(m_socket) {}
+
+  inline UringSocketChannel::UringSocketChannel(
+    const std::vector<IpAddress>& addresses, const IpAddress& interface)
+    : UringSocketChannel(addresses, interface, TcpSocketOptions()) {}
+
+  inline UringSocketChannel::UringSocketChannel(
+    const std::vector<IpAddress>& addresses, const IpAddress& interface,
+    const TcpSocketOptions& options)
+    : m_socket(std::make_shared<Details::UringSocketEntry>(
+        IoUringService::GetInstance())),
+      m_identifier(addresses.front()),
+      m_connection(m_socket, options, addresses, interface),
+      m_reader(m_socket),
+      m_writer(m_socket) {}
+
+  inline const UringSocketChannel::Identifier&
+      UringSocketChannel::GetIdentifier() const {
+    return m_identifier;
+  }
+
+  inline UringSocketChannel::Connection& UringSocketChannel::GetConnection() {
+    return m_connection;
+  }
+
+  inline UringSocketChannel::Reader& UringSocketChannel::GetReader() {
+    return m_reader;
+  }
+
+  inline UringSocketChannel::Writer& UringSocketChannel::GetWriter() {
+    return m_writer;
+  }
+
+  inline UringSocketChannel::UringSocketChannel()
+    : m_socket(std::make_shared<Details::UringSocketEntry>(
+        IoUringService::GetInstance())),
+      m_connection(m_socket),
+      m_reader(m_socket),
+      m_writer(m_socket) {}
+
+  inline void UringSocketChannel::SetAddress(const IpAddress& address) {
+    m_identifier = SocketIdentifier(address);
+  }
+}
+
+  template<>
+  struct ImplementsConcept<Network::UringSocketChannel, IO::Channel<
+    Network::UringSocketChannel::Identifier,
+    Network::UringSocketChannel::Connection,
+    Network::UringSocketChannel::Reader,
+    Network::UringSocketChannel::Writer>> : std::true_type {};
+}
+
+#endif
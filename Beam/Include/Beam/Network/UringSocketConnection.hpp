@@ -0,0 +1,184 @@
+#ifndef BEAM_URING_SOCKET_CONNECTION_HPP
+#define BEAM_URING_SOCKET_CONNECTION_HPP
+#include <cstring>
+#include <string>
+#include <vector>
+#include <boost/optional/optional.hpp>
+#include <boost/throw_exception.hpp>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include "Beam/IO/Connection.hpp"
+#include "Beam/IO/ConnectException.hpp"
+#include "Beam/IO/OpenState.hpp"
+#include "Beam/Network/IoUringDetails.hpp"
+#include "Beam/Network/IpAddress.hpp"
+#include "Beam/Network/SocketException.hpp"
+#include "Beam/Network/TcpSocketOptions.hpp"
+#include "Beam/Routines/Async.hpp"
+
+namespace Beam {
+namespace Network {
+
+  /** Implements a Connection using a TCP socket driven by io_uring. */
+  class UringSocketConnection {
+    public:
+      ~UringSocketConnection();
+
+      void Close();
+
+    private:
+      friend class UringSocketChannel;
+      friend class UringServerSocket;
+      std::shared_ptr<Details::UringSocketEntry> m_socket;
+      IO::OpenState m_openState;
+
+      UringSocketConnection(std::shared_ptr<Details::UringSocketEntry> socket);
+      UringSocketConnection(std::shared_ptr<Details::UringSocketEntry> socket,
+        const TcpSocketOptions& options,
+        const std::vector<IpAddress>& addresses);
+      UringSocketConnection(std::shared_ptr<Details::UringSocketEntry> socket,
+        const TcpSocketOptions& options,
+        const std::vector<IpAddress>& addresses, const IpAddress& interface);
+      UringSocketConnection(const UringSocketConnection&) = delete;
+      UringSocketConnection& operator =(const UringSocketConnection&) = delete;
+      void Open(const TcpSocketOptions& options,
+        const std::vector<IpAddress>& addresses,
+        const boost::optional<IpAddress>& interface);
+      int Connect(const sockaddr* address, socklen_t size);
+  };
+
+namespace Details {
+  inline addrinfo* ResolveUringAddress(const IpAddress& address) {
+    auto hints = addrinfo();
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    auto result = static_cast<addrinfo*>(nullptr);
+    auto port = std::to_string(address.GetPort());
+    auto error = ::getaddrinfo(address.GetHost().c_str(), port.c_str(), &hints,
+      &result);
+    if(error != 0) {
+      BOOST_THROW_EXCEPTION(SocketException(error, ::gai_strerror(error)));
+    }
+    return result;
+  }
+
+  inline void ThrowUringError(int code) {
+    BOOST_THROW_EXCEPTION(SocketException(code, std::strerror(code)));
+  }
+}
+
+  inline UringSocketConnection::~UringSocketConnection() {
+    Close();
+  }
+
+  inline void UringSocketConnection::Close() {
+    if(m_openState.SetClosing()) {
+      return;
+    }
+    m_socket->Close();
+    m_openState.Close();
+  }
+
+  inline UringSocketConnection::UringSocketConnection(
+    std::shared_ptr<Details::UringSocketEntry> socket)
+    : m_socket(std::move(socket)) {}
+
+  inline UringSocketConnection::UringSocketConnection(
+      std::shared_ptr<Details::UringSocketEntry> socket,
+      const TcpSocketOptions& options, const std::vector<IpAddress>& addresses)
+      : m_socket(std::move(socket)) {
+    Open(options, addresses, boost::none);
+  }
+
+  inline UringSocketConnection::UringSocketConnection(
+      std::shared_ptr<Details::UringSocketEntry> socket,
+      const TcpSocketOptions& options, const std::vector<IpAddress>& addresses,
+      const IpAddress& interface)
+      : m_socket(std::move(socket)) {
+    Open(options, addresses, interface);
+  }
+
+  inline void UringSocketConnection::Open(const TcpSocketOptions& options,
+      const std::vector<IpAddress>& addresses,
+      const boost::optional<IpAddress>& interface) {
+    try {
+      auto error = addresses.empty() ? 0 : EHOSTUNREACH;
+      for(auto& address : addresses) {
+        auto endpoints = Details::ResolveUringAddress(address);
+        for(auto endpoint = endpoints; error != 0 && endpoint;
+            endpoint = endpoint->ai_next) {
+          if(m_socket->m_fd != -1) {
+            ::close(m_socket->m_fd);
+          }
+          m_socket->m_fd = ::socket(endpoint->ai_family,
+            endpoint->ai_socktype | SOCK_CLOEXEC, endpoint->ai_protocol);
+          if(m_socket->m_fd == -1) {
+            error = errno;
+            continue;
+          }
+          if(interface) {
+            auto local = Details::ResolveUringAddress(*interface);
+            auto result = ::bind(m_socket->m_fd, local->ai_addr,
+              local->ai_addrlen);
+            ::freeaddrinfo(local);
+            if(result != 0) {
+              auto code = errno;
+              ::freeaddrinfo(endpoints);
+              Details::ThrowUringError(code);
+            }
+          }
+          error = -Connect(endpoint->ai_addr, endpoint->ai_addrlen);
+        }
+        ::freeaddrinfo(endpoints);
+        if(error == 0) {
+          break;
+        }
+      }
+      if(error != 0) {
+        Details::ThrowUringError(error);
+      }
+      auto bufferSize = options.m_writeBufferSize;
+      if(::setsockopt(m_socket->m_fd, SOL_SOCKET, SO_SNDBUF, &bufferSize,
+          sizeof(bufferSize)) != 0) {
+        Details::ThrowUringError(errno);
+      }
+      auto noDelay = options.m_noDelayEnabled ? 1 : 0;
+      if(::setsockopt(m_socket->m_fd, IPPROTO_TCP, TCP_NODELAY, &noDelay,
+          sizeof(noDelay)) != 0) {
+        Details::ThrowUringError(errno);
+      }
+      m_socket->Open();
+    } catch(const IO::ConnectException&) {
+      Close();
+      BOOST_RETHROW;
+    } catch(const std::exception&) {
+      Close();
+      std::throw_with_nested(IO::ConnectException("Unable to open socket."));
+    }
+  }
+
+  inline int UringSocketConnection::Connect(const sockaddr* address,
+      socklen_t size) {
+    auto connectResult = Routines::Async<int>();
+    auto operation = Details::MakeUringOperation(
+      [&] (int result, std::uint32_t flags) {
+        connectResult.GetEval().SetResult(result);
+      });
+    m_socket->m_service->Submit(&operation, [&] (auto& entry) {
+      entry.opcode = IORING_OP_CONNECT;
+      entry.fd = m_socket->m_fd;
+      entry.addr = reinterpret_cast<std::uint64_t>(address);
+      entry.off = size;
+    });
+    return connectResult.Get();
+  }
+}
+
+  template<>
+  struct ImplementsConcept<Network::UringSocketConnection, IO::Connection> :
+    std::true_type {};
+}
+
+#endif
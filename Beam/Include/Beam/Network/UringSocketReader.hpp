@@ -0,0 +1,112 @@
+#ifndef BEAM_URING_SOCKET_READER_HPP
+#define BEAM_URING_SOCKET_READER_HPP
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include "Beam/IO/EndOfFileException.hpp"
+#include "Beam/IO/IO.hpp"
+#include "Beam/IO/Reader.hpp"
+#include "Beam/Network/IoUringDetails.hpp"
+#include "Beam/Network/Network.hpp"
+#include "Beam/Network/SocketException.hpp"
+
+namespace Beam {
+namespace Network {
+
+  /** Reads from a TCP socket driven by io_uring. */
+  class UringSocketReader {
+    public:
+      bool IsDataAvailable() const;
+
+      template<typename BufferType>
+      std::size_t Read(Out<BufferType> destination);
+
+      std::size_t Read(char* destination, std::size_t size);
+
+      template<typename BufferType>
+      std::size_t Read(Out<BufferType> destination, std::size_t size);
+
+    private:
+      friend class UringSocketChannel;
+      static constexpr auto DEFAULT_READ_SIZE = std::size_t(8 * 1024);
+      std::shared_ptr<Details::UringSocketEntry> m_socket;
+
+      UringSocketReader(std::shared_ptr<Details::UringSocketEntry> socket);
+      UringSocketReader(const UringSocketReader&) = delete;
+      UringSocketReader& operator =(const UringSocketReader&) = delete;
+  };
+
+  inline bool UringSocketReader::IsDataAvailable() const {
+    auto lock = boost::lock_guard(m_socket->m_mutex);
+    return !m_socket->m_chunks.empty();
+  }
+
+  template<typename Buffer>
+  std::size_t UringSocketReader::Read(Out<Buffer> destination) {
+    return Read(Store(destination), DEFAULT_READ_SIZE);
+  }
+
+  inline std::size_t UringSocketReader::Read(char* destination,
+      std::size_t size) {
+    auto lock = boost::unique_lock(m_socket->m_mutex);
+    m_socket->BeginReadOperation();
+    while(m_socket->m_chunks.empty()) {
+      if(!m_socket->m_isOpen || m_socket->m_isEndOfFile) {
+        m_socket->EndReadOperation();
+        if(m_socket->m_isOpen && m_socket->m_errorCode != 0) {
+          try {
+            BOOST_THROW_EXCEPTION(SocketException(m_socket->m_errorCode,
+              std::strerror(m_socket->m_errorCode)));
+          } catch(const std::exception&) {
+            std::throw_with_nested(IO::EndOfFileException());
+          }
+        }
+        BOOST_THROW_EXCEPTION(IO::EndOfFileException());
+      }
+      m_socket->Receive();
+      m_socket->m_receiveCondition.wait(lock);
+    }
+
+    /* Copies out of as many received buffers as fit, so that a burst of
+       small messages is returned by a single Read. */
+    auto readSize = std::size_t(0);
+    while(readSize != size && !m_socket->m_chunks.empty()) {
+      auto& chunk = m_socket->m_chunks.front();
+      auto copySize = std::min<std::size_t>(size - readSize, chunk.m_size);
+      std::memcpy(destination + readSize,
+        m_socket->GetBuffer(chunk.m_id) + chunk.m_offset, copySize);
+      readSize += copySize;
+      chunk.m_offset += static_cast<std::uint32_t>(copySize);
+      chunk.m_size -= static_cast<std::uint32_t>(copySize);
+      if(chunk.m_size == 0) {
+        m_socket->Recycle(chunk.m_id);
+        m_socket->m_chunks.pop_front();
+      }
+    }
+    m_socket->Receive();
+    m_socket->EndReadOperation();
+    return readSize;
+  }
+
+  template<typename Buffer>
+  std::size_t UringSocketReader::Read(Out<Buffer> destination,
+      std::size_t size) {
+    auto initialSize = destination->GetSize();
+    auto readSize = std::min(DEFAULT_READ_SIZE, size);
+    destination->Grow(readSize);
+    auto result = Read(destination->GetMutableData() + initialSize, readSize);
+    destination->Shrink(readSize - result);
+    return result;
+  }
+
+  inline UringSocketReader::UringSocketReader(
+    std::shared_ptr<Details::UringSocketEntry> socket)
+    : m_socket(std::move(socket)) {}
+}
+
+  template<>
+  struct ImplementsConcept<Network::UringSocketReader, IO::Reader> :
+    std::true_type {};
+}
+
+#endif
@@ -0,0 +1,135 @@
+#ifndef BEAM_URING_SOCKET_WRITER_HPP
+#define BEAM_URING_SOCKET_WRITER_HPP
+#include <array>
+#include <cstring>
+#include <tuple>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include "Beam/IO/BufferSequence.hpp"
+#include "Beam/IO/EndOfFileException.hpp"
+#include "Beam/IO/IO.hpp"
+#include "Beam/IO/SharedBuffer.hpp"
+#include "Beam/IO/Writer.hpp"
+#include "Beam/Network/IoUringDetails.hpp"
+#include "Beam/Network/Network.hpp"
+#include "Beam/Network/SocketException.hpp"
+#include "Beam/Routines/Async.hpp"
+
+namespace Beam {
+namespace Network {
+
+  /** Writes to a TCP socket driven by io_uring. */
+  class UringSocketWriter {
+    public:
+      using Buffer = IO::SharedBuffer;
+
+      void Write(const void* data, std::size_t size);
+
+      template<typename BufferType>
+      void Write(const BufferType& data);
+
+      template<typename... B>
+      void Write(const IO::BufferSequence<B...>& buffers);
+
+    private:
+      friend class UringSocketChannel;
+      std::shared_ptr<Details::UringSocketEntry> m_socket;
+
+      UringSocketWriter(std::shared_ptr<Details::UringSocketEntry> socket);
+      UringSocketWriter(const UringSocketWriter&) = delete;
+      UringSocketWriter& operator =(const UringSocketWriter&) = delete;
+      void WriteVectors(iovec* vectors, std::size_t count);
+      int Send(iovec* vectors, std::size_t count);
+  };
+
+  inline void UringSocketWriter::Write(const void* data, std::size_t size) {
+    auto vector = iovec{const_cast<void*>(data), size};
+    WriteVectors(&vector, 1);
+  }
+
+  template<typename BufferType>
+  void UringSocketWriter::Write(const BufferType& data) {
+    Write(data.GetData(), data.GetSize());
+  }
+
+  template<typename... B>
+  void UringSocketWriter::Write(const IO::BufferSequence<B...>& buffers) {
+    auto vectors = std::apply([] (const auto&... buffer) {
+      return std::array{iovec{const_cast<char*>(buffer.GetData()),
+        buffer.GetSize()}...};
+    }, buffers.GetBuffers());
+    WriteVectors(vectors.data(), vectors.size());
+  }
+
+  inline void UringSocketWriter::WriteVectors(iovec* vectors,
+      std::size_t count) {
+    m_socket->BeginWriteOperation();
+    try {
+      auto lock = std::lock_guard(m_socket->m_writeMutex);
+      while(count != 0) {
+        auto result = Send(vectors, count);
+        if(result < 0) {
+          BOOST_THROW_EXCEPTION(SocketException(-result,
+            std::strerror(-result)));
+        }
+
+        /* A short send resumes from the first byte that wasn't written. */
+        auto remainder = static_cast<std::size_t>(result);
+        while(count != 0 && remainder >= vectors->iov_len) {
+          remainder -= vectors->iov_len;
+          ++vectors;
+          --count;
+        }
+        if(count != 0) {
+          vectors->iov_base = static_cast<char*>(vectors->iov_base) + remainder;
+          vectors->iov_len -= remainder;
+        }
+      }
+      m_socket->EndWriteOperation();
+    } catch(const std::exception&) {
+      m_socket->EndWriteOperation();
+      std::throw_with_nested(IO::EndOfFileException());
+    }
+  }
+
+  inline int UringSocketWriter::Send(iovec* vectors, std::size_t count) {
+    auto sendResult = Routines::Async<int>();
+    auto operation = Details::MakeUringOperation(
+      [&] (int result, std::uint32_t flags) {
+        sendResult.GetEval().SetResult(result);
+      });
+    auto message = msghdr();
+    message.msg_iov = vectors;
+    message.msg_iovlen = count;
+    m_socket->m_service->Submit(&operation, [&] (auto& entry) {
+      entry.fd = m_socket->m_fd;
+      entry.msg_flags = MSG_NOSIGNAL;
+      if(count == 1) {
+        entry.opcode = IORING_OP_SEND;
+        entry.addr = reinterpret_cast<std::uint64_t>(vectors->iov_base);
+        entry.len = static_cast<std::uint32_t>(vectors->iov_len);
+      } else {
+        entry.opcode = IORING_OP_SENDMSG;
+        entry.addr = reinterpret_cast<std::uint64_t>(&message);
+        entry.len = 1;
+      }
+    });
+    return sendResult.Get();
+  }
+
+  inline UringSocketWriter::UringSocketWriter(
+    std::shared_ptr<Details::UringSocketEntry> socket)
+    : m_socket(std::move(socket)) {}
+}
+
+  template<typename BufferType>
+  struct ImplementsConcept<Network::UringSocketWriter, IO::Writer<BufferType>> :
+    std::true_type {};
+
+namespace IO {
+  template<>
+  struct IsGatherWriter<Network::UringSocketWriter> : std::true_type {};
+}
+}
+
+#endif
@@ -77,6 +77,12 @@ namespace Beam::Python {
    */
   void ExportRoutineHandlerGroup(pybind11::module& module);
 
+  /**
+   * Exports the SchedulerStatistics class.
+   * @param module The module to export to.
+   */
+  void ExportSchedulerStatistics(pybind11::module& module);
+
   /**
    * Exports the Routines namespace.
    */
@@ -0,0 +1,292 @@
+#ifndef BEAM_MPSC_QUEUE_HPP
+#define BEAM_MPSC_QUEUE_HPP
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include "Beam/Queues/AbstractQueue.hpp"
+#include "Beam/Queues/PipeBrokenException.hpp"
+#include "Beam/Queues/Queues.hpp"
+#include "Beam/Threading/EventCount.hpp"
+
+namespace Beam {
+
+  /**
+   * Implements a lock-free Queue that any number of producers may push onto
+   * and a single consumer pops from, the consumer suspends only when the
+   * Queue is empty.
+   * @param <T> The data to store in the Queue.
+   */
+  template<typename T>
+  class MpscQueue : public AbstractQueue<T> {
+    public:
+      using Target = typename AbstractQueue<T>::Target;
+      using Source = typename AbstractQueue<T>::Source;
+
+      /** The capacity of the first ring of an unbounded MpscQueue. */
+      static constexpr auto INITIAL_CAPACITY = std::size_t(64);
+
+      /** Constructs an unbounded MpscQueue. */
+      MpscQueue();
+
+      /**
+       * Constructs an MpscQueue.
+       * @param capacity The maximum number of values stored, rounded up to a
+       *        power of two, once reached producers suspend until a value is
+       *        popped. A capacity of 0 makes the MpscQueue unbounded.
+       */
+      explicit MpscQueue(std::size_t capacity);
+
+      ~MpscQueue();
+
+      /** Returns <code>true</code> iff this Queue is broken. */
+      bool IsBroken() const;
+
+      Source Pop() override;
+
+      boost::optional<Source> TryPop() override;
+
+      void Push(const Target& value) override;
+
+      void Push(Target&& value) override;
+
+      void Break(const std::exception_ptr& exception) override;
+
+      using QueueWriter<T>::Break;
+
+    private:
+      static constexpr auto CLOSED =
+        std::size_t(1) << (8 * sizeof(std::size_t) - 1);
+      struct Cell {
+        std::atomic_size_t m_sequence;
+        std::aligned_storage_t<sizeof(T), alignof(T)> m_value;
+      };
+      struct Ring {
+        std::size_t m_mask;
+        std::unique_ptr<Cell[]> m_cells;
+        std::atomic<Ring*> m_next;
+        alignas(64) std::atomic_size_t m_tail;
+        alignas(64) std::size_t m_head;
+
+        explicit Ring(std::size_t capacity);
+      };
+      std::size_t m_capacity;
+      Ring* m_rings;
+      Ring* m_headRing;
+      alignas(64) std::atomic<Ring*> m_tailRing;
+      std::atomic_bool m_isBreaking;
+      std::atomic_bool m_isBroken;
+      std::exception_ptr m_breakException;
+      Threading::EventCount m_valueAvailable;
+      Threading::EventCount m_spaceAvailable;
+
+      static std::size_t GetRingCapacity(std::size_t capacity);
+      bool HasValue() const;
+      bool HasSpace() const;
+      template<typename U>
+      void Emplace(U&& value);
+  };
+
+  template<typename T>
+  MpscQueue<T>::Ring::Ring(std::size_t capacity)
+      : m_mask(capacity - 1),
+        m_cells(std::make_unique<Cell[]>(capacity)),
+        m_next(nullptr),
+        m_tail(0),
+        m_head(0) {
+    for(auto i = std::size_t(0); i != capacity; ++i) {
+      m_cells[i].m_sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  template<typename T>
+  MpscQueue<T>::MpscQueue()
+    : MpscQueue(0) {}
+
+  template<typename T>
+  MpscQueue<T>::MpscQueue(std::size_t capacity)
+      : m_capacity(capacity),
+        m_rings(new Ring(GetRingCapacity(capacity))),
+        m_headRing(m_rings),
+        m_tailRing(m_rings),
+        m_isBreaking(false),
+        m_isBroken(false) {}
+
+  template<typename T>
+  MpscQueue<T>::~MpscQueue() {
+    while(TryPop()) {}
+    while(m_rings) {
+      auto ring = m_rings;
+      m_rings = ring->m_next.load(std::memory_order_relaxed);
+      delete ring;
+    }
+  }
+
+  template<typename T>
+  bool MpscQueue<T>::IsBroken() const {
+    return m_isBroken.load(std::memory_order_acquire) && !HasValue();
+  }
+
+  template<typename T>
+  typename MpscQueue<T>::Source MpscQueue<T>::Pop() {
+    while(true) {
+      if(auto value = TryPop()) {
+        return std::move(*value);
+      }
+      if(m_isBroken.load(std::memory_order_acquire)) {
+        if(auto value = TryPop()) {
+          return std::move(*value);
+        }
+        std::rethrow_exception(m_breakException);
+      }
+      m_valueAvailable.Wait([&] {
+        return HasValue() || m_isBroken.load(std::memory_order_acquire);
+      });
+    }
+  }
+
+  template<typename T>
+  boost::optional<typename MpscQueue<T>::Source> MpscQueue<T>::TryPop() {
+    while(true) {
+      auto& ring = *m_headRing;
+      auto& cell = ring.m_cells[ring.m_head & ring.m_mask];
+      if(cell.m_sequence.load(std::memory_order_acquire) == ring.m_head + 1) {
+        auto& storedValue =
+          *std::launder(reinterpret_cast<T*>(&cell.m_value));
+        auto value = boost::optional<Source>(std::move(storedValue));
+        storedValue.~T();
+        cell.m_sequence.store(ring.m_head + ring.m_mask + 1,
+          std::memory_order_release);
+        ++ring.m_head;
+        if(m_capacity != 0) {
+          m_spaceAvailable.NotifyAll();
+        }
+        return value;
+      }
+
+      /* A closed ring that has been drained is never pushed onto again, the
+         remaining values are in the next ring. */
+      auto tail = ring.m_tail.load(std::memory_order_acquire);
+      if((tail & CLOSED) == 0 || (tail & ~CLOSED) != ring.m_head) {
+        return boost::none;
+      }
+      m_headRing = ring.m_next.load(std::memory_order_acquire);
+    }
+  }
+
+  template<typename T>
+  void MpscQueue<T>::Push(const Target& value) {
+
+    /* A slot that has been claimed must be filled, so a copy that may throw
+       is made before claiming one. */
+    if constexpr(std::is_nothrow_copy_constructible_v<T>) {
+      Emplace(value);
+    } else {
+      Emplace(T(value));
+    }
+  }
+
+  template<typename T>
+  void MpscQueue<T>::Push(Target&& value) {
+    Emplace(std::move(value));
+  }
+
+  template<typename T>
+  void MpscQueue<T>::Break(const std::exception_ptr& exception) {
+    if(m_isBreaking.exchange(true)) {
+      return;
+    }
+    m_breakException = exception;
+    m_isBroken.store(true, std::memory_order_release);
+    m_valueAvailable.NotifyAll();
+    m_spaceAvailable.NotifyAll();
+  }
+
+  template<typename T>
+  std::size_t MpscQueue<T>::GetRingCapacity(std::size_t capacity) {
+    if(capacity == 0) {
+      return INITIAL_CAPACITY;
+    }
+    auto ringCapacity = std::size_t(1);
+    while(ringCapacity < capacity) {
+      ringCapacity <<= 1;
+    }
+    return ringCapacity;
+  }
+
+  template<typename T>
+  bool MpscQueue<T>::HasValue() const {
+    auto& ring = *m_headRing;
+    auto& cell = ring.m_cells[ring.m_head & ring.m_mask];
+    if(cell.m_sequence.load(std::memory_order_acquire) == ring.m_head + 1) {
+      return true;
+    }
+    auto tail = ring.m_tail.load(std::memory_order_acquire);
+    return (tail & CLOSED) != 0 && (tail & ~CLOSED) == ring.m_head;
+  }
+
+  template<typename T>
+  bool MpscQueue<T>::HasSpace() const {
+    auto& ring = *m_tailRing.load(std::memory_order_acquire);
+    auto position = ring.m_tail.load(std::memory_order_relaxed);
+    auto& cell = ring.m_cells[position & ring.m_mask];
+    return static_cast<std::intptr_t>(cell.m_sequence.load(
+      std::memory_order_acquire) - position) >= 0;
+  }
+
+  template<typename T>
+  template<typename U>
+  void MpscQueue<T>::Emplace(U&& value) {
+    while(true) {
+      if(m_isBroken.load(std::memory_order_acquire)) {
+        std::rethrow_exception(m_breakException);
+      }
+      auto ring = m_tailRing.load(std::memory_order_acquire);
+      auto position = ring->m_tail.load(std::memory_order_relaxed);
+      while((position & CLOSED) == 0) {
+        auto& cell = ring->m_cells[position & ring->m_mask];
+        auto difference = static_cast<std::intptr_t>(
+          cell.m_sequence.load(std::memory_order_acquire) - position);
+        if(difference == 0) {
+          if(ring->m_tail.compare_exchange_weak(position, position + 1,
+              std::memory_order_relaxed)) {
+            new(&cell.m_value) T(std::forward<U>(value));
+            cell.m_sequence.store(position + 1, std::memory_order_release);
+            m_valueAvailable.NotifyAll();
+            return;
+          }
+        } else if(difference > 0) {
+          position = ring->m_tail.load(std::memory_order_relaxed);
+        } else if(m_capacity != 0) {
+          m_spaceAvailable.Wait([&] {
+            return HasSpace() || m_isBroken.load(std::memory_order_acquire);
+          });
+          if(m_isBroken.load(std::memory_order_acquire)) {
+            std::rethrow_exception(m_breakException);
+          }
+          position = ring->m_tail.load(std::memory_order_relaxed);
+        } else {
+
+          /* The ring is full, link a larger ring and close this one so that
+             the consumer knows when it has been drained. */
+          auto next = ring->m_next.load(std::memory_order_acquire);
+          if(!next) {
+            auto nextRing = std::make_unique<Ring>(2 * (ring->m_mask + 1));
+            if(ring->m_next.compare_exchange_strong(next, nextRing.get(),
+                std::memory_order_acq_rel)) {
+              next = nextRing.release();
+            }
+          }
+          ring->m_tail.compare_exchange_strong(position, position | CLOSED,
+            std::memory_order_acq_rel);
+        }
+      }
+      m_tailRing.compare_exchange_strong(ring,
+        ring->m_next.load(std::memory_order_acquire),
+        std::memory_order_acq_rel);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,45 @@
+#ifndef BEAM_OVERFLOW_POLICY_HPP
+#define BEAM_OVERFLOW_POLICY_HPP
+#include <ostream>
+#include "Beam/Queues/Queues.hpp"
+
+namespace Beam {
+
+  /**
+   * Enumerates what a bounded Queue does with a value pushed onto it once it
+   * is full.
+   */
+  enum class OverflowPolicy {
+
+    /** Suspends the producer until a value is popped. */
+    BLOCK,
+
+    /** Discards the oldest value to make room for the new one. */
+    DROP_OLDEST,
+
+    /** Discards the value being pushed. */
+    DROP_NEWEST,
+
+    /**
+     * Replaces a pending value with the same key as the value being pushed,
+     * and otherwise discards the oldest value.
+     */
+    CONFLATE
+  };
+
+  inline std::ostream& operator <<(std::ostream& out, OverflowPolicy policy) {
+    if(policy == OverflowPolicy::BLOCK) {
+      return out << "BLOCK";
+    } else if(policy == OverflowPolicy::DROP_OLDEST) {
+      return out << "DROP_OLDEST";
+    } else if(policy == OverflowPolicy::DROP_NEWEST) {
+      return out << "DROP_NEWEST";
+    } else if(policy == OverflowPolicy::CONFLATE) {
+      return out << "CONFLATE";
+    } else {
+      return out << "NONE";
+    }
+  }
+}
+
+#endif
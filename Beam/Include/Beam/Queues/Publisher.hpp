@@ -5,6 +5,8 @@
 #include <type_traits>
 #include <boost/optional/optional.hpp>
 #include "Beam/Pointers/Dereference.hpp"
+#include "Beam/Queues/OverflowPolicy.hpp"
+#include "Beam/Queues/Queue.hpp"
 #include "Beam/Queues/Queues.hpp"
 #include "Beam/Queues/ScopedQueueWriter.hpp"
 
@@ -70,6 +72,40 @@ namespace Beam {
   template<typename P>
   using GetPublisherType = typename PublisherType<P>::type;
 
+  /**
+   * Monitors a Publisher through a bounded Queue so that a stalled subscriber
+   * can not grow without limit. Under the BLOCK policy a full Queue suspends
+   * the publishing Routine, propagating backpressure to the producer.
+   * @param publisher The Publisher to monitor.
+   * @param capacity The maximum number of pending updates.
+   * @param policy What to do with an update published to a full Queue.
+   * @return The Queue receiving the updates.
+   */
+  template<typename T>
+  std::shared_ptr<Queue<T>> MonitorBounded(const Publisher<T>& publisher,
+      std::size_t capacity, OverflowPolicy policy) {
+    auto queue = std::make_shared<Queue<T>>(capacity, policy);
+    publisher.Monitor(queue);
+    return queue;
+  }
+
+  /**
+   * Monitors a Publisher through a bounded Queue that conflates updates with
+   * the same key.
+   * @param publisher The Publisher to monitor.
+   * @param capacity The maximum number of pending updates.
+   * @param getKey Returns the key of an update.
+   * @return The Queue receiving the updates.
+   */
+  template<typename T, typename F, typename = std::enable_if_t<
+    std::is_invocable_v<const F&, const T&>>>
+  std::shared_ptr<Queue<T>> MonitorBounded(const Publisher<T>& publisher,
+      std::size_t capacity, F getKey) {
+    auto queue = std::make_shared<Queue<T>>(capacity, std::move(getKey));
+    publisher.Monitor(queue);
+    return queue;
+  }
+
   template<typename F, typename>
   decltype(auto) BasePublisher::With(F&& f) const {
     using R = std::invoke_result_t<F>;
@@ -1,9 +1,20 @@
 #ifndef BEAM_QUEUE_HPP
 #define BEAM_QUEUE_HPP
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
 #include <deque>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
 #include <boost/thread/mutex.hpp>
 #include "Beam/Queues/AbstractQueue.hpp"
+#include "Beam/Queues/OverflowPolicy.hpp"
 #include "Beam/Queues/PipeBrokenException.hpp"
+#include "Beam/Queues/QueueStatistics.hpp"
 #include "Beam/Queues/Queues.hpp"
 #include "Beam/Threading/ConditionVariable.hpp"
 
@@ -20,16 +31,43 @@ namespace Beam {
       using Target = typename AbstractQueue<T>::Target;
       using Source = typename AbstractQueue<T>::Source;
 
-      /** Constructs a Queue. */
-      Queue() = default;
+      /** Constructs an unbounded Queue. */
+      Queue();
+
+      /**
+       * Constructs a bounded Queue.
+       * @param capacity The maximum number of values stored.
+       * @param policy What to do with a value pushed onto a full Queue, a
+       *        CONFLATE policy without a key function behaves as DROP_OLDEST.
+       */
+      Queue(std::size_t capacity, OverflowPolicy policy);
+
+      /**
+       * Constructs a conflating Queue, a pushed value replaces any pending
+       * value with the same key.
+       * @param capacity The maximum number of values stored, once reached a
+       *        value with a new key discards the oldest value.
+       * @param getKey Returns the key of a value, the key must be equality
+       *        comparable and hashable with std::hash.
+       */
+      template<typename F, typename = std::enable_if_t<
+        std::is_invocable_v<const F&, const T&>>>
+      Queue(std::size_t capacity, F getKey);
 
       /** Returns <code>true</code> iff this Queue is broken. */
       bool IsBroken() const;
 
+      /** Returns the counts of dropped values and blocked time. */
+      QueueStatistics GetStatistics() const;
+
       Source Pop() override;
 
       boost::optional<Source> TryPop() override;
 
+      void PopAll(Out<std::vector<Source>> values) override;
+
+      std::vector<Source> TryPopAll(std::size_t max) override;
+
       void Push(const Target& value) override;
 
       void Push(Target&& value) override;
@@ -41,18 +79,66 @@ namespace Beam {
     private:
       mutable boost::mutex m_mutex;
       mutable Threading::ConditionVariable m_isAvailableCondition;
+      Threading::ConditionVariable m_isSpaceAvailableCondition;
       std::deque<T> m_queue;
       std::exception_ptr m_breakException;
+      std::size_t m_capacity;
+      OverflowPolicy m_policy;
+      std::function<std::size_t (const T&)> m_hashKey;
+      std::function<bool (const T&, const T&)> m_isSameKey;
+      std::unordered_multimap<std::size_t, std::uint64_t> m_keys;
+      std::uint64_t m_frontSequence;
+      std::uint64_t m_dropCount;
+      std::chrono::steady_clock::duration m_blockedTime;
 
       bool UnlockedIsAvailable() const;
+      void UnlockedRemoveKey(std::uint64_t sequence);
+      T UnlockedPopFront();
+      void UnlockedPopFront(std::size_t count,
+        std::vector<Source>& values);
+      template<typename U>
+      void Emplace(U&& value);
   };
 
+  template<typename T>
+  Queue<T>::Queue()
+    : Queue(std::numeric_limits<std::size_t>::max(), OverflowPolicy::BLOCK) {}
+
+  template<typename T>
+  Queue<T>::Queue(std::size_t capacity, OverflowPolicy policy)
+    : m_capacity(std::max<std::size_t>(capacity, 1)),
+      m_policy(policy),
+      m_frontSequence(0),
+      m_dropCount(0),
+      m_blockedTime(0) {}
+
+  template<typename T>
+  template<typename F, typename>
+  Queue<T>::Queue(std::size_t capacity, F getKey)
+      : Queue(capacity, OverflowPolicy::CONFLATE) {
+    m_hashKey = [=] (const T& value) {
+      using Key = std::decay_t<std::invoke_result_t<const F&, const T&>>;
+      return std::hash<Key>()(getKey(value));
+    };
+    m_isSameKey = [=] (const T& left, const T& right) {
+      return getKey(left) == getKey(right);
+    };
+  }
+
   template<typename T>
   bool Queue<T>::IsBroken() const {
     auto lock = boost::lock_guard(m_mutex);
     return m_breakException != nullptr && m_queue.empty();
   }
 
+  template<typename T>
+  QueueStatistics Queue<T>::GetStatistics() const {
+    auto lock = boost::lock_guard(m_mutex);
+    return QueueStatistics{m_dropCount, boost::posix_time::microseconds(
+      std::chrono::duration_cast<std::chrono::microseconds>(
+        m_blockedTime).count())};
+  }
+
   template<typename T>
   typename Queue<T>::Source Queue<T>::Pop() {
     auto lock = boost::unique_lock(m_mutex);
@@ -62,9 +148,7 @@ namespace Beam {
     if(m_queue.empty()) {
       std::rethrow_exception(m_breakException);
     }
-    auto value = std::move(m_queue.front());
-    m_queue.pop_front();
-    return value;
+    return UnlockedPopFront();
   }
 
   template<typename T>
@@ -73,33 +157,38 @@ namespace Beam {
     if(m_queue.empty()) {
       return boost::none;
     }
-    auto value = std::move(m_queue.front());
-    m_queue.pop_front();
-    return value;
+    return UnlockedPopFront();
   }
 
   template<typename T>
-  void Queue<T>::Push(const Target& value) {
-    auto lock = boost::lock_guard(m_mutex);
-    if(m_breakException != nullptr) {
-      std::rethrow_exception(m_breakException);
+  void Queue<T>::PopAll(Out<std::vector<Source>> values) {
+    auto lock = boost::unique_lock(m_mutex);
+    while(!UnlockedIsAvailable()) {
+      m_isAvailableCondition.wait(lock);
     }
-    m_queue.push_back(value);
-    if(m_queue.size() == 1) {
-      m_isAvailableCondition.notify_one();
+    if(m_queue.empty()) {
+      std::rethrow_exception(m_breakException);
     }
+    UnlockedPopFront(m_queue.size(), *values);
   }
 
   template<typename T>
-  void Queue<T>::Push(Target&& value) {
+  std::vector<typename Queue<T>::Source> Queue<T>::TryPopAll(
+      std::size_t max) {
+    auto values = std::vector<Source>();
     auto lock = boost::lock_guard(m_mutex);
-    if(m_breakException != nullptr) {
-      std::rethrow_exception(m_breakException);
-    }
-    m_queue.push_back(std::move(value));
-    if(m_queue.size() == 1) {
-      m_isAvailableCondition.notify_one();
-    }
+    UnlockedPopFront(std::min(max, m_queue.size()), values);
+    return values;
+  }
+
+  template<typename T>
+  void Queue<T>::Push(const Target& value) {
+    Emplace(value);
+  }
+
+  template<typename T>
+  void Queue<T>::Push(Target&& value) {
+    Emplace(std::move(value));
   }
 
   template<typename T>
@@ -110,12 +199,116 @@ namespace Beam {
     }
     m_breakException = exception;
     m_isAvailableCondition.notify_all();
+    m_isSpaceAvailableCondition.notify_all();
   }
 
   template<typename T>
   bool Queue<T>::UnlockedIsAvailable() const {
     return !m_queue.empty() || m_breakException;
   }
+
+  template<typename T>
+  void Queue<T>::UnlockedRemoveKey(std::uint64_t sequence) {
+    if(!m_hashKey) {
+      return;
+    }
+    auto keys = m_keys.equal_range(
+      m_hashKey(m_queue[sequence - m_frontSequence]));
+    for(auto i = keys.first; i != keys.second; ++i) {
+      if(i->second == sequence) {
+        m_keys.erase(i);
+        return;
+      }
+    }
+  }
+
+  template<typename T>
+  T Queue<T>::UnlockedPopFront() {
+    UnlockedRemoveKey(m_frontSequence);
+    auto value = std::move(m_queue.front());
+    m_queue.pop_front();
+    ++m_frontSequence;
+
+    /* Every pop frees a slot, notifying only on the transition from full
+       could strand a second blocked producer. */
+    if(m_policy == OverflowPolicy::BLOCK &&
+        m_capacity != std::numeric_limits<std::size_t>::max()) {
+      m_isSpaceAvailableCondition.notify_one();
+    }
+    return value;
+  }
+
+  template<typename T>
+  void Queue<T>::UnlockedPopFront(std::size_t count,
+      std::vector<Source>& values) {
+    if(count == 0) {
+      return;
+    }
+    for(auto i = std::size_t(0); i != count; ++i) {
+      UnlockedRemoveKey(m_frontSequence + i);
+    }
+    values.reserve(values.size() + count);
+    auto end = m_queue.begin() + count;
+    values.insert(values.end(), std::make_move_iterator(m_queue.begin()),
+      std::make_move_iterator(end));
+    m_queue.erase(m_queue.begin(), end);
+    m_frontSequence += count;
+    if(m_policy == OverflowPolicy::BLOCK &&
+        m_capacity != std::numeric_limits<std::size_t>::max()) {
+      m_isSpaceAvailableCondition.notify_all();
+    }
+  }
+
+  template<typename T>
+  template<typename U>
+  void Queue<T>::Emplace(U&& value) {
+    auto lock = boost::unique_lock(m_mutex);
+    if(m_breakException != nullptr) {
+      std::rethrow_exception(m_breakException);
+    }
+    auto hash = std::size_t(0);
+    if(m_hashKey) {
+      hash = m_hashKey(value);
+      if constexpr(std::is_assignable_v<T&, U&&>) {
+        auto keys = m_keys.equal_range(hash);
+        for(auto i = keys.first; i != keys.second; ++i) {
+          auto& pending = m_queue[i->second - m_frontSequence];
+          if(m_isSameKey(pending, value)) {
+            pending = std::forward<U>(value);
+            ++m_dropCount;
+            return;
+          }
+        }
+      }
+    }
+    if(m_queue.size() >= m_capacity) {
+      if(m_policy == OverflowPolicy::BLOCK) {
+        auto start = std::chrono::steady_clock::now();
+        while(m_queue.size() >= m_capacity && !m_breakException) {
+          m_isSpaceAvailableCondition.wait(lock);
+        }
+        m_blockedTime += std::chrono::steady_clock::now() - start;
+        if(m_breakException != nullptr) {
+          std::rethrow_exception(m_breakException);
+        }
+      } else if(m_policy == OverflowPolicy::DROP_NEWEST) {
+        ++m_dropCount;
+        return;
+      } else {
+        UnlockedRemoveKey(m_frontSequence);
+        m_queue.pop_front();
+        ++m_frontSequence;
+        ++m_dropCount;
+      }
+    }
+    if(m_hashKey) {
+      m_keys.emplace(hash, m_frontSequence + m_queue.size());
+    }
+    m_queue.push_back(std::forward<U>(value));
+    if(m_queue.size() == 1) {
+      m_isAvailableCondition.notify_one();
+    }
+  }
 }
 
 #endif
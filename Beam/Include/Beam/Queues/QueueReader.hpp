@@ -1,6 +1,8 @@
 #ifndef BEAM_QUEUE_READER_HPP
 #define BEAM_QUEUE_READER_HPP
+#include <limits>
 #include <type_traits>
+#include <vector>
 #include <boost/optional/optional.hpp>
 #include "Beam/Pointers/Dereference.hpp"
 #include "Beam/Pointers/Out.hpp"
@@ -31,6 +33,20 @@ namespace Beam {
        * without blocking, otherwise returns <i>boost::none</i>.
        */
       virtual boost::optional<Source> TryPop() = 0;
+
+      /**
+       * Pops all available values, blocking until at least one value is
+       * available.
+       * @param values The vector to append the popped values to.
+       */
+      virtual void PopAll(Out<std::vector<Source>> values);
+
+      /**
+       * Pops available values without blocking.
+       * @param max The maximum number of values to pop.
+       * @return The popped values, empty if no value was available.
+       */
+      virtual std::vector<Source> TryPopAll(std::size_t max);
   };
 
   /**
@@ -72,6 +88,28 @@ namespace Beam {
       breakCallback(std::current_exception());
     }
   }
+
+  template<typename T>
+  void QueueReader<T>::PopAll(Out<std::vector<Source>> values) {
+    values->push_back(Pop());
+    while(auto value = TryPop()) {
+      values->push_back(std::move(*value));
+    }
+  }
+
+  template<typename T>
+  std::vector<typename QueueReader<T>::Source> QueueReader<T>::TryPopAll(
+      std::size_t max) {
+    auto values = std::vector<Source>();
+    while(values.size() < max) {
+      if(auto value = TryPop()) {
+        values.push_back(std::move(*value));
+      } else {
+        break;
+      }
+    }
+    return values;
+  }
 }
 
 #endif
@@ -0,0 +1,20 @@
+#ifndef BEAM_QUEUE_STATISTICS_HPP
+#define BEAM_QUEUE_STATISTICS_HPP
+#include <cstdint>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include "Beam/Queues/Queues.hpp"
+
+namespace Beam {
+
+  /** Stores a snapshot of the overflow activity of a bounded Queue. */
+  struct QueueStatistics {
+
+    /** The number of values discarded or replaced because of overflow. */
+    std::uint64_t m_dropCount;
+
+    /** The total time producers spent suspended waiting for space. */
+    boost::posix_time::time_duration m_blockedTime;
+  };
+}
+
+#endif
@@ -12,6 +12,7 @@ namespace Beam {
   template<typename T, typename C> class ConverterQueueWriter;
   template<typename T, typename F> class FilteredQueueReader;
   template<typename T, typename F> class FilteredQueueWriter;
+  template<typename T> class MpscQueue;
   template<typename T> class MultiQueueWriter;
   class PipeBrokenException;
   template<typename T> class Publisher;
@@ -19,6 +20,7 @@ namespace Beam {
   template<typename T, typename U> class QueuePipe;
   template<typename T> class QueueReader;
   template<typename T, typename Q> class QueueReaderPublisher;
+  struct QueueStatistics;
   template<typename T> class QueueWriter;
   template<typename T> class QueueWriterPublisher;
   template<typename Q> class ScopedBaseQueue;
@@ -26,6 +28,7 @@ namespace Beam {
   template<typename T, typename Q> class ScopedQueueWriter;
   template<typename T, typename S> class SequencePublisher;
   template<typename T, typename S> class SnapshotPublisher;
+  template<typename T> class SpscQueue;
   template<typename T> class StatePublisher;
   template<typename T> class StateQueue;
   template<typename K, typename V> class TablePublisher;
@@ -1,5 +1,6 @@
 #ifndef BEAM_ROUTINE_TASK_QUEUE_HPP
 #define BEAM_ROUTINE_TASK_QUEUE_HPP
+#include <memory>
 #include "Beam/Queues/Queues.hpp"
 #include "Beam/Queues/TaskQueue.hpp"
 #include "Beam/Routines/RoutineHandler.hpp"
@@ -16,6 +17,12 @@ namespace Beam {
       /** Constructs a RoutineTaskQueue. */
       RoutineTaskQueue();
 
+      /**
+       * Constructs a RoutineTaskQueue storing its tasks in a specified Queue.
+       * @param tasks The Queue to store the tasks in.
+       */
+      explicit RoutineTaskQueue(std::unique_ptr<AbstractQueue<Target>> tasks);
+
       ~RoutineTaskQueue();
 
       /**
@@ -72,6 +79,11 @@ namespace Beam {
   inline RoutineTaskQueue::RoutineTaskQueue()
     : m_routine(SpawnTaskRoutine(&m_tasks)) {}
 
+  inline RoutineTaskQueue::RoutineTaskQueue(
+      std::unique_ptr<AbstractQueue<Target>> tasks)
+      : m_tasks(std::move(tasks)),
+        m_routine(SpawnTaskRoutine(&m_tasks)) {}
+
   inline RoutineTaskQueue::~RoutineTaskQueue() {
     Break();
   }
@@ -3,6 +3,7 @@
 #include <memory>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include "Beam/Pointers/Dereference.hpp"
 #include "Beam/Pointers/LocalPtr.hpp"
 #include "Beam/Queues/Queues.hpp"
@@ -45,6 +46,10 @@ namespace Beam {
 
       boost::optional<Source> TryPop() override;
 
+      void PopAll(Out<std::vector<Source>> values) override;
+
+      std::vector<Source> TryPopAll(std::size_t max) override;
+
       void Break(const std::exception_ptr& e) override;
 
       ScopedQueueReader& operator =(ScopedQueueReader&& queue);
@@ -97,6 +102,17 @@ namespace Beam {
     return m_queue->TryPop();
   }
 
+  template<typename T, typename Q>
+  void ScopedQueueReader<T, Q>::PopAll(Out<std::vector<Source>> values) {
+    m_queue->PopAll(Store(values));
+  }
+
+  template<typename T, typename Q>
+  std::vector<typename ScopedQueueReader<T, Q>::Source>
+      ScopedQueueReader<T, Q>::TryPopAll(std::size_t max) {
+    return m_queue->TryPopAll(max);
+  }
+
   template<typename T, typename Q>
   void ScopedQueueReader<T, Q>::Break(const std::exception_ptr& e) {
     if(m_queue) {
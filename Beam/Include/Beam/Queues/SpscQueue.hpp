@@ -0,0 +1,257 @@
+#ifndef BEAM_SPSC_QUEUE_HPP
+#define BEAM_SPSC_QUEUE_HPP
+#include <atomic>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include "Beam/Queues/AbstractQueue.hpp"
+#include "Beam/Queues/PipeBrokenException.hpp"
+#include "Beam/Queues/Queues.hpp"
+#include "Beam/Threading/EventCount.hpp"
+
+namespace Beam {
+
+  /**
+   * Implements a lock-free Queue with a single producer and a single consumer,
+   * the consumer suspends only when the Queue is empty.
+   * @param <T> The data to store in the Queue.
+   */
+  template<typename T>
+  class SpscQueue : public AbstractQueue<T> {
+    public:
+      using Target = typename AbstractQueue<T>::Target;
+      using Source = typename AbstractQueue<T>::Source;
+
+      /** The capacity of the first ring of an unbounded SpscQueue. */
+      static constexpr auto INITIAL_CAPACITY = std::size_t(64);
+
+      /** Constructs an unbounded SpscQueue. */
+      SpscQueue();
+
+      /**
+       * Constructs an SpscQueue.
+       * @param capacity The maximum number of values stored, rounded up to a
+       *        power of two, once reached the producer suspends until a value
+       *        is popped. A capacity of 0 makes the SpscQueue unbounded.
+       */
+      explicit SpscQueue(std::size_t capacity);
+
+      ~SpscQueue();
+
+      /** Returns <code>true</code> iff this Queue is broken. */
+      bool IsBroken() const;
+
+      Source Pop() override;
+
+      boost::optional<Source> TryPop() override;
+
+      void Push(const Target& value) override;
+
+      void Push(Target&& value) override;
+
+      void Break(const std::exception_ptr& exception) override;
+
+      using QueueWriter<T>::Break;
+
+    private:
+      struct Ring {
+        std::size_t m_mask;
+        std::unique_ptr<std::aligned_storage_t<sizeof(T), alignof(T)>[]>
+          m_values;
+        std::atomic<Ring*> m_next;
+        alignas(64) std::atomic_size_t m_tail;
+        alignas(64) std::atomic_size_t m_head;
+
+        explicit Ring(std::size_t capacity);
+        T& Get(std::size_t position);
+      };
+      std::size_t m_capacity;
+      alignas(64) Ring* m_headRing;
+      std::size_t m_cachedTail;
+      alignas(64) Ring* m_tailRing;
+      std::size_t m_cachedHead;
+      std::atomic_bool m_isBreaking;
+      std::atomic_bool m_isBroken;
+      std::exception_ptr m_breakException;
+      Threading::EventCount m_valueAvailable;
+      Threading::EventCount m_spaceAvailable;
+
+      bool HasValue() const;
+      bool HasSpace() const;
+      template<typename U>
+      void Emplace(U&& value);
+  };
+
+  template<typename T>
+  SpscQueue<T>::Ring::Ring(std::size_t capacity)
+    : m_mask(capacity - 1),
+      m_values(std::make_unique<
+        std::aligned_storage_t<sizeof(T), alignof(T)>[]>(capacity)),
+      m_next(nullptr),
+      m_tail(0),
+      m_head(0) {}
+
+  template<typename T>
+  T& SpscQueue<T>::Ring::Get(std::size_t position) {
+    return *std::launder(reinterpret_cast<T*>(&m_values[position & m_mask]));
+  }
+
+  template<typename T>
+  SpscQueue<T>::SpscQueue()
+    : SpscQueue(0) {}
+
+  template<typename T>
+  SpscQueue<T>::SpscQueue(std::size_t capacity)
+      : m_capacity(capacity),
+        m_cachedTail(0),
+        m_cachedHead(0),
+        m_isBreaking(false),
+        m_isBroken(false) {
+    auto ringCapacity = INITIAL_CAPACITY;
+    if(m_capacity != 0) {
+      ringCapacity = 1;
+      while(ringCapacity < m_capacity) {
+        ringCapacity <<= 1;
+      }
+    }
+    m_headRing = new Ring(ringCapacity);
+    m_tailRing = m_headRing;
+  }
+
+  template<typename T>
+  SpscQueue<T>::~SpscQueue() {
+    while(TryPop()) {}
+    delete m_headRing;
+  }
+
+  template<typename T>
+  bool SpscQueue<T>::IsBroken() const {
+    return m_isBroken.load(std::memory_order_acquire) && !HasValue();
+  }
+
+  template<typename T>
+  typename SpscQueue<T>::Source SpscQueue<T>::Pop() {
+    while(true) {
+      if(auto value = TryPop()) {
+        return std::move(*value);
+      }
+      if(m_isBroken.load(std::memory_order_acquire)) {
+        if(auto value = TryPop()) {
+          return std::move(*value);
+        }
+        std::rethrow_exception(m_breakException);
+      }
+      m_valueAvailable.Wait([&] {
+        return HasValue() || m_isBroken.load(std::memory_order_acquire);
+      });
+    }
+  }
+
+  template<typename T>
+  boost::optional<typename SpscQueue<T>::Source> SpscQueue<T>::TryPop() {
+    while(true) {
+      auto& ring = *m_headRing;
+      auto head = ring.m_head.load(std::memory_order_relaxed);
+      if(head == m_cachedTail) {
+        m_cachedTail = ring.m_tail.load(std::memory_order_acquire);
+        if(head == m_cachedTail) {
+
+          /* The producer stops pushing onto a ring before linking the next
+             one, so once linked, a drained ring can be released. */
+          auto next = ring.m_next.load(std::memory_order_acquire);
+          if(!next) {
+            return boost::none;
+          }
+          m_cachedTail = ring.m_tail.load(std::memory_order_acquire);
+          if(head != m_cachedTail) {
+            continue;
+          }
+          m_headRing = next;
+          m_cachedTail = 0;
+          delete &ring;
+          continue;
+        }
+      }
+      auto& storedValue = ring.Get(head);
+      auto value = boost::optional<Source>(std::move(storedValue));
+      storedValue.~T();
+      ring.m_head.store(head + 1, std::memory_order_release);
+      if(m_capacity != 0) {
+        m_spaceAvailable.NotifyAll();
+      }
+      return value;
+    }
+  }
+
+  template<typename T>
+  void SpscQueue<T>::Push(const Target& value) {
+    Emplace(value);
+  }
+
+  template<typename T>
+  void SpscQueue<T>::Push(Target&& value) {
+    Emplace(std::move(value));
+  }
+
+  template<typename T>
+  void SpscQueue<T>::Break(const std::exception_ptr& exception) {
+    if(m_isBreaking.exchange(true)) {
+      return;
+    }
+    m_breakException = exception;
+    m_isBroken.store(true, std::memory_order_release);
+    m_valueAvailable.NotifyAll();
+    m_spaceAvailable.NotifyAll();
+  }
+
+  template<typename T>
+  bool SpscQueue<T>::HasValue() const {
+    auto& ring = *m_headRing;
+    return ring.m_head.load(std::memory_order_relaxed) !=
+      ring.m_tail.load(std::memory_order_acquire) ||
+      ring.m_next.load(std::memory_order_acquire);
+  }
+
+  template<typename T>
+  bool SpscQueue<T>::HasSpace() const {
+    auto& ring = *m_tailRing;
+    return ring.m_tail.load(std::memory_order_relaxed) -
+      ring.m_head.load(std::memory_order_acquire) <= ring.m_mask;
+  }
+
+  template<typename T>
+  template<typename U>
+  void SpscQueue<T>::Emplace(U&& value) {
+    if(m_isBroken.load(std::memory_order_acquire)) {
+      std::rethrow_exception(m_breakException);
+    }
+    auto ring = m_tailRing;
+    auto tail = ring->m_tail.load(std::memory_order_relaxed);
+    if(tail - m_cachedHead > ring->m_mask) {
+      m_cachedHead = ring->m_head.load(std::memory_order_acquire);
+      if(tail - m_cachedHead > ring->m_mask) {
+        if(m_capacity != 0) {
+          m_spaceAvailable.Wait([&] {
+            return HasSpace() || m_isBroken.load(std::memory_order_acquire);
+          });
+          if(m_isBroken.load(std::memory_order_acquire)) {
+            std::rethrow_exception(m_breakException);
+          }
+          m_cachedHead = ring->m_head.load(std::memory_order_acquire);
+        } else {
+          auto next = new Ring(2 * (ring->m_mask + 1));
+          ring->m_next.store(next, std::memory_order_release);
+          ring = next;
+          m_tailRing = next;
+          m_cachedHead = 0;
+          tail = 0;
+        }
+      }
+    }
+    new(&ring->m_values[tail & ring->m_mask]) T(std::forward<U>(value));
+    ring->m_tail.store(tail + 1, std::memory_order_release);
+    m_valueAvailable.NotifyAll();
+  }
+}
+
+#endif
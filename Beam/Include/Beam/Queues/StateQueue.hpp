@@ -1,9 +1,14 @@
 #ifndef BEAM_STATE_QUEUE_HPP
 #define BEAM_STATE_QUEUE_HPP
+#include <chrono>
+#include <cstdint>
+#include <vector>
 #include <boost/optional/optional.hpp>
 #include <boost/thread/mutex.hpp>
 #include "Beam/Queues/AbstractQueue.hpp"
+#include "Beam/Queues/OverflowPolicy.hpp"
 #include "Beam/Queues/PipeBrokenException.hpp"
+#include "Beam/Queues/QueueStatistics.hpp"
 #include "Beam/Queues/Queues.hpp"
 #include "Beam/Threading/ConditionVariable.hpp"
 
@@ -19,8 +24,18 @@ namespace Beam {
       using Target = typename AbstractQueue<T>::Target;
       using Source = typename AbstractQueue<T>::Source;
 
-      /** Constructs a StateQueue. */
-      StateQueue() = default;
+      /** Constructs a StateQueue that overwrites its pending value. */
+      StateQueue();
+
+      /**
+       * Constructs a StateQueue.
+       * @param policy What to do with a value pushed while one is pending,
+       *        DROP_OLDEST and CONFLATE overwrite the pending value.
+       */
+      explicit StateQueue(OverflowPolicy policy);
+
+      /** Returns the counts of dropped values and blocked time. */
+      QueueStatistics GetStatistics() const;
 
       /** Blocks until a value is available and returns it without popping. */
       Source Peek() const;
@@ -29,6 +44,10 @@ namespace Beam {
 
       boost::optional<Source> TryPop() override;
 
+      void PopAll(Out<std::vector<Source>> values) override;
+
+      std::vector<Source> TryPopAll(std::size_t max) override;
+
       void Push(const Target& value) override;
 
       void Push(Target&& value) override;
@@ -40,12 +59,37 @@ namespace Beam {
     private:
       mutable boost::mutex m_mutex;
       mutable Threading::ConditionVariable m_isAvailableCondition;
+      Threading::ConditionVariable m_isSpaceAvailableCondition;
       boost::optional<Target> m_value;
       std::exception_ptr m_breakException;
+      OverflowPolicy m_policy;
+      std::uint64_t m_dropCount;
+      std::chrono::steady_clock::duration m_blockedTime;
 
       bool UnlockedIsAvailable() const;
+      void UnlockedClear();
+      template<typename U>
+      void Emplace(U&& value);
   };
 
+  template<typename T>
+  StateQueue<T>::StateQueue()
+    : StateQueue(OverflowPolicy::DROP_OLDEST) {}
+
+  template<typename T>
+  StateQueue<T>::StateQueue(OverflowPolicy policy)
+    : m_policy(policy),
+      m_dropCount(0),
+      m_blockedTime(0) {}
+
+  template<typename T>
+  QueueStatistics StateQueue<T>::GetStatistics() const {
+    auto lock = boost::lock_guard(m_mutex);
+    return QueueStatistics{m_dropCount, boost::posix_time::microseconds(
+      std::chrono::duration_cast<std::chrono::microseconds>(
+        m_blockedTime).count())};
+  }
+
   template<typename T>
   typename StateQueue<T>::Source StateQueue<T>::Peek() const {
     auto lock = boost::unique_lock(m_mutex);
@@ -68,7 +112,7 @@ namespace Beam {
       std::rethrow_exception(m_breakException);
     }
     auto value = std::move(*m_value);
-    m_value = boost::none;
+    UnlockedClear();
     return value;
   }
 
@@ -79,36 +123,43 @@ namespace Beam {
       return boost::none;
     }
     auto value = std::move(*m_value);
-    m_value = boost::none;
+    UnlockedClear();
     return value;
   }
 
   template<typename T>
-  void StateQueue<T>::Push(const Target& value) {
-    auto lock = boost::lock_guard(m_mutex);
-    if(m_breakException) {
-      std::rethrow_exception(m_breakException);
+  void StateQueue<T>::PopAll(Out<std::vector<Source>> values) {
+    auto lock = boost::unique_lock(m_mutex);
+    while(!UnlockedIsAvailable()) {
+      m_isAvailableCondition.wait(lock);
     }
-    if(m_value) {
-      *m_value = value;
-    } else {
-      m_value.emplace(value);
-      m_isAvailableCondition.notify_one();
+    if(!m_value) {
+      std::rethrow_exception(m_breakException);
     }
+    values->push_back(std::move(*m_value));
+    UnlockedClear();
   }
 
   template<typename T>
-  void StateQueue<T>::Push(Target&& value) {
+  std::vector<typename StateQueue<T>::Source> StateQueue<T>::TryPopAll(
+      std::size_t max) {
+    auto values = std::vector<Source>();
     auto lock = boost::lock_guard(m_mutex);
-    if(m_breakException) {
-      std::rethrow_exception(m_breakException);
-    }
-    if(m_value) {
-      *m_value = std::move(value);
-    } else {
-      m_value.emplace(std::move(value));
-      m_isAvailableCondition.notify_one();
+    if(m_value && max != 0) {
+      values.push_back(std::move(*m_value));
+      UnlockedClear();
     }
+    return values;
+  }
+
+  template<typename T>
+  void StateQueue<T>::Push(const Target& value) {
+    Emplace(value);
+  }
+
+  template<typename T>
+  void StateQueue<T>::Push(Target&& value) {
+    Emplace(std::move(value));
   }
 
   template<typename T>
@@ -119,12 +170,50 @@ namespace Beam {
     }
     m_breakException = exception;
     m_isAvailableCondition.notify_all();
+    m_isSpaceAvailableCondition.notify_all();
   }
 
   template<typename T>
   bool StateQueue<T>::UnlockedIsAvailable() const {
     return m_value || m_breakException;
   }
+
+  template<typename T>
+  void StateQueue<T>::UnlockedClear() {
+    m_value = boost::none;
+    if(m_policy == OverflowPolicy::BLOCK) {
+      m_isSpaceAvailableCondition.notify_one();
+    }
+  }
+
+  template<typename T>
+  template<typename U>
+  void StateQueue<T>::Emplace(U&& value) {
+    auto lock = boost::unique_lock(m_mutex);
+    if(m_breakException) {
+      std::rethrow_exception(m_breakException);
+    }
+    if(m_value) {
+      if(m_policy == OverflowPolicy::BLOCK) {
+        auto start = std::chrono::steady_clock::now();
+        while(m_value && !m_breakException) {
+          m_isSpaceAvailableCondition.wait(lock);
+        }
+        m_blockedTime += std::chrono::steady_clock::now() - start;
+        if(m_breakException) {
+          std::rethrow_exception(m_breakException);
+        }
+      } else {
+        ++m_dropCount;
+        if(m_policy != OverflowPolicy::DROP_NEWEST) {
+          *m_value = std::forward<U>(value);
+        }
+        return;
+      }
+    }
+    m_value.emplace(std::forward<U>(value));
+    m_isAvailableCondition.notify_one();
+  }
 }
 
 #endif
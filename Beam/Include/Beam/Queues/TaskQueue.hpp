@@ -2,6 +2,9 @@
 #define BEAM_TASK_QUEUE_HPP
 #include <atomic>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <vector>
 #include "Beam/Queues/CallbackQueue.hpp"
 #include "Beam/Queues/Queue.hpp"
 #include "Beam/Queues/Queues.hpp"
@@ -18,6 +21,14 @@ namespace Beam {
       /** Constructs a TaskQueue. */
       TaskQueue();
 
+      /**
+       * Constructs a TaskQueue storing its tasks in a specified Queue, for
+       * example an MpscQueue.
+       * @param tasks The Queue to store the tasks in, it is only ever popped
+       *        by a single consumer.
+       */
+      explicit TaskQueue(std::unique_ptr<AbstractQueue<Source>> tasks);
+
       /**
        * Returns a slot.
        * @param callback The callback when a new value is pushed.
@@ -57,6 +68,10 @@ namespace Beam {
 
       boost::optional<Source> TryPop() override;
 
+      void PopAll(Out<std::vector<Source>> values) override;
+
+      std::vector<Source> TryPopAll(std::size_t max) override;
+
       void Push(const Target& value) override;
 
       void Push(Target&& value) override;
@@ -67,7 +82,7 @@ namespace Beam {
 
     private:
       std::atomic_bool m_isBroken;
-      Queue<Source> m_tasks;
+      std::unique_ptr<AbstractQueue<Source>> m_tasks;
       CallbackQueue m_callbacks;
 
       template<typename T, typename F, typename B>
@@ -80,9 +95,14 @@ namespace Beam {
    */
   template<typename TaskQueueType>
   void TaskLoop(TaskQueueType taskQueue) {
+    auto tasks = std::vector<std::function<void ()>>();
     try {
       while(true) {
-        taskQueue->Pop()();
+        taskQueue->PopAll(Store(tasks));
+        for(auto& task : tasks) {
+          task();
+        }
+        tasks.clear();
       }
     } catch(const PipeBrokenException&) {
       return;
@@ -108,13 +128,24 @@ namespace Beam {
    * @param tasks The TaskQueue to handle.
    */
   inline void HandleTasks(TaskQueue& tasks) {
-    while(auto task = tasks.TryPop()) {
-      (*task)();
+    while(true) {
+      auto pendingTasks =
+        tasks.TryPopAll(std::numeric_limits<std::size_t>::max());
+      if(pendingTasks.empty()) {
+        break;
+      }
+      for(auto& task : pendingTasks) {
+        task();
+      }
     }
   }
 
   inline TaskQueue::TaskQueue()
-    : m_isBroken(false) {}
+    : TaskQueue(std::make_unique<Queue<Source>>()) {}
+
+  inline TaskQueue::TaskQueue(std::unique_ptr<AbstractQueue<Source>> tasks)
+    : m_isBroken(false),
+      m_tasks(std::move(tasks)) {}
 
   template<typename T, typename F>
   auto TaskQueue::GetSlot(F&& callback) {
@@ -142,26 +173,35 @@ namespace Beam {
   }
 
   inline TaskQueue::Source TaskQueue::Pop() {
-    return m_tasks.Pop();
+    return m_tasks->Pop();
   }
 
   inline boost::optional<TaskQueue::Source> TaskQueue::TryPop() {
-    return m_tasks.TryPop();
+    return m_tasks->TryPop();
+  }
+
+  inline void TaskQueue::PopAll(Out<std::vector<Source>> values) {
+    m_tasks->PopAll(Store(values));
+  }
+
+  inline std::vector<TaskQueue::Source> TaskQueue::TryPopAll(
+      std::size_t max) {
+    return m_tasks->TryPopAll(max);
   }
 
   inline void TaskQueue::Push(const Target& value) {
-    m_tasks.Push(value);
+    m_tasks->Push(value);
   }
 
   inline void TaskQueue::Push(Target&& value) {
-    m_tasks.Push(std::move(value));
+    m_tasks->Push(std::move(value));
   }
 
   inline void TaskQueue::Break(const std::exception_ptr& exception) {
     if(!m_isBroken.exchange(true)) {
       m_callbacks.Break(exception);
       Push([=] {
-        m_tasks.Break(exception);
+        m_tasks->Break(exception);
       });
     }
   }
@@ -171,13 +211,13 @@ namespace Beam {
     return m_callbacks.GetSlot<T>(
       [=, callback = std::make_shared<std::remove_reference_t<F>>(
           std::forward<F>(callback))] (const T& value) {
-        m_tasks.Push([=] {
+        m_tasks->Push([=] {
           (*callback)(value);
         });
       },
       [=, breakCallback = std::make_shared<std::remove_reference_t<B>>(
           std::forward<B>(breakCallback))] (const std::exception_ptr& e) {
-        m_tasks.Push([=] () {
+        m_tasks->Push([=] () {
           (*breakCallback)(e);
         });
       });
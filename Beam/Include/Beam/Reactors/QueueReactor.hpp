@@ -1,6 +1,7 @@
 #ifndef BEAM_QUEUE_REACTOR_HPP
 #define BEAM_QUEUE_REACTOR_HPP
 #include <memory>
+#include <vector>
 #include <Aspen/Queue.hpp>
 #include "Beam/Queues/ScopedQueueReader.hpp"
 #include "Beam/Routines/RoutineHandler.hpp"
@@ -88,9 +89,14 @@ namespace Beam::Reactors {
 
   template<typename T>
   void QueueReactor<T>::MonitorQueue(Entry& entry) {
+    auto values = std::vector<Type>();
     while(true) {
       try {
-        entry.m_reactor.push(entry.m_queue.Pop());
+        entry.m_queue.PopAll(Store(values));
+        for(auto& value : values) {
+          entry.m_reactor.push(std::move(value));
+        }
+        values.clear();
       } catch(const PipeBrokenException&) {
         if(!entry.m_isComplete) {
           entry.m_reactor.set_complete();
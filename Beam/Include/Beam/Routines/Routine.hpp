@@ -206,6 +206,12 @@ namespace Details {
     initialRoutine->Resume();
   }
 
+  //! Resumes execution of a batch of suspended Routines.
+  /*!
+    \param routines The Routines to resume, the list is cleared.
+  */
+  void Resume(Out<std::vector<Routine*>> routines);
+
   inline Routine::Routine()
       : m_id(++Details::NextId<void>::GetInstance()),
         m_state(State::PENDING) {}
@@ -9,13 +9,19 @@ namespace Routines {
   template<typename T> class Eval;
   class ExternalRoutine;
   template<typename F> class FunctionRoutine;
+  class PooledStackAllocator;
   class Routine;
   class RoutineException;
   class RoutineHandler;
   class ScheduledRoutine;
+  struct SchedulerContextStatistics;
+  struct SchedulerOptions;
+  struct SchedulerStatistics;
+  class StackPool;
   struct SuspendedRoutineNode;
 namespace Details {
   class Scheduler;
+  template<typename T> class WorkStealingDeque;
 }
 }
 }
@@ -12,6 +12,7 @@
 #endif
 #include "Beam/Routines/Routine.hpp"
 #include "Beam/Routines/Routines.hpp"
+#include "Beam/Routines/StackPool.hpp"
 #include "Beam/Pointers/Ref.hpp"
 #include "Beam/Utilities/ReportException.hpp"
 #include "Beam/Utilities/StackPrint.hpp"
@@ -25,6 +26,15 @@ namespace Beam::Routines {
       /** Returns the id of the context this Routine is running in. */
       std::size_t GetContextId() const;
 
+      /**
+       * Returns <code>true</code> iff this Routine was explicitly assigned a
+       * context and must never migrate to another one.
+       */
+      bool IsPinned() const;
+
+      /** Returns the Scheduler this Routine was spawned in. */
+      Details::Scheduler& GetScheduler() const;
+
       /**
        * Continues execution of this Routine from its last defer point or from
        * the beginning if it has not yet executed.
@@ -52,8 +62,10 @@ namespace Beam::Routines {
     private:
       friend class Details::Scheduler;
       bool m_isPendingResume;
+      bool m_isPinned;
       std::size_t m_stackSize;
       std::size_t m_contextId;
+      Details::Scheduler* m_scheduler;
       boost::context::continuation m_continuation;
       boost::context::continuation m_parent;
       #ifndef NDEBUG
@@ -62,6 +74,8 @@ namespace Beam::Routines {
 
       bool IsPendingResume() const;
       void SetPendingResume(bool value);
+      void SetContextId(std::size_t contextId);
+      void SetScheduler(Details::Scheduler& scheduler);
       boost::context::continuation InitializeRoutine(
         boost::context::continuation&& parent);
   };
@@ -70,13 +84,21 @@ namespace Beam::Routines {
     return m_contextId;
   }
 
+  inline bool ScheduledRoutine::IsPinned() const {
+    return m_isPinned;
+  }
+
+  inline Details::Scheduler& ScheduledRoutine::GetScheduler() const {
+    return *m_scheduler;
+  }
+
   inline void ScheduledRoutine::Continue() {
     Details::CurrentRoutineGlobal<void>::GetInstance() = this;
     m_isPendingResume = false;
     if(GetState() == State::PENDING) {
       SetState(State::RUNNING);
       m_continuation = boost::context::callcc(std::allocator_arg,
-        boost::context::fixedsize_stack(m_stackSize),
+        PooledStackAllocator(m_stackSize),
         [=] (boost::context::continuation&& parent) {
           return InitializeRoutine(std::move(parent));
         });
@@ -90,7 +112,9 @@ namespace Beam::Routines {
   inline ScheduledRoutine::ScheduledRoutine(std::size_t stackSize,
       std::size_t contextId)
       : m_isPendingResume(false),
-        m_stackSize(stackSize) {
+        m_isPinned(contextId != -1),
+        m_stackSize(stackSize),
+        m_scheduler(nullptr) {
     if(contextId == -1) {
       m_contextId = GetId() % boost::thread::hardware_concurrency();
     } else {
@@ -132,6 +156,14 @@ namespace Beam::Routines {
     m_isPendingResume = value;
   }
 
+  inline void ScheduledRoutine::SetContextId(std::size_t contextId) {
+    m_contextId = contextId;
+  }
+
+  inline void ScheduledRoutine::SetScheduler(Details::Scheduler& scheduler) {
+    m_scheduler = &scheduler;
+  }
+
   inline boost::context::continuation ScheduledRoutine::InitializeRoutine(
       boost::context::continuation&& parent) {
     m_parent = std::move(parent);
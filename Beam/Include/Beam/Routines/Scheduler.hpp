@@ -1,16 +1,27 @@
 #ifndef BEAM_SCHEDULER_HPP
 #define BEAM_SCHEDULER_HPP
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <deque>
-#include <iostream>
+#include <stdexcept>
 #include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 #include <boost/thread/condition_variable.hpp>
 #include <boost/thread/mutex.hpp>
 #include <boost/thread/thread.hpp>
+#include <boost/throw_exception.hpp>
 #include "Beam/Routines/FunctionRoutine.hpp"
 #include "Beam/Routines/Routines.hpp"
-#include "Beam/Threading/Sync.hpp"
+#include "Beam/Routines/SchedulerOptions.hpp"
+#include "Beam/Routines/SchedulerStatistics.hpp"
+#include "Beam/Routines/WorkStealingDeque.hpp"
+#include "Beam/Threading/CpuAffinity.hpp"
+#include "Beam/Threading/SpinWait.hpp"
 #include "Beam/Utilities/ReportException.hpp"
 #include "Beam/Utilities/Singleton.hpp"
 
@@ -23,6 +34,8 @@
 #endif
 
 namespace Beam::Routines {
+  std::size_t GetCurrentContextId();
+
 namespace Details {
 
   /** Schedules the execution of Routines across multiple threads. */
@@ -34,16 +47,41 @@ namespace Details {
         BEAM_SCHEDULER_DEFAULT_STACK_SIZE;
 
       /**
-       * Constructs a Scheduler with a number of threads equal to the system's
-       * concurrency.
+       * Constructs a Scheduler using the options passed to
+       * SetSchedulerOptions, or if none were passed, the options specified by
+       * the environment.
        */
       Scheduler();
 
+      /**
+       * Constructs a Scheduler.
+       * @param options The options used to configure the Scheduler.
+       */
+      explicit Scheduler(const SchedulerOptions& options);
+
       ~Scheduler();
 
+      /** Returns the options this Scheduler was constructed with. */
+      const SchedulerOptions& GetOptions() const;
+
       /** Returns the number of threads used by the Scheduler. */
       std::size_t GetThreadCount() const;
 
+      /** Returns <code>true</code> iff idle contexts steal Routines. */
+      bool IsWorkStealing() const;
+
+      /** Returns the number of Routines taken from another context's queue. */
+      std::uint64_t GetStealCount() const;
+
+      /**
+       * Returns the number of stolen Routines that had already started running
+       * on another context.
+       */
+      std::uint64_t GetMigrationCount() const;
+
+      /** Returns a snapshot of the Scheduler's activity. */
+      SchedulerStatistics GetStatistics() const;
+
       /**
        * Returns <code>true</code> iff the context with the specified <i>id</i>
        * has Routines pending.
@@ -61,12 +99,22 @@ namespace Details {
        * @param f The callable object to run within the Routine.
        * @param stackSize The size of the stack to allocate for the Routine.
        * @param contextId The specific context id to run the Routine in, or
-       *        set to the number of threads to assign it an arbitrary context.
+       *        -1 to assign it an arbitrary context.
        * @return A unique ID used to identify the Routine.
+       * @throws std::out_of_range If the <i>contextId</i> is not one of this
+       *         Scheduler's contexts.
        */
       template<typename F>
       Routine::Id Spawn(F&& f, std::size_t stackSize, std::size_t contextId);
 
+      /**
+       * Resumes a batch of suspended Routines, each context's Routines are
+       * queued under a single lock and the context is woken at most once.
+       * @param routines The Routines to resume, all of which must have been
+       *        spawned by this Scheduler, the list is cleared.
+       */
+      void Resume(Out<std::vector<ScheduledRoutine*>> routines);
+
       /**
        * Waits for any currently executing Routines to COMPLETE and stops
        * executing any new ones.
@@ -77,36 +125,126 @@ namespace Details {
       struct Context {
         boost::mutex m_mutex;
         bool m_isRunning;
+        bool m_isParked;
+        std::atomic_bool m_hasPendingRoutines;
         std::deque<ScheduledRoutine*> m_pendingRoutines;
+        WorkStealingDeque<ScheduledRoutine*> m_stealableRoutines;
         std::unordered_set<ScheduledRoutine*> m_suspendedRoutines;
         boost::condition_variable m_pendingRoutinesAvailableCondition;
+        std::atomic_uint64_t m_spawnCount;
+        std::atomic_uint64_t m_completionCount;
+        std::atomic_uint64_t m_contextSwitchCount;
+        std::atomic_uint64_t m_longSliceCount;
+        std::atomic_int64_t m_runningTime;
+        std::atomic_int64_t m_idleTime;
+        std::atomic_int64_t m_sliceStart;
+        std::atomic<Routine::Id> m_currentRoutineId;
+        std::array<std::atomic_uint64_t,
+          SchedulerStatistics::SLICE_HISTOGRAM_SIZE> m_sliceHistogram;
+        std::chrono::steady_clock::time_point m_lastSliceEnd;
 
         Context();
       };
-      using RoutineIds = std::unordered_map<Routine::Id, ScheduledRoutine*>;
+      struct CallingContext {
+        Scheduler* m_scheduler;
+        std::size_t m_id;
+      };
+      struct RoutineShard {
+        boost::mutex m_mutex;
+        std::unordered_map<Routine::Id, ScheduledRoutine*> m_routines;
+      };
+      static constexpr auto ROUTINE_SHARD_COUNT = std::size_t(64);
       friend class Beam::Routines::ScheduledRoutine;
+      friend std::size_t Beam::Routines::GetCurrentContextId();
       friend void Resume(ScheduledRoutine*& routine);
+      SchedulerOptions m_options;
       std::size_t m_threadCount;
+      bool m_isWorkStealing;
+      std::atomic_size_t m_parkedCount;
+      std::atomic_uint64_t m_stealCount;
+      std::atomic_uint64_t m_migrationCount;
       std::unique_ptr<boost::thread[]> m_threads;
-      Threading::Sync<RoutineIds> m_routineIds;
       std::unique_ptr<Context[]> m_contexts;
-
+      std::array<RoutineShard, ROUTINE_SHARD_COUNT> m_routineShards;
+      bool m_isWatchdogEnabled;
+      bool m_isWatchdogRunning;
+      boost::mutex m_watchdogMutex;
+      boost::condition_variable m_watchdogCondition;
+      boost::thread m_watchdog;
+
+      static CallingContext& GetCallingContext();
+      RoutineShard& GetShard(Routine::Id id);
       void Queue(ScheduledRoutine& routine);
+      void PushPending(Context& context, ScheduledRoutine& routine);
+      ScheduledRoutine* PopPending(Context& context);
+      bool SpinForPendingRoutines(std::size_t contextId);
       void Suspend(ScheduledRoutine& routine);
       void Resume(ScheduledRoutine& routine);
+      void Resume(Context& context, ScheduledRoutine& routine);
       void Run(Context& context);
+      void RunSlice(Context& context, ScheduledRoutine& routine);
+      void RunWatchdog();
+      void RunWorkStealing(std::size_t contextId);
+      ScheduledRoutine* PopWorkStealing(std::size_t contextId,
+        bool& isInboxPreferred);
+      ScheduledRoutine* PopInbox(std::size_t contextId);
+      ScheduledRoutine* Steal(std::size_t contextId);
+      void WakeParkedContext();
+      void Reschedule(ScheduledRoutine& routine);
   };
 
   inline Scheduler::Context::Context()
-    : m_isRunning(true) {}
+    : m_isRunning(true),
+      m_isParked(false),
+      m_hasPendingRoutines(false),
+      m_spawnCount(0),
+      m_completionCount(0),
+      m_contextSwitchCount(0),
+      m_longSliceCount(0),
+      m_runningTime(0),
+      m_idleTime(0),
+      m_sliceStart(0),
+      m_currentRoutineId(0),
+      m_lastSliceEnd(std::chrono::steady_clock::now()) {
+    for(auto& count : m_sliceHistogram) {
+      count.store(0, std::memory_order_relaxed);
+    }
+  }
 
   inline Scheduler::Scheduler()
-      : m_threadCount(boost::thread::hardware_concurrency()),
+    : Scheduler(Details::GetSchedulerOptions()) {}
+
+  inline Scheduler::Scheduler(const SchedulerOptions& options)
+      : m_options(options),
+        m_threadCount(m_options.GetThreadCount()),
+        m_isWorkStealing(m_options.m_isWorkStealing),
+        m_parkedCount(0),
+        m_stealCount(0),
+        m_migrationCount(0),
         m_threads(std::make_unique<boost::thread[]>(m_threadCount)),
-        m_contexts(std::make_unique<Context[]>(m_threadCount)) {
+        m_contexts(std::make_unique<Context[]>(m_threadCount)),
+        m_isWatchdogEnabled(m_options.m_watchdogThreshold >
+          boost::posix_time::time_duration()),
+        m_isWatchdogRunning(m_isWatchdogEnabled) {
+
+    /* The StackPool must outlive the threads that return stacks to it. */
+    StackPool::GetInstance();
     for(auto i = std::size_t(0); i < m_threadCount; ++i) {
       m_threads[i] = boost::thread([=] {
-        Run(m_contexts[i]);
+        if(!m_options.m_cores.empty()) {
+          Threading::SetCurrentThreadAffinity(
+            m_options.m_cores[i % m_options.m_cores.size()]);
+        }
+        if(m_isWorkStealing) {
+          RunWorkStealing(i);
+        } else {
+          Run(m_contexts[i]);
+        }
+      });
+    }
+    if(m_isWatchdogEnabled) {
+      m_watchdog = boost::thread([=] {
+        RunWatchdog();
       });
     }
   }
@@ -115,79 +253,223 @@ namespace Details {
     Stop();
   }
 
+  inline const SchedulerOptions& Scheduler::GetOptions() const {
+    return m_options;
+  }
+
   inline std::size_t Scheduler::GetThreadCount() const {
     return m_threadCount;
   }
 
+  inline bool Scheduler::IsWorkStealing() const {
+    return m_isWorkStealing;
+  }
+
+  inline std::uint64_t Scheduler::GetStealCount() const {
+    return m_stealCount.load(std::memory_order_relaxed);
+  }
+
+  inline std::uint64_t Scheduler::GetMigrationCount() const {
+    return m_migrationCount.load(std::memory_order_relaxed);
+  }
+
+  inline SchedulerStatistics Scheduler::GetStatistics() const {
+    auto toDuration = [] (std::int64_t nanoseconds) {
+      return boost::posix_time::microseconds(nanoseconds / 1000);
+    };
+    auto statistics = SchedulerStatistics();
+    statistics.m_sliceHistogram.fill(0);
+    for(auto i = std::size_t(0); i != m_threadCount; ++i) {
+      auto& context = m_contexts[i];
+      auto contextStatistics = SchedulerContextStatistics();
+      {
+        auto lock = boost::lock_guard(context.m_mutex);
+        contextStatistics.m_pendingCount = context.m_pendingRoutines.size() +
+          context.m_stealableRoutines.GetSize();
+        contextStatistics.m_suspendedCount =
+          context.m_suspendedRoutines.size();
+      }
+      contextStatistics.m_spawnCount =
+        context.m_spawnCount.load(std::memory_order_relaxed);
+      contextStatistics.m_completionCount =
+        context.m_completionCount.load(std::memory_order_relaxed);
+      contextStatistics.m_contextSwitchCount =
+        context.m_contextSwitchCount.load(std::memory_order_relaxed);
+      contextStatistics.m_longSliceCount =
+        context.m_longSliceCount.load(std::memory_order_relaxed);
+      contextStatistics.m_runningTime =
+        toDuration(context.m_runningTime.load(std::memory_order_relaxed));
+      contextStatistics.m_idleTime =
+        toDuration(context.m_idleTime.load(std::memory_order_relaxed));
+      for(auto j = std::size_t(0); j != context.m_sliceHistogram.size(); ++j) {
+        statistics.m_sliceHistogram[j] +=
+          context.m_sliceHistogram[j].load(std::memory_order_relaxed);
+      }
+      statistics.m_contexts.push_back(contextStatistics);
+    }
+    statistics.m_stealCount = GetStealCount();
+    statistics.m_migrationCount = GetMigrationCount();
+    return statistics;
+  }
+
   inline bool Scheduler::HasPendingRoutines(std::size_t contextId) const {
     auto& context = m_contexts[contextId];
     auto lock = boost::lock_guard(context.m_mutex);
-    return !context.m_pendingRoutines.empty();
+    return !context.m_pendingRoutines.empty() ||
+      !context.m_stealableRoutines.IsEmpty();
   }
 
   inline void Scheduler::Wait(Routine::Id id) {
     assert(GetCurrentRoutine().GetId() != id);
     auto waitAsync = Async<void>();
-    auto wait = Threading::With(m_routineIds, [&] (auto& routineIds) {
-      auto routineIterator = routineIds.find(id);
-      if(routineIterator == routineIds.end()) {
-        return false;
+    {
+      auto& shard = GetShard(id);
+      auto lock = boost::lock_guard(shard.m_mutex);
+      auto routineIterator = shard.m_routines.find(id);
+      if(routineIterator == shard.m_routines.end()) {
+        return;
       }
-      auto routine = routineIterator->second;
-      routine->Wait(waitAsync.GetEval());
-      return true;
-    });
-    if(wait) {
-      waitAsync.Get();
+      routineIterator->second->Wait(waitAsync.GetEval());
     }
+    waitAsync.Get();
   }
 
   template<typename F>
   Routine::Id Scheduler::Spawn(F&& f, std::size_t stackSize,
       std::size_t contextId) {
+    if(contextId != -1 && contextId >= m_threadCount) {
+      BOOST_THROW_EXCEPTION(std::out_of_range("Invalid context id."));
+    }
     auto routine = new FunctionRoutine(std::forward<F>(f), stackSize,
       contextId);
     auto id = routine->GetId();
-    Threading::With(m_routineIds, [&] (auto& routineIds) {
-      routineIds.insert(std::pair(id, routine));
-    });
+    routine->SetScheduler(*this);
+    if(!routine->IsPinned()) {
+      routine->SetContextId(id % m_threadCount);
+    }
+    m_contexts[routine->GetContextId()].m_spawnCount.fetch_add(1,
+      std::memory_order_relaxed);
+    {
+      auto& shard = GetShard(id);
+      auto lock = boost::lock_guard(shard.m_mutex);
+      shard.m_routines.insert(std::pair(id, routine));
+    }
     Queue(*routine);
     return id;
   }
 
+  inline Scheduler::CallingContext& Scheduler::GetCallingContext() {
+    thread_local auto callingContext =
+      CallingContext{nullptr, static_cast<std::size_t>(-1)};
+    return callingContext;
+  }
+
+  inline Scheduler::RoutineShard& Scheduler::GetShard(Routine::Id id) {
+    return m_routineShards[id % ROUTINE_SHARD_COUNT];
+  }
+
   inline void Scheduler::Queue(ScheduledRoutine& routine) {
+    if(m_isWorkStealing && !routine.IsPinned()) {
+
+      /* Only a thread belonging to this Scheduler may push onto one of its
+         stealable deques. */
+      auto& callingContext = GetCallingContext();
+      if(callingContext.m_scheduler == this) {
+        auto contextId = callingContext.m_id;
+        routine.SetContextId(contextId);
+        m_contexts[contextId].m_stealableRoutines.Push(&routine);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if(m_parkedCount.load(std::memory_order_relaxed) != 0) {
+          WakeParkedContext();
+        }
+        return;
+      }
+    }
     auto& context = m_contexts[routine.GetContextId()];
     auto lock = boost::lock_guard(context.m_mutex);
+    PushPending(context, routine);
+  }
+
+  inline void Scheduler::PushPending(Context& context,
+      ScheduledRoutine& routine) {
     context.m_pendingRoutines.push_back(&routine);
     if(context.m_pendingRoutines.size() == 1) {
+      context.m_hasPendingRoutines.store(true, std::memory_order_release);
       context.m_pendingRoutinesAvailableCondition.notify_all();
     }
   }
 
+  inline ScheduledRoutine* Scheduler::PopPending(Context& context) {
+    auto routine = context.m_pendingRoutines.front();
+    context.m_pendingRoutines.pop_front();
+    if(context.m_pendingRoutines.empty()) {
+      context.m_hasPendingRoutines.store(false, std::memory_order_relaxed);
+    }
+    return routine;
+  }
+
+  inline bool Scheduler::SpinForPendingRoutines(std::size_t contextId) {
+    return Threading::SpinUntil([&] {
+      if(m_contexts[contextId].m_hasPendingRoutines.load(
+          std::memory_order_acquire)) {
+        return true;
+      }
+      if(!m_isWorkStealing) {
+        return false;
+      }
+      for(auto i = std::size_t(0); i != m_threadCount; ++i) {
+        if(!m_contexts[i].m_stealableRoutines.IsEmpty()) {
+          return true;
+        }
+      }
+      return false;
+    }, m_options.m_spinDuration);
+  }
+
   inline void Scheduler::Suspend(ScheduledRoutine& routine) {
     auto& context = m_contexts[routine.GetContextId()];
     auto lock = boost::lock_guard(context.m_mutex);
     routine.SetState(Routine::State::SUSPENDED);
     if(routine.IsPendingResume()) {
       routine.SetPendingResume(false);
-      context.m_pendingRoutines.push_back(&routine);
-      context.m_pendingRoutinesAvailableCondition.notify_all();
+      PushPending(context, routine);
       return;
     }
     context.m_suspendedRoutines.insert(&routine);
   }
 
+  inline void Scheduler::Resume(Out<std::vector<ScheduledRoutine*>> routines) {
+    std::stable_sort(routines->begin(), routines->end(),
+      [] (auto left, auto right) {
+        return left->GetContextId() < right->GetContextId();
+      });
+    auto i = routines->begin();
+    while(i != routines->end()) {
+      auto contextId = (*i)->GetContextId();
+      auto& context = m_contexts[contextId];
+      auto lock = boost::lock_guard(context.m_mutex);
+      do {
+        Resume(context, **i);
+        ++i;
+      } while(i != routines->end() && (*i)->GetContextId() == contextId);
+    }
+    routines->clear();
+  }
+
   inline void Scheduler::Resume(ScheduledRoutine& routine) {
     auto& context = m_contexts[routine.GetContextId()];
     auto lock = boost::lock_guard(context.m_mutex);
+    Resume(context, routine);
+  }
+
+  inline void Scheduler::Resume(Context& context, ScheduledRoutine& routine) {
     auto routineIterator = context.m_suspendedRoutines.find(&routine);
     if(routineIterator == context.m_suspendedRoutines.end()) {
       routine.SetPendingResume(true);
       return;
     }
     context.m_suspendedRoutines.erase(routineIterator);
-    context.m_pendingRoutines.push_back(&routine);
-    context.m_pendingRoutinesAvailableCondition.notify_all();
+    PushPending(context, routine);
   }
 
   inline void Scheduler::Stop() {
@@ -198,7 +480,17 @@ namespace Details {
       context.m_pendingRoutinesAvailableCondition.notify_all();
     }
     for(auto i = std::size_t(0); i != m_threadCount; ++i) {
-      m_threads[i].join();
+      if(m_threads[i].joinable()) {
+        m_threads[i].join();
+      }
+    }
+    {
+      auto lock = boost::lock_guard(m_watchdogMutex);
+      m_isWatchdogRunning = false;
+      m_watchdogCondition.notify_all();
+    }
+    if(m_watchdog.joinable()) {
+      m_watchdog.join();
     }
     for(auto i = std::size_t(0); i != m_threadCount; ++i) {
       auto& context = m_contexts[i];
@@ -207,8 +499,11 @@ namespace Details {
   }
 
   inline void Scheduler::Run(Context& context) {
+    auto contextId = static_cast<std::size_t>(&context - m_contexts.get());
+    GetCallingContext() = CallingContext{this, contextId};
     while(true) {
       auto routine = static_cast<ScheduledRoutine*>(nullptr);
+      SpinForPendingRoutines(contextId);
       {
         auto lock = boost::unique_lock(context.m_mutex);
         while(context.m_pendingRoutines.empty()) {
@@ -218,22 +513,231 @@ namespace Details {
           }
           context.m_pendingRoutinesAvailableCondition.wait(lock);
         }
-        routine = context.m_pendingRoutines.front();
-        context.m_pendingRoutines.pop_front();
+        routine = PopPending(context);
       }
-      routine->Continue();
-      if(routine->GetState() == Routine::State::COMPLETE) {
-        Threading::With(m_routineIds, [&] (auto& routineIds) {
-          routineIds.erase(routine->GetId());
-        });
-        delete routine;
-      } else if(routine->GetState() == Routine::State::PENDING_SUSPEND) {
-        Suspend(*routine);
+      RunSlice(context, *routine);
+    }
+  }
+
+  inline void Scheduler::RunSlice(Context& context,
+      ScheduledRoutine& routine) {
+
+    /* The counters below are only written by the context's own thread, so
+       they are updated without a read-modify-write. */
+    auto increment = [] (auto& counter, auto value) {
+      counter.store(counter.load(std::memory_order_relaxed) + value,
+        std::memory_order_relaxed);
+    };
+    auto start = std::chrono::steady_clock::now();
+    increment(context.m_idleTime, std::chrono::duration_cast<
+      std::chrono::nanoseconds>(start - context.m_lastSliceEnd).count());
+    if(m_isWatchdogEnabled) {
+      context.m_currentRoutineId.store(routine.GetId(),
+        std::memory_order_relaxed);
+      context.m_sliceStart.store(std::chrono::duration_cast<
+        std::chrono::nanoseconds>(start.time_since_epoch()).count(),
+        std::memory_order_release);
+    }
+    routine.Continue();
+    auto end = std::chrono::steady_clock::now();
+    if(m_isWatchdogEnabled) {
+      context.m_sliceStart.store(0, std::memory_order_relaxed);
+    }
+    auto duration =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+    increment(context.m_runningTime, duration.count());
+    increment(context.m_contextSwitchCount, 1);
+    increment(context.m_sliceHistogram[SchedulerStatistics::GetSliceBucket(
+      std::chrono::duration_cast<std::chrono::microseconds>(
+      duration).count())], 1);
+    if(routine.GetState() == Routine::State::COMPLETE) {
+      increment(context.m_completionCount, 1);
+    }
+    context.m_lastSliceEnd = end;
+    Reschedule(routine);
+  }
+
+  inline void Scheduler::RunWatchdog() {
+    auto threshold = std::chrono::microseconds(
+      m_options.m_watchdogThreshold.total_microseconds());
+    auto period = std::max<std::chrono::microseconds>(threshold / 2,
+      std::chrono::milliseconds(1));
+    auto reportedSlices =
+      std::vector<std::uint64_t>(m_threadCount, static_cast<std::uint64_t>(-1));
+    auto lock = boost::unique_lock(m_watchdogMutex);
+    while(m_isWatchdogRunning) {
+      m_watchdogCondition.wait_for(lock,
+        boost::chrono::microseconds(period.count()));
+      auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+      for(auto i = std::size_t(0); i != m_threadCount; ++i) {
+        auto& context = m_contexts[i];
+        auto start = context.m_sliceStart.load(std::memory_order_acquire);
+        if(start == 0 || std::chrono::nanoseconds(now - start) < threshold) {
+          continue;
+        }
+        auto slice = context.m_contextSwitchCount.load(
+          std::memory_order_relaxed);
+        if(reportedSlices[i] == slice) {
+          continue;
+        }
+        reportedSlices[i] = slice;
+        context.m_longSliceCount.fetch_add(1, std::memory_order_relaxed);
+        if(m_options.m_watchdogHook) {
+          m_options.m_watchdogHook(context.m_currentRoutineId.load(
+            std::memory_order_relaxed), i,
+            boost::posix_time::microseconds((now - start) / 1000));
+        }
+      }
+    }
+  }
+
+  inline void Scheduler::RunWorkStealing(std::size_t contextId) {
+    GetCallingContext() = CallingContext{this, contextId};
+    auto isInboxPreferred = false;
+    while(auto routine = PopWorkStealing(contextId, isInboxPreferred)) {
+      RunSlice(m_contexts[contextId], *routine);
+    }
+  }
+
+  inline ScheduledRoutine* Scheduler::PopWorkStealing(std::size_t contextId,
+      bool& isInboxPreferred) {
+    auto& context = m_contexts[contextId];
+    while(true) {
+
+      /* Alternate between the inbox and the stealable deque so that neither
+         a pinned Routine nor a deferring one can starve the other. */
+      isInboxPreferred = !isInboxPreferred;
+      if(isInboxPreferred) {
+        if(auto routine = PopInbox(contextId)) {
+          return routine;
+        }
+      }
+      if(auto routine = context.m_stealableRoutines.Steal()) {
+        return *routine;
+      }
+      if(!isInboxPreferred) {
+        if(auto routine = PopInbox(contextId)) {
+          return routine;
+        }
+      }
+      if(auto routine = Steal(contextId)) {
+        return routine;
+      }
+      if(m_options.m_spinDuration > boost::posix_time::time_duration() &&
+          SpinForPendingRoutines(contextId)) {
+        continue;
+      }
+      auto lock = boost::unique_lock(context.m_mutex);
+      if(!context.m_pendingRoutines.empty()) {
+        continue;
+      }
+      context.m_isParked = true;
+      m_parkedCount.fetch_add(1);
+      auto routine = static_cast<ScheduledRoutine*>(nullptr);
+      if(auto stolenRoutine = context.m_stealableRoutines.Steal()) {
+        routine = *stolenRoutine;
       } else {
-        Queue(*routine);
+        routine = Steal(contextId);
+      }
+      while(routine == nullptr && context.m_isParked &&
+          context.m_pendingRoutines.empty()) {
+        if(!context.m_isRunning && context.m_suspendedRoutines.empty() &&
+            context.m_stealableRoutines.IsEmpty()) {
+          context.m_isParked = false;
+          m_parkedCount.fetch_sub(1);
+          return nullptr;
+        }
+        context.m_pendingRoutinesAvailableCondition.wait(lock);
+      }
+      if(context.m_isParked) {
+        context.m_isParked = false;
+        m_parkedCount.fetch_sub(1);
+      }
+      if(routine) {
+        return routine;
       }
     }
   }
+
+  inline ScheduledRoutine* Scheduler::PopInbox(std::size_t contextId) {
+    auto& context = m_contexts[contextId];
+    auto routine = static_cast<ScheduledRoutine*>(nullptr);
+    auto isStealable = false;
+    {
+      auto lock = boost::lock_guard(context.m_mutex);
+      if(context.m_pendingRoutines.empty()) {
+        return nullptr;
+      }
+      routine = PopPending(context);
+
+      /* Move the unpinned Routines out of the inbox so that idle contexts can
+         steal them. */
+      auto i = context.m_pendingRoutines.begin();
+      while(i != context.m_pendingRoutines.end()) {
+        if((*i)->IsPinned()) {
+          ++i;
+        } else {
+          context.m_stealableRoutines.Push(*i);
+          i = context.m_pendingRoutines.erase(i);
+          isStealable = true;
+        }
+      }
+      if(context.m_pendingRoutines.empty()) {
+        context.m_hasPendingRoutines.store(false, std::memory_order_relaxed);
+      }
+    }
+    if(isStealable) {
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if(m_parkedCount.load(std::memory_order_relaxed) != 0) {
+        WakeParkedContext();
+      }
+    }
+    return routine;
+  }
+
+  inline ScheduledRoutine* Scheduler::Steal(std::size_t contextId) {
+    for(auto i = std::size_t(1); i < m_threadCount; ++i) {
+      auto& victim = m_contexts[(contextId + i) % m_threadCount];
+      if(auto routine = victim.m_stealableRoutines.Steal()) {
+        m_stealCount.fetch_add(1, std::memory_order_relaxed);
+        if((*routine)->GetState() != Routine::State::PENDING) {
+          m_migrationCount.fetch_add(1, std::memory_order_relaxed);
+        }
+        (*routine)->SetContextId(contextId);
+        return *routine;
+      }
+    }
+    return nullptr;
+  }
+
+  inline void Scheduler::WakeParkedContext() {
+    for(auto i = std::size_t(0); i != m_threadCount; ++i) {
+      auto& context = m_contexts[i];
+      auto lock = boost::lock_guard(context.m_mutex);
+      if(context.m_isParked) {
+        context.m_isParked = false;
+        m_parkedCount.fetch_sub(1);
+        context.m_pendingRoutinesAvailableCondition.notify_all();
+        return;
+      }
+    }
+  }
+
+  inline void Scheduler::Reschedule(ScheduledRoutine& routine) {
+    if(routine.GetState() == Routine::State::COMPLETE) {
+      {
+        auto& shard = GetShard(routine.GetId());
+        auto lock = boost::lock_guard(shard.m_mutex);
+        shard.m_routines.erase(routine.GetId());
+      }
+      delete &routine;
+    } else if(routine.GetState() == Routine::State::PENDING_SUSPEND) {
+      Suspend(routine);
+    } else {
+      Queue(routine);
+    }
+  }
 }
 
   template<typename F>
@@ -282,8 +786,47 @@ namespace Details {
     Details::Scheduler::GetInstance().Wait(id);
   }
 
+  inline void Resume(Out<std::vector<Routine*>> routines) {
+    auto scheduledRoutines = std::vector<ScheduledRoutine*>();
+    scheduledRoutines.reserve(routines->size());
+    for(auto routine : *routines) {
+      if(auto scheduledRoutine = dynamic_cast<ScheduledRoutine*>(routine)) {
+        scheduledRoutines.push_back(scheduledRoutine);
+      } else {
+        Resume(routine);
+      }
+    }
+    routines->clear();
+
+    /* Each Routine is resumed by the Scheduler that spawned it. */
+    while(!scheduledRoutines.empty()) {
+      auto& scheduler = scheduledRoutines.front()->GetScheduler();
+      auto partition = std::stable_partition(scheduledRoutines.begin(),
+        scheduledRoutines.end(), [&] (auto routine) {
+          return &routine->GetScheduler() == &scheduler;
+        });
+      auto batch =
+        std::vector<ScheduledRoutine*>(scheduledRoutines.begin(), partition);
+      scheduledRoutines.erase(scheduledRoutines.begin(), partition);
+      scheduler.Resume(Store(batch));
+    }
+  }
+
+  /**
+   * Returns the id of the Scheduler context running on the calling thread, or
+   * -1 if the calling thread is not a Scheduler thread.
+   */
+  inline std::size_t GetCurrentContextId() {
+    return Details::Scheduler::GetCallingContext().m_id;
+  }
+
+  /** Returns a snapshot of the Scheduler's activity. */
+  inline SchedulerStatistics GetSchedulerStatistics() {
+    return Details::Scheduler::GetInstance().GetStatistics();
+  }
+
   inline void ScheduledRoutine::Resume() {
-    Details::Scheduler::GetInstance().Resume(*this);
+    m_scheduler->Resume(*this);
   }
 }
 
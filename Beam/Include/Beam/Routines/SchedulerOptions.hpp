@@ -0,0 +1,173 @@
+#ifndef BEAM_SCHEDULER_OPTIONS_HPP
+#define BEAM_SCHEDULER_OPTIONS_HPP
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/optional/optional.hpp>
+#include <boost/thread/thread.hpp>
+#include "Beam/Routines/Routines.hpp"
+#include "Beam/Threading/CpuAffinity.hpp"
+#include "Beam/Utilities/EnvironmentVariable.hpp"
+
+#ifndef BEAM_SCHEDULER_USE_WORK_STEALING
+  #define BEAM_SCHEDULER_USE_WORK_STEALING false
+#endif
+
+namespace Beam::Routines {
+
+  /** Stores the options used to construct the Scheduler. */
+  struct SchedulerOptions {
+
+    /**
+     * The type of function called by the watchdog when a Routine has run
+     * past the threshold without deferring.
+     * @param routineId The id of the Routine.
+     * @param contextId The id of the context the Routine is running on.
+     * @param duration How long the Routine has run without deferring.
+     */
+    using WatchdogHook = std::function<void (std::uint64_t routineId,
+      std::size_t contextId, boost::posix_time::time_duration duration)>;
+
+    /**
+     * The number of threads to run Routines on, or 0 to use one thread per
+     * pinned core or, if no cores are pinned, per available core.
+     */
+    std::size_t m_threadCount;
+
+    /** <code>true</code> iff idle contexts steal Routines from busy ones. */
+    bool m_isWorkStealing;
+
+    /**
+     * The cores to pin contexts to, context i runs on core
+     * m_cores[i % m_cores.size()]. An empty list disables pinning.
+     */
+    std::vector<int> m_cores;
+
+    /** The amount of time an idle context spins before it parks. */
+    boost::posix_time::time_duration m_spinDuration;
+
+    /**
+     * The duration after which a Routine that has not deferred is reported
+     * by the watchdog, or 0 to disable the watchdog.
+     */
+    boost::posix_time::time_duration m_watchdogThreshold;
+
+    /**
+     * Reports the Routines found by the watchdog, by default to std::cerr.
+     * The hook runs on the watchdog's thread and an empty hook disables
+     * reporting.
+     */
+    WatchdogHook m_watchdogHook;
+
+    /** Constructs the default options. */
+    SchedulerOptions();
+
+    /** Returns the number of threads these options resolve to. */
+    std::size_t GetThreadCount() const;
+
+    /**
+     * Returns the default options overridden by the following environment
+     * variables:
+     * BEAM_SCHEDULER_THREADS: The number of threads.
+     * BEAM_SCHEDULER_CORES: The cores to pin to, for example "2-7".
+     * BEAM_SCHEDULER_NUMA_NODE: Pins to the cores of a NUMA node.
+     * BEAM_SCHEDULER_WORK_STEALING: 1 to enable work stealing, 0 to disable.
+     * BEAM_SCHEDULER_SPIN_MICROSECONDS: The idle spin duration.
+     * BEAM_SCHEDULER_WATCHDOG_MILLISECONDS: The watchdog threshold.
+     * BEAM_SERVICE_CORES: Cores reserved for the ServiceThreadPool, which
+     * contexts are never pinned to unless BEAM_SERVICE_PER_THREAD is set.
+     */
+    static SchedulerOptions FromEnvironment();
+  };
+
+  /**
+   * Sets the options used to construct the Scheduler, this must be called
+   * before any Routine is spawned.
+   * @param options The options to construct the Scheduler with.
+   */
+  void SetSchedulerOptions(const SchedulerOptions& options);
+
+namespace Details {
+  inline boost::optional<SchedulerOptions>& GetSchedulerOptionsOverride() {
+    static auto options = boost::optional<SchedulerOptions>();
+    return options;
+  }
+
+  /** Returns the options the Scheduler is constructed with. */
+  inline SchedulerOptions GetSchedulerOptions() {
+    if(auto& options = GetSchedulerOptionsOverride()) {
+      return *options;
+    }
+    return SchedulerOptions::FromEnvironment();
+  }
+}
+
+  inline SchedulerOptions::SchedulerOptions()
+    : m_threadCount(0),
+      m_isWorkStealing(BEAM_SCHEDULER_USE_WORK_STEALING),
+      m_watchdogHook([] (auto routineId, auto contextId, auto duration) {
+        std::cerr << "Routine " << routineId << " on context " << contextId <<
+          " has run for " << duration.total_milliseconds() <<
+          "ms without deferring." << std::endl;
+      }) {}
+
+  inline std::size_t SchedulerOptions::GetThreadCount() const {
+    if(m_threadCount != 0) {
+      return m_threadCount;
+    } else if(!m_cores.empty()) {
+      return m_cores.size();
+    }
+    return std::max<std::size_t>(boost::thread::hardware_concurrency(), 1);
+  }
+
+  inline SchedulerOptions SchedulerOptions::FromEnvironment() {
+    auto options = SchedulerOptions();
+    if(auto threadCount = ReadEnvironmentVariable<std::size_t>(
+        "BEAM_SCHEDULER_THREADS")) {
+      options.m_threadCount = *threadCount;
+    }
+    if(auto cores = ReadEnvironmentVariable<std::string>(
+        "BEAM_SCHEDULER_CORES")) {
+      options.m_cores = Threading::ParseCpuList(*cores);
+    } else if(auto node = ReadEnvironmentVariable<int>(
+        "BEAM_SCHEDULER_NUMA_NODE")) {
+      options.m_cores = Threading::GetNumaNodeCores(*node);
+    }
+    auto reservedCores = ReadEnvironmentVariable<std::string>(
+      "BEAM_SERVICE_CORES");
+    auto isServicePerThread = ReadEnvironmentVariable<int>(
+      "BEAM_SERVICE_PER_THREAD").value_or(0) != 0;
+
+    /* An io_service per thread pool shares the Scheduler's cores. */
+    if(reservedCores && !isServicePerThread) {
+      if(options.m_cores.empty()) {
+        options.m_cores = Threading::GetAvailableCores();
+      }
+      options.m_cores = Threading::ExcludeCores(std::move(options.m_cores),
+        Threading::ParseCpuList(*reservedCores));
+    }
+    if(auto isWorkStealing = ReadEnvironmentVariable<int>(
+        "BEAM_SCHEDULER_WORK_STEALING")) {
+      options.m_isWorkStealing = *isWorkStealing != 0;
+    }
+    if(auto spin = ReadEnvironmentVariable<int>(
+        "BEAM_SCHEDULER_SPIN_MICROSECONDS")) {
+      options.m_spinDuration = boost::posix_time::microseconds(*spin);
+    }
+    if(auto watchdog = ReadEnvironmentVariable<int>(
+        "BEAM_SCHEDULER_WATCHDOG_MILLISECONDS")) {
+      options.m_watchdogThreshold = boost::posix_time::milliseconds(*watchdog);
+    }
+    return options;
+  }
+
+  inline void SetSchedulerOptions(const SchedulerOptions& options) {
+    Details::GetSchedulerOptionsOverride() = options;
+  }
+}
+
+#endif
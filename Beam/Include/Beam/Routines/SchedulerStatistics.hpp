@@ -0,0 +1,97 @@
+#ifndef BEAM_SCHEDULER_STATISTICS_HPP
+#define BEAM_SCHEDULER_STATISTICS_HPP
+#include <array>
+#include <cstdint>
+#include <vector>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include "Beam/Routines/Routines.hpp"
+
+namespace Beam::Routines {
+
+  /** Stores a snapshot of a single Scheduler context's activity. */
+  struct SchedulerContextStatistics {
+
+    /** The number of Routines waiting to run on the context. */
+    std::size_t m_pendingCount;
+
+    /** The number of Routines suspended on the context. */
+    std::size_t m_suspendedCount;
+
+    /** The number of Routines spawned onto the context. */
+    std::uint64_t m_spawnCount;
+
+    /** The number of Routines that completed on the context. */
+    std::uint64_t m_completionCount;
+
+    /** The number of times the context switched into a Routine. */
+    std::uint64_t m_contextSwitchCount;
+
+    /** The number of slices the watchdog reported as too long. */
+    std::uint64_t m_longSliceCount;
+
+    /** The total time spent running Routines. */
+    boost::posix_time::time_duration m_runningTime;
+
+    /** The total time spent between Routines. */
+    boost::posix_time::time_duration m_idleTime;
+  };
+
+  /** Stores a snapshot of the Scheduler's activity. */
+  struct SchedulerStatistics {
+
+    /** The number of buckets in the slice duration histogram. */
+    static constexpr auto SLICE_HISTOGRAM_SIZE = std::size_t(32);
+
+    /** The statistics of each context, indexed by context id. */
+    std::vector<SchedulerContextStatistics> m_contexts;
+
+    /**
+     * Counts Routine slices by duration, bucket 0 counts slices shorter
+     * than 1us and bucket i > 0 counts slices in [2^(i - 1)us, 2^i us), the
+     * last bucket also counts all longer slices.
+     */
+    std::array<std::uint64_t, SLICE_HISTOGRAM_SIZE> m_sliceHistogram;
+
+    /** The number of Routines taken from another context's queue. */
+    std::uint64_t m_stealCount;
+
+    /**
+     * The number of stolen Routines that had already started running on
+     * another context.
+     */
+    std::uint64_t m_migrationCount;
+
+    /**
+     * Returns the histogram bucket a slice belongs to.
+     * @param microseconds The duration of the slice in microseconds.
+     */
+    static std::size_t GetSliceBucket(std::uint64_t microseconds);
+
+    /**
+     * Returns the exclusive upper bound of a histogram bucket.
+     * @param bucket The index of the bucket.
+     */
+    static boost::posix_time::time_duration GetSliceBucketBound(
+      std::size_t bucket);
+  };
+
+  inline std::size_t SchedulerStatistics::GetSliceBucket(
+      std::uint64_t microseconds) {
+    auto bucket = std::size_t(0);
+    while(microseconds != 0 && bucket != SLICE_HISTOGRAM_SIZE - 1) {
+      microseconds >>= 1;
+      ++bucket;
+    }
+    return bucket;
+  }
+
+  inline boost::posix_time::time_duration
+      SchedulerStatistics::GetSliceBucketBound(std::size_t bucket) {
+    if(bucket >= SLICE_HISTOGRAM_SIZE - 1) {
+      return boost::posix_time::pos_infin;
+    }
+    return boost::posix_time::microseconds(std::int64_t(1) << bucket);
+  }
+}
+
+#endif
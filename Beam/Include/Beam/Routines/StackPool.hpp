@@ -0,0 +1,318 @@
+#ifndef BEAM_STACK_POOL_HPP
+#define BEAM_STACK_POOL_HPP
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <vector>
+#include <boost/context/stack_context.hpp>
+#include <boost/context/stack_traits.hpp>
+#ifdef _WIN32
+  #include <Windows.h>
+#else
+  #include <sys/mman.h>
+#endif
+#include "Beam/Routines/Routines.hpp"
+#include "Beam/Utilities/Singleton.hpp"
+
+#ifndef BEAM_STACK_POOL_CACHE_LIMIT
+  #define BEAM_STACK_POOL_CACHE_LIMIT 64
+#endif
+
+#ifndef BEAM_STACK_POOL_USE_GUARD_PAGES
+  #define BEAM_STACK_POOL_USE_GUARD_PAGES false
+#endif
+
+namespace Beam::Routines {
+
+  /**
+   * Recycles Routine stacks through per-context caches, stacks are grouped
+   * into power of two size classes.
+   */
+  class StackPool : public Singleton<StackPool> {
+    public:
+
+      /** Stores counters describing the StackPool's activity. */
+      struct Statistics {
+
+        /** The number of stacks allocated from the operating system. */
+        std::uint64_t m_allocationCount;
+
+        /** The number of stacks served from a context's cache. */
+        std::uint64_t m_reuseCount;
+
+        /** The number of stacks returned to the operating system. */
+        std::uint64_t m_releaseCount;
+      };
+
+      /** The default number of stacks cached per size class and context. */
+      static constexpr auto DEFAULT_CACHE_LIMIT =
+        std::size_t(BEAM_STACK_POOL_CACHE_LIMIT);
+
+      /** Whether guard pages are used by default. */
+      static constexpr auto DEFAULT_USE_GUARD_PAGES =
+        bool(BEAM_STACK_POOL_USE_GUARD_PAGES);
+
+      /** Constructs a StackPool using the default settings. */
+      StackPool();
+
+      /** Returns the number of stacks cached per size class and context. */
+      std::size_t GetCacheLimit() const;
+
+      /**
+       * Sets the number of stacks cached per size class and context, a limit
+       * of 0 disables recycling.
+       */
+      void SetCacheLimit(std::size_t limit);
+
+      /** Returns <code>true</code> iff new stacks have a guard page. */
+      bool IsUsingGuardPages() const;
+
+      /**
+       * Sets whether newly allocated stacks are protected by a guard page
+       * below their lowest address.
+       */
+      void SetUseGuardPages(bool useGuardPages);
+
+      /** Returns the Statistics counted so far. */
+      Statistics GetStatistics() const;
+
+      /**
+       * Returns the size class a stack of a given size belongs to.
+       * @param size The requested stack size.
+       * @return The smallest power of two at least as large as <i>size</i>
+       *         and the system's page size.
+       */
+      static std::size_t GetSizeClass(std::size_t size);
+
+      /**
+       * Allocates a stack.
+       * @param size The minimum usable size of the stack.
+       * @param hasGuardPage Whether the stack is protected by a guard page.
+       */
+      boost::context::stack_context Allocate(std::size_t size,
+        bool hasGuardPage);
+
+      /**
+       * Returns a stack to the calling context's cache.
+       * @param stack The stack to deallocate.
+       * @param hasGuardPage Whether the stack was allocated with a guard page.
+       */
+      void Deallocate(boost::context::stack_context& stack,
+        bool hasGuardPage) noexcept;
+
+    private:
+      struct CachedStack {
+        void* m_base;
+        bool m_hasGuardPage;
+      };
+      struct Cache {
+        std::array<std::vector<CachedStack>, 64> m_stacks;
+
+        ~Cache();
+      };
+      std::atomic_size_t m_cacheLimit;
+      std::atomic_bool m_useGuardPages;
+      std::atomic_uint64_t m_allocationCount;
+      std::atomic_uint64_t m_reuseCount;
+      std::atomic_uint64_t m_releaseCount;
+
+      static Cache& GetCache();
+      static std::size_t GetClassIndex(std::size_t sizeClass);
+      static void* AllocateStack(std::size_t size, bool hasGuardPage);
+      static void ReleaseStack(void* base, std::size_t size,
+        bool hasGuardPage) noexcept;
+  };
+
+  /**
+   * Implements Boost.Context's StackAllocator concept on top of the
+   * StackPool.
+   */
+  class PooledStackAllocator {
+    public:
+
+      /**
+       * Constructs a PooledStackAllocator.
+       * @param size The minimum usable size of the stacks to allocate.
+       */
+      explicit PooledStackAllocator(std::size_t size);
+
+      /** Allocates a stack. */
+      boost::context::stack_context allocate();
+
+      /**
+       * Returns a stack to the pool.
+       * @param stack The stack to deallocate.
+       */
+      void deallocate(boost::context::stack_context& stack) noexcept;
+
+    private:
+      std::size_t m_size;
+      bool m_hasGuardPage;
+  };
+
+  inline StackPool::StackPool()
+    : m_cacheLimit(DEFAULT_CACHE_LIMIT),
+      m_useGuardPages(DEFAULT_USE_GUARD_PAGES),
+      m_allocationCount(0),
+      m_reuseCount(0),
+      m_releaseCount(0) {}
+
+  inline std::size_t StackPool::GetCacheLimit() const {
+    return m_cacheLimit.load(std::memory_order_relaxed);
+  }
+
+  inline void StackPool::SetCacheLimit(std::size_t limit) {
+    m_cacheLimit.store(limit, std::memory_order_relaxed);
+  }
+
+  inline bool StackPool::IsUsingGuardPages() const {
+    return m_useGuardPages.load(std::memory_order_relaxed);
+  }
+
+  inline void StackPool::SetUseGuardPages(bool useGuardPages) {
+    m_useGuardPages.store(useGuardPages, std::memory_order_relaxed);
+  }
+
+  inline StackPool::Statistics StackPool::GetStatistics() const {
+    auto statistics = Statistics();
+    statistics.m_allocationCount =
+      m_allocationCount.load(std::memory_order_relaxed);
+    statistics.m_reuseCount = m_reuseCount.load(std::memory_order_relaxed);
+    statistics.m_releaseCount = m_releaseCount.load(std::memory_order_relaxed);
+    return statistics;
+  }
+
+  inline std::size_t StackPool::GetSizeClass(std::size_t size) {
+    auto sizeClass = boost::context::stack_traits::page_size();
+    while(sizeClass < size) {
+      sizeClass <<= 1;
+    }
+    return sizeClass;
+  }
+
+  inline boost::context::stack_context StackPool::Allocate(std::size_t size,
+      bool hasGuardPage) {
+    auto sizeClass = GetSizeClass(size);
+    auto& stacks = GetCache().m_stacks[GetClassIndex(sizeClass)];
+    auto base = static_cast<void*>(nullptr);
+    while(!stacks.empty()) {
+      auto stack = stacks.back();
+      stacks.pop_back();
+      if(stack.m_hasGuardPage == hasGuardPage) {
+        base = stack.m_base;
+        m_reuseCount.fetch_add(1, std::memory_order_relaxed);
+        break;
+      }
+      ReleaseStack(stack.m_base, sizeClass, stack.m_hasGuardPage);
+      m_releaseCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    if(!base) {
+      base = AllocateStack(sizeClass, hasGuardPage);
+      m_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    auto guardSize = hasGuardPage ?
+      boost::context::stack_traits::page_size() : std::size_t(0);
+    auto stack = boost::context::stack_context();
+    stack.size = sizeClass;
+    stack.sp = static_cast<char*>(base) + guardSize + sizeClass;
+    return stack;
+  }
+
+  inline void StackPool::Deallocate(boost::context::stack_context& stack,
+      bool hasGuardPage) noexcept {
+    auto guardSize = hasGuardPage ?
+      boost::context::stack_traits::page_size() : std::size_t(0);
+    auto base = static_cast<void*>(
+      static_cast<char*>(stack.sp) - stack.size - guardSize);
+    auto& stacks = GetCache().m_stacks[GetClassIndex(stack.size)];
+    if(stacks.size() < GetCacheLimit()) {
+      try {
+        stacks.push_back({base, hasGuardPage});
+        return;
+      } catch(const std::bad_alloc&) {}
+    }
+    ReleaseStack(base, stack.size, hasGuardPage);
+    m_releaseCount.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  inline StackPool::Cache::~Cache() {
+    for(auto i = std::size_t(0); i != m_stacks.size(); ++i) {
+      for(auto& stack : m_stacks[i]) {
+        ReleaseStack(stack.m_base, std::size_t(1) << i, stack.m_hasGuardPage);
+      }
+    }
+  }
+
+  inline StackPool::Cache& StackPool::GetCache() {
+    thread_local auto cache = Cache();
+    return cache;
+  }
+
+  inline std::size_t StackPool::GetClassIndex(std::size_t sizeClass) {
+    auto index = std::size_t(0);
+    while((std::size_t(1) << index) < sizeClass) {
+      ++index;
+    }
+    return index;
+  }
+
+  inline void* StackPool::AllocateStack(std::size_t size, bool hasGuardPage) {
+    if(!hasGuardPage) {
+      auto base = std::malloc(size);
+      if(!base) {
+        throw std::bad_alloc();
+      }
+      return base;
+    }
+    auto guardSize = boost::context::stack_traits::page_size();
+#ifdef _WIN32
+    auto base = ::VirtualAlloc(nullptr, size + guardSize,
+      MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+    if(!base) {
+      throw std::bad_alloc();
+    }
+    auto previousProtection = DWORD();
+    ::VirtualProtect(base, guardSize, PAGE_NOACCESS, &previousProtection);
+#else
+    auto base = ::mmap(nullptr, size + guardSize, PROT_READ | PROT_WRITE,
+      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(base == MAP_FAILED) {
+      throw std::bad_alloc();
+    }
+    ::mprotect(base, guardSize, PROT_NONE);
+#endif
+    return base;
+  }
+
+  inline void StackPool::ReleaseStack(void* base, std::size_t size,
+      bool hasGuardPage) noexcept {
+    if(!hasGuardPage) {
+      std::free(base);
+      return;
+    }
+#ifdef _WIN32
+    ::VirtualFree(base, 0, MEM_RELEASE);
+#else
+    ::munmap(base, size + boost::context::stack_traits::page_size());
+#endif
+  }
+
+  inline PooledStackAllocator::PooledStackAllocator(std::size_t size)
+    : m_size(size),
+      m_hasGuardPage(false) {}
+
+  inline boost::context::stack_context PooledStackAllocator::allocate() {
+    auto& pool = StackPool::GetInstance();
+    m_hasGuardPage = pool.IsUsingGuardPages();
+    return pool.Allocate(m_size, m_hasGuardPage);
+  }
+
+  inline void PooledStackAllocator::deallocate(
+      boost::context::stack_context& stack) noexcept {
+    StackPool::GetInstance().Deallocate(stack, m_hasGuardPage);
+  }
+}
+
+#endif
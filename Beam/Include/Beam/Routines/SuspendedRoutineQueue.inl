@@ -1,6 +1,7 @@
 #ifndef BEAM_SUSPENDED_ROUTINE_QUEUE_INL
 #define BEAM_SUSPENDED_ROUTINE_QUEUE_INL
 #include <type_traits>
+#include <vector>
 #include "Beam/Routines/SuspendedRoutineQueue.hpp"
 #include "Beam/Routines/Routine.hpp"
 
@@ -51,11 +52,20 @@ namespace Beam::Routines {
 
   template<typename... Lock>
   void Resume(Out<SuspendedRoutineQueue> suspendedRoutines) {
-    auto resumedRoutines = SuspendedRoutineQueue();
-    resumedRoutines.swap(*suspendedRoutines);
-    for(auto& routine : resumedRoutines) {
-      Resume(routine.m_routine);
+    if(suspendedRoutines->size() <= 1) {
+      ResumeFront(Store(suspendedRoutines));
+      return;
+    }
+
+    /* The nodes live on the suspended Routines' stacks, so they are unlinked
+       before any Routine is resumed. */
+    auto routines = std::vector<Routine*>();
+    routines.reserve(suspendedRoutines->size());
+    for(auto& routine : *suspendedRoutines) {
+      routines.push_back(routine.m_routine);
     }
+    suspendedRoutines->clear();
+    Resume(Store(routines));
   }
 
   inline SuspendedRoutineNode::SuspendedRoutineNode()
@@ -0,0 +1,155 @@
+#ifndef BEAM_WORK_STEALING_DEQUE_HPP
+#define BEAM_WORK_STEALING_DEQUE_HPP
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include <boost/optional/optional.hpp>
+#include "Beam/Routines/Routines.hpp"
+
+namespace Beam::Routines::Details {
+
+  /**
+   * Implements the stealing end of a lock-free Chase-Lev deque, a single owner
+   * pushes onto the bottom and any thread, including the owner, takes from
+   * the top. There is no owner-side pop so values are taken in FIFO order.
+   * @param <T> The type of value stored, must be trivially copyable.
+   */
+  template<typename T>
+  class WorkStealingDeque {
+    public:
+      static_assert(std::is_trivially_copyable_v<T>);
+
+      /** The type of value stored. */
+      using Type = T;
+
+      /** The initial capacity of the deque. */
+      static constexpr auto INITIAL_CAPACITY = std::int64_t(256);
+
+      /** Constructs an empty WorkStealingDeque. */
+      WorkStealingDeque();
+
+      /** Returns <code>true</code> iff the deque appears empty. */
+      bool IsEmpty() const;
+
+      /** Returns an approximation of the number of values stored. */
+      std::size_t GetSize() const;
+
+      /**
+       * Pushes a value onto the bottom of the deque, only the owner may call
+       * this.
+       * @param value The value to push.
+       */
+      void Push(Type value);
+
+      /**
+       * Takes the value at the top of the deque, safe to call from any thread.
+       * @return The value taken, or <code>none</code> if the deque is empty or
+       *         the value was taken by a competing thread.
+       */
+      boost::optional<Type> Steal();
+
+    private:
+      struct Array {
+        std::int64_t m_capacity;
+        std::unique_ptr<std::atomic<Type>[]> m_values;
+
+        explicit Array(std::int64_t capacity);
+        Type Get(std::int64_t index) const;
+        void Put(std::int64_t index, Type value);
+      };
+      alignas(64) std::atomic_int64_t m_top;
+      alignas(64) std::atomic_int64_t m_bottom;
+      std::atomic<Array*> m_array;
+      std::vector<std::unique_ptr<Array>> m_arrays;
+
+      WorkStealingDeque(const WorkStealingDeque&) = delete;
+      WorkStealingDeque& operator =(const WorkStealingDeque&) = delete;
+      Array* Grow(Array& array, std::int64_t top, std::int64_t bottom);
+  };
+
+  template<typename T>
+  WorkStealingDeque<T>::Array::Array(std::int64_t capacity)
+    : m_capacity(capacity),
+      m_values(std::make_unique<std::atomic<Type>[]>(capacity)) {}
+
+  template<typename T>
+  typename WorkStealingDeque<T>::Type WorkStealingDeque<T>::Array::Get(
+      std::int64_t index) const {
+    return m_values[index & (m_capacity - 1)].load(std::memory_order_relaxed);
+  }
+
+  template<typename T>
+  void WorkStealingDeque<T>::Array::Put(std::int64_t index, Type value) {
+    m_values[index & (m_capacity - 1)].store(value, std::memory_order_relaxed);
+  }
+
+  template<typename T>
+  WorkStealingDeque<T>::WorkStealingDeque()
+      : m_top(0),
+        m_bottom(0) {
+    m_arrays.push_back(std::make_unique<Array>(INITIAL_CAPACITY));
+    m_array.store(m_arrays.back().get(), std::memory_order_relaxed);
+  }
+
+  template<typename T>
+  bool WorkStealingDeque<T>::IsEmpty() const {
+    return GetSize() == 0;
+  }
+
+  template<typename T>
+  std::size_t WorkStealingDeque<T>::GetSize() const {
+    auto bottom = m_bottom.load(std::memory_order_relaxed);
+    auto top = m_top.load(std::memory_order_relaxed);
+    if(bottom <= top) {
+      return 0;
+    }
+    return static_cast<std::size_t>(bottom - top);
+  }
+
+  template<typename T>
+  void WorkStealingDeque<T>::Push(Type value) {
+    auto bottom = m_bottom.load(std::memory_order_relaxed);
+    auto top = m_top.load(std::memory_order_acquire);
+    auto array = m_array.load(std::memory_order_relaxed);
+    if(bottom - top > array->m_capacity - 1) {
+      array = Grow(*array, top, bottom);
+    }
+    array->Put(bottom, value);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+  }
+
+  template<typename T>
+  boost::optional<typename WorkStealingDeque<T>::Type>
+      WorkStealingDeque<T>::Steal() {
+    auto top = m_top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto bottom = m_bottom.load(std::memory_order_acquire);
+    if(top >= bottom) {
+      return boost::none;
+    }
+    auto value = m_array.load(std::memory_order_acquire)->Get(top);
+    if(!m_top.compare_exchange_strong(top, top + 1,
+        std::memory_order_seq_cst, std::memory_order_relaxed)) {
+      return boost::none;
+    }
+    return value;
+  }
+
+  template<typename T>
+  typename WorkStealingDeque<T>::Array* WorkStealingDeque<T>::Grow(
+      Array& array, std::int64_t top, std::int64_t bottom) {
+    auto grownArray = std::make_unique<Array>(2 * array.m_capacity);
+    for(auto i = top; i != bottom; ++i) {
+      grownArray->Put(i, array.Get(i));
+    }
+    auto result = grownArray.get();
+    m_arrays.push_back(std::move(grownArray));
+    m_array.store(result, std::memory_order_release);
+    return result;
+  }
+}
+
+#endif
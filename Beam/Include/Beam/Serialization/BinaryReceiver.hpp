@@ -2,11 +2,13 @@
 #define BEAM_BINARY_RECEIVER_HPP
 #include <cstdint>
 #include <cstring>
+#include <string_view>
 #include <type_traits>
 #include "Beam/IO/Buffer.hpp"
 #include "Beam/Serialization/DataShuttle.hpp"
 #include "Beam/Serialization/ReceiverMixin.hpp"
 #include "Beam/Serialization/SerializationException.hpp"
+#include "Beam/Serialization/VarInt.hpp"
 #include "Beam/Utilities/FixedString.hpp"
 
 namespace Beam {
@@ -33,6 +35,28 @@ namespace Serialization {
 
       void SetSource(Ref<const Source> source);
 
+      //! Sets the source to a range of raw data.
+      /*!
+        \param data The data to receive from, it must remain valid until the
+               source is changed.
+        \param size The size of the <i>data</i>.
+      */
+      void SetSource(const char* data, std::size_t size);
+
+      //! Receives the id of a polymorphic type encoded as a varint.
+      /*!
+        \param name The name of the field.
+        \param id Stores the id received.
+      */
+      void ReceiveTypeId(const char* name, std::uint32_t& id);
+
+      //! Receives a block of raw bytes.
+      /*!
+        \param size The size of the block.
+        \return The block's data, valid until the source is changed.
+      */
+      const char* ReceiveBlock(std::size_t size);
+
       template<typename T>
       typename std::enable_if<std::is_fundamental<T>::value>::type Shuttle(
         const char* name, T& value);
@@ -43,6 +67,14 @@ namespace Serialization {
 
       void Shuttle(const char* name, std::string& value);
 
+      //! Receives a string or Buffer as a view into the source.
+      /*!
+        \param name The name of the field.
+        \param value Stores a view of the data received, valid for as long
+               as the source's data is.
+      */
+      void Shuttle(const char* name, std::string_view& value);
+
       template<std::size_t N>
       void Shuttle(const char* name, FixedString<N>& value);
 
@@ -70,8 +102,39 @@ namespace Serialization {
 
   template<typename SourceType>
   void BinaryReceiver<SourceType>::SetSource(Ref<const Source> source) {
-    m_remainingSize = source->GetSize();
-    m_readIterator = source->GetData();
+    SetSource(source->GetData(), source->GetSize());
+  }
+
+  template<typename SourceType>
+  void BinaryReceiver<SourceType>::SetSource(const char* data,
+      std::size_t size) {
+    m_remainingSize = size;
+    m_readIterator = data;
+  }
+
+  template<typename SourceType>
+  void BinaryReceiver<SourceType>::ReceiveTypeId(const char* name,
+      std::uint32_t& id) {
+    auto value = std::uint64_t();
+    auto size = DecodeVarInt(m_readIterator, m_remainingSize, value);
+    if(size == 0 || value > UINT32_MAX) {
+      BOOST_THROW_EXCEPTION(SerializationException("Invalid type id."));
+    }
+    id = static_cast<std::uint32_t>(value);
+    m_readIterator += size;
+    m_remainingSize -= size;
+  }
+
+  template<typename SourceType>
+  const char* BinaryReceiver<SourceType>::ReceiveBlock(std::size_t size) {
+    if(size > m_remainingSize) {
+      BOOST_THROW_EXCEPTION(SerializationException(
+        "Data length out of range."));
+    }
+    auto data = m_readIterator;
+    m_readIterator += size;
+    m_remainingSize -= size;
+    return data;
   }
 
   template<typename SourceType>
@@ -106,13 +169,21 @@ namespace Serialization {
   template<typename SourceType>
   void BinaryReceiver<SourceType>::Shuttle(const char* name,
       std::string& value) {
+    auto view = std::string_view();
+    Shuttle(name, view);
+    value.assign(view.data(), view.size());
+  }
+
+  template<typename SourceType>
+  void BinaryReceiver<SourceType>::Shuttle(const char* name,
+      std::string_view& value) {
     auto size = std::uint32_t();
     Shuttle(size);
-    if(size < 0 || size > m_remainingSize) {
+    if(size > m_remainingSize) {
       BOOST_THROW_EXCEPTION(SerializationException(
         "String length out of range."));
     }
-    value = std::string(m_readIterator, size);
+    value = std::string_view(m_readIterator, size);
     m_readIterator += size;
     m_remainingSize -= size;
   }
@@ -151,6 +222,9 @@ namespace Serialization {
   struct Inverse<BinaryReceiver<SourceType>> {
     using type = BinarySender<SourceType>;
   };
+
+  template<typename SourceType>
+  struct SupportsBlockShuttle<BinaryReceiver<SourceType>> : std::true_type {};
 }
 
   template<typename SourceType>
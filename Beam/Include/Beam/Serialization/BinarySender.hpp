@@ -2,17 +2,22 @@
 #define BEAM_BINARYSENDER_HPP
 #include <cstdint>
 #include <cstring>
+#include <string_view>
 #include <type_traits>
 #include "Beam/IO/Buffer.hpp"
 #include "Beam/Serialization/DataShuttle.hpp"
 #include "Beam/Serialization/SenderMixin.hpp"
+#include "Beam/Serialization/SerializedSize.hpp"
+#include "Beam/Serialization/VarInt.hpp"
 #include "Beam/Utilities/FixedString.hpp"
 
 namespace Beam {
 namespace Serialization {
 
   /*! \class BinarySender
-      \brief Implements a Sender using a binary format.
+      \brief Implements a Sender using a binary format. Each value shuttled
+             is measured first so that the sink is grown once per value
+             rather than once per field.
       \tparam SinkType The type of Buffer to send the data to.
    */
   template<typename SinkType>
@@ -33,6 +38,36 @@ namespace Serialization {
 
       void SetSink(Ref<Sink> sink);
 
+      //! Returns the number of bytes a value is sent as.
+      /*!
+        \param value The value to measure.
+      */
+      template<typename T>
+      std::size_t GetSerializedSize(const T& value) const;
+
+      template<typename T>
+      void Shuttle(const T& value);
+
+      template<typename T>
+      void Shuttle(const char* name, const T& value);
+
+      template<typename T>
+      void Send(const T& value);
+
+      //! Sends the id of a polymorphic type as a varint.
+      /*!
+        \param name The name of the field.
+        \param id The id to send.
+      */
+      void SendTypeId(const char* name, std::uint32_t id);
+
+      //! Appends a block of raw bytes to be filled in by the caller.
+      /*!
+        \param size The size of the block.
+        \return The block's data, valid until the next value is sent.
+      */
+      char* SendBlock(std::size_t size);
+
       template<typename T>
       typename std::enable_if<std::is_fundamental<T>::value>::type Send(
         const char* name, const T& value);
@@ -44,6 +79,9 @@ namespace Serialization {
       void Send(const char* name, const std::string& value,
         unsigned int version);
 
+      void Send(const char* name, std::string_view value,
+        unsigned int version);
+
       template<std::size_t N>
       void Send(const char* name, const FixedString<N>& value,
         unsigned int version);
@@ -63,7 +101,13 @@ namespace Serialization {
 
     private:
       Sink* m_sink;
-      std::size_t m_size;
+      char* m_cursor;
+      char* m_end;
+      bool m_isReserved;
+
+      void Reserve(std::size_t size);
+      void Release();
+      char* Advance(std::size_t size);
   };
 
   template<typename SinkType>
@@ -74,17 +118,75 @@ namespace Serialization {
   template<typename SinkType>
   void BinarySender<SinkType>::SetSink(Ref<Sink> sink) {
     m_sink = sink.Get();
-    m_size = m_sink->GetSize();
+    m_cursor = nullptr;
+    m_end = nullptr;
+    m_isReserved = false;
+  }
+
+  template<typename SinkType>
+  template<typename T>
+  std::size_t BinarySender<SinkType>::GetSerializedSize(const T& value) const {
+    if constexpr(FixedSerializedSize<T>::value != 0) {
+      return FixedSerializedSize<T>::value;
+    } else {
+      auto counter = SerializedSizeCounter<BinarySender>(
+        this->GetTypeRegistry());
+      counter.SetTypeIdsEnabled(this->AreTypeIdsEnabled());
+      counter.Shuttle(value);
+      return counter.GetSize();
+    }
+  }
+
+  template<typename SinkType>
+  template<typename T>
+  void BinarySender<SinkType>::Shuttle(const T& value) {
+    Shuttle(nullptr, value);
+  }
+
+  template<typename SinkType>
+  template<typename T>
+  void BinarySender<SinkType>::Shuttle(const char* name, const T& value) {
+    if(m_isReserved) {
+      Send(name, value);
+      return;
+    }
+    Reserve(GetSerializedSize(value));
+    m_isReserved = true;
+    try {
+      Send(name, value);
+    } catch(...) {
+      m_isReserved = false;
+      Release();
+      throw;
+    }
+    m_isReserved = false;
+    Release();
+  }
+
+  template<typename SinkType>
+  template<typename T>
+  void BinarySender<SinkType>::Send(const T& value) {
+    Shuttle(nullptr, value);
+  }
+
+  template<typename SinkType>
+  void BinarySender<SinkType>::SendTypeId(const char* name, std::uint32_t id) {
+    char encoding[MAX_VAR_INT_SIZE];
+    auto size = EncodeVarInt(id, encoding);
+    std::memcpy(Advance(size), encoding, size);
+  }
+
+  template<typename SinkType>
+  char* BinarySender<SinkType>::SendBlock(std::size_t size) {
+    return Advance(size);
   }
 
   template<typename SinkType>
   template<typename T>
   typename std::enable_if<std::is_fundamental<T>::value>::type
       BinarySender<SinkType>::Send(const char* name, const T& value) {
-    m_sink->Grow(sizeof(T));
-    std::memcpy(m_sink->GetMutableData() + m_size,
-      reinterpret_cast<const char*>(&value), sizeof(T));
-    m_size += sizeof(T);
+    std::memcpy(Advance(sizeof(T)), reinterpret_cast<const char*>(&value),
+      sizeof(T));
   }
 
   template<typename SinkType>
@@ -92,29 +194,29 @@ namespace Serialization {
   typename std::enable_if<ImplementsConcept<T, IO::Buffer>::value>::type
       BinarySender<SinkType>::Send(const char* name, const T& value) {
     auto size = static_cast<std::uint32_t>(value.GetSize());
-    Shuttle(size);
-    m_sink->Grow(size);
-    std::memcpy(m_sink->GetMutableData() + m_size, value.GetData(), size);
-    m_size += size;
+    Send(name, size);
+    std::memcpy(Advance(size), value.GetData(), size);
   }
 
   template<typename SinkType>
   void BinarySender<SinkType>::Send(const char* name, const std::string& value,
       unsigned int version) {
+    Send(name, std::string_view(value), version);
+  }
+
+  template<typename SinkType>
+  void BinarySender<SinkType>::Send(const char* name, std::string_view value,
+      unsigned int version) {
     auto size = static_cast<std::uint32_t>(value.size());
-    Shuttle(size);
-    m_sink->Grow(size);
-    std::memcpy(m_sink->GetMutableData() + m_size, value.c_str(), size);
-    m_size += size;
+    Send(name, size);
+    std::memcpy(Advance(size), value.data(), size);
   }
 
   template<typename SinkType>
   template<std::size_t N>
   void BinarySender<SinkType>::Send(const char* name,
       const FixedString<N>& value, unsigned int version) {
-    m_sink->Grow(N);
-    std::memcpy(m_sink->GetMutableData() + m_size, value.GetData(), N);
-    m_size += N;
+    std::memcpy(Advance(N), value.GetData(), N);
   }
 
   template<typename SinkType>
@@ -126,7 +228,7 @@ namespace Serialization {
   template<typename SinkType>
   void BinarySender<SinkType>::StartSequence(const char* name,
       const int& size) {
-    Shuttle(size);
+    Send(name, size);
   }
 
   template<typename SinkType>
@@ -135,10 +237,47 @@ namespace Serialization {
   template<typename SinkType>
   void BinarySender<SinkType>::EndSequence() {}
 
+  template<typename SinkType>
+  void BinarySender<SinkType>::Reserve(std::size_t size) {
+    auto available = static_cast<std::size_t>(m_end - m_cursor);
+    if(size <= available) {
+      return;
+    }
+    auto offset = m_sink->GetSize() - available;
+    m_sink->Grow(size - available);
+    auto data = m_sink->GetMutableData();
+    m_cursor = data + offset;
+    m_end = data + m_sink->GetSize();
+  }
+
+  template<typename SinkType>
+  void BinarySender<SinkType>::Release() {
+    if(m_cursor != m_end) {
+      m_sink->Shrink(static_cast<std::size_t>(m_end - m_cursor));
+      m_end = m_cursor;
+    }
+  }
+
+  template<typename SinkType>
+  char* BinarySender<SinkType>::Advance(std::size_t size) {
+    if(static_cast<std::size_t>(m_end - m_cursor) < size) {
+      Reserve(size);
+    }
+    auto cursor = m_cursor;
+    m_cursor += size;
+    return cursor;
+  }
+
   template<typename SinkType>
   struct Inverse<BinarySender<SinkType>> {
     using type = BinaryReceiver<SinkType>;
   };
+
+  template<typename SinkType>
+  struct SupportsBlockShuttle<BinarySender<SinkType>> : std::true_type {};
+
+  template<typename SinkType>
+  struct SupportsSerializedSize<BinarySender<SinkType>> : std::true_type {};
 }
 
   template<typename SinkType>
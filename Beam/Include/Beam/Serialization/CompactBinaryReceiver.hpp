@@ -0,0 +1,251 @@
+#ifndef BEAM_COMPACT_BINARY_RECEIVER_HPP
+#define BEAM_COMPACT_BINARY_RECEIVER_HPP
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include "Beam/IO/Buffer.hpp"
+#include "Beam/Serialization/DataShuttle.hpp"
+#include "Beam/Serialization/ReceiverMixin.hpp"
+#include "Beam/Serialization/SerializationException.hpp"
+#include "Beam/Serialization/VarInt.hpp"
+#include "Beam/Utilities/FixedString.hpp"
+
+namespace Beam::Serialization {
+
+  /**
+   * Implements a Receiver for data sent by a CompactBinarySender.
+   * @param <S> The type of Buffer to receive the data from.
+   */
+  template<typename S>
+  class CompactBinaryReceiver :
+      public ReceiverMixin<CompactBinaryReceiver<S>> {
+    public:
+      static_assert(ImplementsConcept<S, IO::Buffer>::value,
+        "S must implement the Buffer Concept.");
+      using Source = S;
+
+      /** Constructs a CompactBinaryReceiver. */
+      CompactBinaryReceiver() = default;
+
+      /**
+       * Constructs a CompactBinaryReceiver.
+       * @param registry The TypeRegistry used for receiving polymorphic types.
+       */
+      CompactBinaryReceiver(
+        Ref<TypeRegistry<CompactBinarySender<S>>> registry);
+
+      void SetSource(Ref<const Source> source);
+
+      /**
+       * Sets the source to a range of raw data.
+       * @param data The data to receive from, it must remain valid until the
+       *        source is changed.
+       * @param size The size of the <i>data</i>.
+       */
+      void SetSource(const char* data, std::size_t size);
+
+      /**
+       * Receives the id of a polymorphic type.
+       * @param name The name of the field.
+       * @param id Stores the id received.
+       */
+      void ReceiveTypeId(const char* name, std::uint32_t& id);
+
+      template<typename T>
+      std::enable_if_t<std::is_fundamental_v<T>> Shuttle(const char* name,
+        T& value);
+
+      template<typename T>
+      std::enable_if_t<ImplementsConcept<T, IO::Buffer>::value> Shuttle(
+        const char* name, T& value);
+
+      void Shuttle(const char* name, std::string& value);
+
+      template<std::size_t N>
+      void Shuttle(const char* name, FixedString<N>& value);
+
+      void StartStructure(const char* name);
+
+      void EndStructure();
+
+      void StartSequence(const char* name, int& size);
+
+      void StartSequence(const char* name);
+
+      void EndSequence();
+
+      using ReceiverMixin<CompactBinaryReceiver<S>>::Shuttle;
+
+    private:
+      std::size_t m_remainingSize;
+      const char* m_readIterator;
+
+      std::uint64_t ReceiveVarInt();
+      std::size_t ReceiveSize();
+      void ReceiveBytes(char* data, std::size_t size);
+  };
+
+  template<typename S>
+  CompactBinaryReceiver<S>::CompactBinaryReceiver(
+    Ref<TypeRegistry<CompactBinarySender<S>>> registry)
+    : ReceiverMixin<CompactBinaryReceiver<S>>(Ref(registry)) {}
+
+  template<typename S>
+  void CompactBinaryReceiver<S>::SetSource(Ref<const Source> source) {
+    SetSource(source->GetData(), source->GetSize());
+  }
+
+  template<typename S>
+  void CompactBinaryReceiver<S>::SetSource(const char* data,
+      std::size_t size) {
+    m_remainingSize = size;
+    m_readIterator = data;
+  }
+
+  template<typename S>
+  void CompactBinaryReceiver<S>::ReceiveTypeId(const char* name,
+      std::uint32_t& id) {
+    auto value = ReceiveVarInt();
+    if(value > std::numeric_limits<std::uint32_t>::max()) {
+      BOOST_THROW_EXCEPTION(SerializationException("Invalid type id."));
+    }
+    id = static_cast<std::uint32_t>(value);
+  }
+
+  template<typename S>
+  template<typename T>
+  std::enable_if_t<std::is_fundamental_v<T>> CompactBinaryReceiver<S>::Shuttle(
+      const char* name, T& value) {
+    if constexpr(std::is_integral_v<T> && !std::is_same_v<T, bool> &&
+        sizeof(T) > 1) {
+      auto encoding = ReceiveVarInt();
+      if constexpr(std::is_signed_v<T>) {
+        auto decoding = DecodeZigZag(encoding);
+        if(decoding < std::numeric_limits<T>::min() ||
+            decoding > std::numeric_limits<T>::max()) {
+          BOOST_THROW_EXCEPTION(SerializationException(
+            "Integer out of range."));
+        }
+        value = static_cast<T>(decoding);
+      } else {
+        if(encoding > std::numeric_limits<T>::max()) {
+          BOOST_THROW_EXCEPTION(SerializationException(
+            "Integer out of range."));
+        }
+        value = static_cast<T>(encoding);
+      }
+    } else {
+      ReceiveBytes(reinterpret_cast<char*>(&value), sizeof(T));
+    }
+  }
+
+  template<typename S>
+  template<typename T>
+  std::enable_if_t<ImplementsConcept<T, IO::Buffer>::value>
+      CompactBinaryReceiver<S>::Shuttle(const char* name, T& value) {
+    auto size = ReceiveSize();
+    value.Reset();
+    value.Append(m_readIterator, size);
+    m_readIterator += size;
+    m_remainingSize -= size;
+  }
+
+  template<typename S>
+  void CompactBinaryReceiver<S>::Shuttle(const char* name,
+      std::string& value) {
+    auto size = ReceiveSize();
+    value.assign(m_readIterator, size);
+    m_readIterator += size;
+    m_remainingSize -= size;
+  }
+
+  template<typename S>
+  template<std::size_t N>
+  void CompactBinaryReceiver<S>::Shuttle(const char* name,
+      FixedString<N>& value) {
+    if(N > m_remainingSize) {
+      BOOST_THROW_EXCEPTION(SerializationException(
+        "String length out of range."));
+    }
+    value = FixedString<N>(m_readIterator, N);
+    m_readIterator += N;
+    m_remainingSize -= N;
+  }
+
+  template<typename S>
+  void CompactBinaryReceiver<S>::StartStructure(const char* name) {}
+
+  template<typename S>
+  void CompactBinaryReceiver<S>::EndStructure() {}
+
+  template<typename S>
+  void CompactBinaryReceiver<S>::StartSequence(const char* name, int& size) {
+    auto value = ReceiveVarInt();
+    if(value > static_cast<std::uint64_t>(std::numeric_limits<int>::max())) {
+      BOOST_THROW_EXCEPTION(SerializationException(
+        "Sequence length out of range."));
+    }
+    size = static_cast<int>(value);
+  }
+
+  template<typename S>
+  void CompactBinaryReceiver<S>::StartSequence(const char* name) {}
+
+  template<typename S>
+  void CompactBinaryReceiver<S>::EndSequence() {}
+
+  template<typename S>
+  std::uint64_t CompactBinaryReceiver<S>::ReceiveVarInt() {
+    if(m_remainingSize != 0 && (*m_readIterator & 0x80) == 0) {
+      auto value = static_cast<std::uint64_t>(*m_readIterator);
+      ++m_readIterator;
+      --m_remainingSize;
+      return value;
+    }
+    auto value = std::uint64_t();
+    auto size = DecodeVarInt(m_readIterator, m_remainingSize, value);
+    if(size == 0) {
+      BOOST_THROW_EXCEPTION(SerializationException(
+        "Data length out of range."));
+    }
+    m_readIterator += size;
+    m_remainingSize -= size;
+    return value;
+  }
+
+  template<typename S>
+  std::size_t CompactBinaryReceiver<S>::ReceiveSize() {
+    auto size = ReceiveVarInt();
+    if(size > m_remainingSize) {
+      BOOST_THROW_EXCEPTION(SerializationException(
+        "Data length out of range."));
+    }
+    return static_cast<std::size_t>(size);
+  }
+
+  template<typename S>
+  void CompactBinaryReceiver<S>::ReceiveBytes(char* data, std::size_t size) {
+    if(size > m_remainingSize) {
+      BOOST_THROW_EXCEPTION(SerializationException(
+        "Data length out of range."));
+    }
+    std::memcpy(data, m_readIterator, size);
+    m_readIterator += size;
+    m_remainingSize -= size;
+  }
+
+  template<typename S>
+  struct Inverse<CompactBinaryReceiver<S>> {
+    using type = CompactBinarySender<S>;
+  };
+}
+
+namespace Beam {
+  template<typename S>
+  struct ImplementsConcept<Serialization::CompactBinaryReceiver<S>,
+    Serialization::Receiver<S>> : std::true_type {};
+}
+
+#endif
@@ -0,0 +1,185 @@
+#ifndef BEAM_COMPACT_BINARY_SENDER_HPP
+#define BEAM_COMPACT_BINARY_SENDER_HPP
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include "Beam/IO/Buffer.hpp"
+#include "Beam/Serialization/DataShuttle.hpp"
+#include "Beam/Serialization/SenderMixin.hpp"
+#include "Beam/Serialization/VarInt.hpp"
+#include "Beam/Utilities/FixedString.hpp"
+
+namespace Beam::Serialization {
+
+  /**
+   * Implements a Sender using a binary format that encodes integers wider
+   * than a byte as LEB128 varints, ZigZag mapping the signed ones.
+   * @param <S> The type of Buffer to send the data to.
+   */
+  template<typename S>
+  class CompactBinarySender : public SenderMixin<CompactBinarySender<S>> {
+    public:
+      static_assert(ImplementsConcept<S, IO::Buffer>::value,
+        "S must implement the Buffer Concept.");
+      using Sink = S;
+
+      /** Constructs a CompactBinarySender. */
+      CompactBinarySender() = default;
+
+      /**
+       * Constructs a CompactBinarySender.
+       * @param registry The TypeRegistry used for sending polymorphic types.
+       */
+      CompactBinarySender(Ref<TypeRegistry<CompactBinarySender>> registry);
+
+      void SetSink(Ref<Sink> sink);
+
+      /**
+       * Sends the id of a polymorphic type.
+       * @param name The name of the field.
+       * @param id The id to send.
+       */
+      void SendTypeId(const char* name, std::uint32_t id);
+
+      template<typename T>
+      std::enable_if_t<std::is_fundamental_v<T>> Send(const char* name,
+        const T& value);
+
+      template<typename T>
+      std::enable_if_t<ImplementsConcept<T, IO::Buffer>::value> Send(
+        const char* name, const T& value);
+
+      void Send(const char* name, const std::string& value,
+        unsigned int version);
+
+      template<std::size_t N>
+      void Send(const char* name, const FixedString<N>& value,
+        unsigned int version);
+
+      void StartStructure(const char* name);
+
+      void EndStructure();
+
+      void StartSequence(const char* name, const int& size);
+
+      void StartSequence(const char* name);
+
+      void EndSequence();
+
+      using SenderMixin<CompactBinarySender<S>>::Send;
+      using SenderMixin<CompactBinarySender<S>>::Shuttle;
+
+    private:
+      Sink* m_sink;
+      std::size_t m_size;
+
+      void SendVarInt(std::uint64_t value);
+      void SendBytes(const char* data, std::size_t size);
+  };
+
+  template<typename S>
+  CompactBinarySender<S>::CompactBinarySender(
+    Ref<TypeRegistry<CompactBinarySender>> registry)
+    : SenderMixin<CompactBinarySender<S>>(Ref(registry)) {}
+
+  template<typename S>
+  void CompactBinarySender<S>::SetSink(Ref<Sink> sink) {
+    m_sink = sink.Get();
+    m_size = m_sink->GetSize();
+  }
+
+  template<typename S>
+  void CompactBinarySender<S>::SendTypeId(const char* name,
+      std::uint32_t id) {
+    SendVarInt(id);
+  }
+
+  template<typename S>
+  template<typename T>
+  std::enable_if_t<std::is_fundamental_v<T>> CompactBinarySender<S>::Send(
+      const char* name, const T& value) {
+    if constexpr(std::is_integral_v<T> && !std::is_same_v<T, bool> &&
+        sizeof(T) > 1) {
+      if constexpr(std::is_signed_v<T>) {
+        SendVarInt(EncodeZigZag(value));
+      } else {
+        SendVarInt(value);
+      }
+    } else {
+      SendBytes(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+  }
+
+  template<typename S>
+  template<typename T>
+  std::enable_if_t<ImplementsConcept<T, IO::Buffer>::value>
+      CompactBinarySender<S>::Send(const char* name, const T& value) {
+    SendVarInt(value.GetSize());
+    SendBytes(value.GetData(), value.GetSize());
+  }
+
+  template<typename S>
+  void CompactBinarySender<S>::Send(const char* name,
+      const std::string& value, unsigned int version) {
+    SendVarInt(value.size());
+    SendBytes(value.data(), value.size());
+  }
+
+  template<typename S>
+  template<std::size_t N>
+  void CompactBinarySender<S>::Send(const char* name,
+      const FixedString<N>& value, unsigned int version) {
+    SendBytes(value.GetData(), N);
+  }
+
+  template<typename S>
+  void CompactBinarySender<S>::StartStructure(const char* name) {}
+
+  template<typename S>
+  void CompactBinarySender<S>::EndStructure() {}
+
+  template<typename S>
+  void CompactBinarySender<S>::StartSequence(const char* name,
+      const int& size) {
+    SendVarInt(static_cast<std::uint32_t>(size));
+  }
+
+  template<typename S>
+  void CompactBinarySender<S>::StartSequence(const char* name) {}
+
+  template<typename S>
+  void CompactBinarySender<S>::EndSequence() {}
+
+  template<typename S>
+  void CompactBinarySender<S>::SendVarInt(std::uint64_t value) {
+    if(value < 0x80) {
+      m_sink->Grow(1);
+      m_sink->GetMutableData()[m_size] = static_cast<char>(value);
+      ++m_size;
+      return;
+    }
+    char encoding[MAX_VAR_INT_SIZE];
+    SendBytes(encoding, EncodeVarInt(value, encoding));
+  }
+
+  template<typename S>
+  void CompactBinarySender<S>::SendBytes(const char* data, std::size_t size) {
+    m_sink->Grow(size);
+    std::memcpy(m_sink->GetMutableData() + m_size, data, size);
+    m_size += size;
+  }
+
+  template<typename S>
+  struct Inverse<CompactBinarySender<S>> {
+    using type = CompactBinaryReceiver<S>;
+  };
+}
+
+namespace Beam {
+  template<typename S>
+  struct ImplementsConcept<Serialization::CompactBinarySender<S>,
+    Serialization::Sender<S>> : std::true_type {};
+}
+
+#endif
@@ -1,5 +1,7 @@
 #ifndef BEAM_DATASHUTTLE_HPP
 #define BEAM_DATASHUTTLE_HPP
+#include <cstddef>
+#include <cstring>
 #include <type_traits>
 #include <boost/throw_exception.hpp>
 #include "Beam/Serialization/SerializationException.hpp"
@@ -165,6 +167,75 @@ namespace Serialization {
   template<typename T>
   struct IsSequence : std::false_type {};
 
+  /*! \class IsBitwiseShuttleable
+      \brief Type trait for whether a type is shuttled by a binary shuttler
+             as the bytes of its in-memory representation, letting sequences
+             of it be copied as a single block. Record types may opt in by
+             specializing this trait, they must be trivially copyable and
+             shuttle every member in declaration order with no padding.
+      \tparam T The type to check.
+   */
+  template<typename T, typename Enabled = void>
+  struct IsBitwiseShuttleable : std::integral_constant<bool,
+    std::is_arithmetic<T>::value && !std::is_same<T, bool>::value> {};
+
+  /*! \class SupportsBlockShuttle
+      \brief Type trait for whether a shuttler sends IsBitwiseShuttleable
+             values as their raw bytes and implements SendBlock or
+             ReceiveBlock.
+      \tparam T The type of shuttler.
+   */
+  template<typename T>
+  struct SupportsBlockShuttle : std::false_type {};
+
+  /*! \class SupportsSerializedSize
+      \brief Type trait for whether a Sender's encoding can be measured by a
+             SerializedSizeCounter before it is sent.
+      \tparam T The type of Sender.
+   */
+  template<typename T>
+  struct SupportsSerializedSize : std::false_type {};
+
+  //! Whether a sequence of values can be shuttled as a single block.
+  /*!
+    \tparam Shuttler The type of shuttler.
+    \tparam T The type of value in the sequence.
+  */
+  template<typename Shuttler, typename T>
+  constexpr auto IsBlockShuttleable = SupportsBlockShuttle<Shuttler>::value &&
+    IsBitwiseShuttleable<T>::value && std::is_trivially_copyable<T>::value;
+
+namespace Details {
+  template<typename T>
+  constexpr auto BITWISE_SIZE = sizeof(T) +
+    (IsStructure<T>::value ? sizeof(unsigned int) : 0);
+
+  /* Records that opt into IsBitwiseShuttleable must have no padding, the
+     value of padding bytes is unspecified and would be sent over the wire. */
+  template<typename T>
+  constexpr auto HAS_BITWISE_LAYOUT = !IsStructure<T>::value ||
+    std::has_unique_object_representations_v<T>;
+
+  template<typename Shuttler, typename T>
+  void SendBitwise(Shuttler& shuttle, const T* values, std::size_t count) {
+    static_assert(HAS_BITWISE_LAYOUT<T>,
+      "Bitwise shuttleable records must not contain padding.");
+    auto block = shuttle.SendBlock(count * BITWISE_SIZE<T>);
+    if constexpr(IsStructure<T>::value) {
+
+      /* Structures are preceded by their version. */
+      auto version = Version<T>::value;
+      for(auto i = std::size_t(0); i != count; ++i) {
+        std::memcpy(block, &version, sizeof(version));
+        std::memcpy(block + sizeof(version), values + i, sizeof(T));
+        block += BITWISE_SIZE<T>;
+      }
+    } else {
+      std::memcpy(block, values, count * sizeof(T));
+    }
+  }
+}
+
   /*! \class Shuttle
       \brief Contains operations for shuttling a type.
       \tparam T The type being specialized.
@@ -1,5 +1,7 @@
 #ifndef BEAM_RECEIVER_HPP
 #define BEAM_RECEIVER_HPP
+#include <cstddef>
+#include <cstring>
 #include "Beam/Pointers/Ref.hpp"
 #include "Beam/Serialization/DataShuttle.hpp"
 #include "Beam/Utilities/StaticMemberChecks.hpp"
@@ -117,6 +119,47 @@ namespace Details {
       T& value) const {
     DataShuttle::Receive(shuttle, name, value);
   }
+
+namespace Details {
+  /* Receives a sequence of bitwise values into storage for count elements.
+     If the sender's version of a structure differs from this one, its
+     in-memory layout may differ too, so each element is received through its
+     Shuttle method instead. */
+  template<typename Shuttler, typename T>
+  void ReceiveBitwise(Shuttler& shuttle, T* values, std::size_t count) {
+    static_assert(HAS_BITWISE_LAYOUT<T>,
+      "Bitwise shuttleable records must not contain padding.");
+    if constexpr(IsStructure<T>::value) {
+      if(count == 0) {
+        return;
+      }
+      auto version = Version<T>::value;
+      shuttle.Shuttle("__version", version);
+      if(version != Version<T>::value) {
+        Receive<T>()(shuttle, values[0], version);
+        for(auto i = std::size_t(1); i != count; ++i) {
+          shuttle.Shuttle(values[i]);
+        }
+        return;
+      }
+      auto block = shuttle.ReceiveBlock(
+        count * BITWISE_SIZE<T> - sizeof(version));
+      std::memcpy(values, block, sizeof(T));
+      block += sizeof(T);
+      for(auto i = std::size_t(1); i != count; ++i) {
+        std::memcpy(&version, block, sizeof(version));
+        if(version != Version<T>::value) {
+          BOOST_THROW_EXCEPTION(SerializationException("Version mismatch."));
+        }
+        std::memcpy(values + i, block + sizeof(version), sizeof(T));
+        block += BITWISE_SIZE<T>;
+      }
+    } else {
+      std::memcpy(values, shuttle.ReceiveBlock(count * sizeof(T)),
+        count * sizeof(T));
+    }
+  }
+}
 }
 
   template<typename T>
@@ -1,5 +1,7 @@
 #ifndef BEAM_RECEIVERMIXIN_HPP
 #define BEAM_RECEIVERMIXIN_HPP
+#include <cstdint>
+#include <string>
 #include "Beam/Serialization/Receiver.hpp"
 #include "Beam/Serialization/TypeRegistry.hpp"
 
@@ -24,6 +26,27 @@ namespace Serialization {
       ReceiverMixin(Ref<TypeRegistry<typename Inverse<ReceiverType>::type>>
         registry);
 
+      //! Returns the TypeRegistry used for receiving polymorphic types.
+      const TypeRegistry<typename Inverse<ReceiverType>::type>*
+        GetTypeRegistry() const;
+
+      //! Returns <code>true</code> iff polymorphic types are received by id.
+      bool AreTypeIdsEnabled() const;
+
+      //! Sets whether polymorphic types are received by id or by name.
+      /*!
+        \param isEnabled <code>true</code> to receive the TypeRegistry's ids,
+               <code>false</code> to receive type names.
+      */
+      void SetTypeIdsEnabled(bool isEnabled);
+
+      //! Receives the id of a polymorphic type.
+      /*!
+        \param name The name of the field.
+        \param id Stores the id received.
+      */
+      void ReceiveTypeId(const char* name, std::uint32_t& id);
+
       template<typename T>
       void Shuttle(T& value, void* dummy = nullptr);
 
@@ -56,16 +79,41 @@ namespace Serialization {
 
     private:
       TypeRegistry<typename Inverse<ReceiverType>::type>* m_typeRegistry;
+      bool m_areTypeIdsEnabled;
   };
 
   template<typename ReceiverType>
   ReceiverMixin<ReceiverType>::ReceiverMixin()
-      : m_typeRegistry(nullptr) {}
+      : m_typeRegistry(nullptr),
+        m_areTypeIdsEnabled(false) {}
 
   template<typename ReceiverType>
   ReceiverMixin<ReceiverType>::ReceiverMixin(Ref<TypeRegistry<
       typename Inverse<ReceiverType>::type>> registry)
-      : m_typeRegistry(registry.Get()) {}
+      : m_typeRegistry(registry.Get()),
+        m_areTypeIdsEnabled(false) {}
+
+  template<typename ReceiverType>
+  const TypeRegistry<typename Inverse<ReceiverType>::type>*
+      ReceiverMixin<ReceiverType>::GetTypeRegistry() const {
+    return m_typeRegistry;
+  }
+
+  template<typename ReceiverType>
+  bool ReceiverMixin<ReceiverType>::AreTypeIdsEnabled() const {
+    return m_areTypeIdsEnabled;
+  }
+
+  template<typename ReceiverType>
+  void ReceiverMixin<ReceiverType>::SetTypeIdsEnabled(bool isEnabled) {
+    m_areTypeIdsEnabled = isEnabled;
+  }
+
+  template<typename ReceiverType>
+  void ReceiverMixin<ReceiverType>::ReceiveTypeId(const char* name,
+      std::uint32_t& id) {
+    static_cast<ReceiverType*>(this)->Shuttle(name, id);
+  }
 
   template<typename ReceiverType>
   template<typename T>
@@ -122,17 +170,28 @@ namespace Serialization {
       void* dummy) {
     assert(m_typeRegistry != nullptr);
     static_cast<ReceiverType*>(this)->StartStructure(name);
-    std::string typeName;
-    static_cast<ReceiverType*>(this)->Shuttle("__type", typeName);
-    if(typeName == "__null") {
+    auto entry = static_cast<const TypeEntry<
+      typename Inverse<ReceiverType>::type>*>(nullptr);
+    if(m_areTypeIdsEnabled) {
+      auto id = std::uint32_t();
+      static_cast<ReceiverType*>(this)->ReceiveTypeId("__type", id);
+      if(id != TypeRegistry<typename Inverse<ReceiverType>::type>::NULL_ID) {
+        entry = &m_typeRegistry->GetEntryById(id);
+      }
+    } else {
+      std::string typeName;
+      static_cast<ReceiverType*>(this)->Shuttle("__type", typeName);
+      if(typeName != "__null") {
+        entry = &m_typeRegistry->GetEntry(typeName);
+      }
+    }
+    if(entry == nullptr) {
       value = nullptr;
     } else {
       unsigned int version;
       static_cast<ReceiverType*>(this)->Shuttle("__version", version);
-      const TypeEntry<typename Inverse<ReceiverType>::type>& entry =
-        m_typeRegistry->GetEntry(typeName);
-      value = entry.template Build<T>();
-      entry.Receive(*static_cast<ReceiverType*>(this), value, version);
+      value = entry->template Build<T>();
+      entry->Receive(*static_cast<ReceiverType*>(this), value, version);
     }
     static_cast<ReceiverType*>(this)->EndStructure();
   }
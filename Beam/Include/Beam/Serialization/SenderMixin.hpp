@@ -1,5 +1,6 @@
 #ifndef BEAM_SENDERMIXIN_HPP
 #define BEAM_SENDERMIXIN_HPP
+#include <cstdint>
 #include <type_traits>
 #include "Beam/Pointers/Ref.hpp"
 #include "Beam/Serialization/Sender.hpp"
@@ -26,6 +27,26 @@ namespace Serialization {
       */
       SenderMixin(Ref<TypeRegistry<SenderType>> registry);
 
+      //! Returns the TypeRegistry used for sending polymorphic types.
+      const TypeRegistry<SenderType>* GetTypeRegistry() const;
+
+      //! Returns <code>true</code> iff polymorphic types are sent by id.
+      bool AreTypeIdsEnabled() const;
+
+      //! Sets whether polymorphic types are sent by id or by name.
+      /*!
+        \param isEnabled <code>true</code> to send the TypeRegistry's ids,
+               <code>false</code> to send type names.
+      */
+      void SetTypeIdsEnabled(bool isEnabled);
+
+      //! Sends the id of a polymorphic type.
+      /*!
+        \param name The name of the field.
+        \param id The id to send.
+      */
+      void SendTypeId(const char* name, std::uint32_t id);
+
       template<typename T>
       void Shuttle(const T& value);
 
@@ -73,15 +94,40 @@ namespace Serialization {
 
     private:
       TypeRegistry<SenderType>* m_typeRegistry;
+      bool m_areTypeIdsEnabled;
   };
 
   template<typename SenderType>
   SenderMixin<SenderType>::SenderMixin()
-      : m_typeRegistry(nullptr) {}
+      : m_typeRegistry(nullptr),
+        m_areTypeIdsEnabled(false) {}
 
   template<typename SenderType>
   SenderMixin<SenderType>::SenderMixin(Ref<TypeRegistry<SenderType>> registry)
-      : m_typeRegistry(registry.Get()) {}
+      : m_typeRegistry(registry.Get()),
+        m_areTypeIdsEnabled(false) {}
+
+  template<typename SenderType>
+  const TypeRegistry<SenderType>*
+      SenderMixin<SenderType>::GetTypeRegistry() const {
+    return m_typeRegistry;
+  }
+
+  template<typename SenderType>
+  bool SenderMixin<SenderType>::AreTypeIdsEnabled() const {
+    return m_areTypeIdsEnabled;
+  }
+
+  template<typename SenderType>
+  void SenderMixin<SenderType>::SetTypeIdsEnabled(bool isEnabled) {
+    m_areTypeIdsEnabled = isEnabled;
+  }
+
+  template<typename SenderType>
+  void SenderMixin<SenderType>::SendTypeId(const char* name,
+      std::uint32_t id) {
+    static_cast<SenderType*>(this)->Send(name, id);
+  }
 
   template<typename SenderType>
   template<typename T>
@@ -165,9 +211,16 @@ namespace Serialization {
     if(value != nullptr) {
       const TypeEntry<SenderType>& entry =
         m_typeRegistry->GetEntry(*value);
-      static_cast<SenderType*>(this)->Send("__type", entry.GetName(), 0);
+      if(m_areTypeIdsEnabled) {
+        static_cast<SenderType*>(this)->SendTypeId("__type", entry.GetId());
+      } else {
+        static_cast<SenderType*>(this)->Send("__type", entry.GetName(), 0);
+      }
       static_cast<SenderType*>(this)->Send("__version", version);
       entry.Send(*static_cast<SenderType*>(this), value, version);
+    } else if(m_areTypeIdsEnabled) {
+      static_cast<SenderType*>(this)->SendTypeId("__type",
+        TypeRegistry<SenderType>::NULL_ID);
     } else {
       std::string nullTypeName = "__null";
       static_cast<SenderType*>(this)->Send("__type", nullTypeName, 0);
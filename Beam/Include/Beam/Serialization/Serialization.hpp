@@ -5,6 +5,8 @@ namespace Beam {
 namespace Serialization {
   template<typename SourceType> class BinaryReceiver;
   template<typename SinkType> class BinarySender;
+  template<typename S> class CompactBinaryReceiver;
+  template<typename S> class CompactBinarySender;
   struct DataShuttle;
   template<typename T> struct Inverse;
   template<typename T, typename Enabled = void> struct IsReceiver;
@@ -18,6 +20,7 @@ namespace Serialization {
   template<typename SinkType> struct Sender;
   template<typename SenderType> class SenderMixin;
   class SerializationException;
+  template<typename S> class SerializedSizeCounter;
   template<typename T> class SerializedValue;
   template<typename SenderType> class TypeEntry;
   template<typename SenderType> class TypeRegistry;
@@ -0,0 +1,251 @@
+#ifndef BEAM_SERIALIZED_SIZE_HPP
+#define BEAM_SERIALIZED_SIZE_HPP
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/mpl/at.hpp>
+#include <boost/mpl/size.hpp>
+#include "Beam/IO/Buffer.hpp"
+#include "Beam/Serialization/DataShuttle.hpp"
+#include "Beam/Serialization/SenderMixin.hpp"
+#include "Beam/Serialization/TypeRegistry.hpp"
+#include "Beam/Serialization/VarInt.hpp"
+#include "Beam/Utilities/FixedString.hpp"
+
+namespace Beam::Serialization {
+  template<typename T, typename Enabled = void>
+  struct FixedSerializedSize;
+
+namespace Details {
+  template<typename T, typename = void>
+  struct HasTypeList : std::false_type {};
+
+  template<typename T>
+  struct HasTypeList<T, std::void_t<typename T::TypeList>> : std::true_type {};
+
+  template<typename T, std::size_t I>
+  constexpr auto FIXED_MEMBER_SIZE = FixedSerializedSize<
+    typename boost::mpl::at_c<typename T::TypeList, I>::type>::value;
+
+  template<typename T, std::size_t... I>
+  constexpr std::size_t GetFixedRecordSize(std::index_sequence<I...>) {
+    if((... || (FIXED_MEMBER_SIZE<T, I> == 0))) {
+      return 0;
+    }
+    return sizeof(unsigned int) + (std::size_t(0) + ... +
+      FIXED_MEMBER_SIZE<T, I>);
+  }
+
+  template<typename T>
+  constexpr std::size_t GetFixedSerializedSize() {
+    if constexpr(std::is_arithmetic<T>::value) {
+      return sizeof(T);
+    } else if constexpr(std::is_enum<T>::value) {
+      return sizeof(int);
+    } else if constexpr(IsBitwiseShuttleable<T>::value) {
+      return BITWISE_SIZE<T>;
+    } else if constexpr(HasTypeList<T>::value && IsStructure<T>::value) {
+      return GetFixedRecordSize<T>(std::make_index_sequence<
+        boost::mpl::size<typename T::TypeList>::value>());
+    } else {
+      return 0;
+    }
+  }
+}
+
+  /**
+   * Type trait for the number of bytes a BinarySender sends a value as when
+   * that is known at compile time, or 0 when it depends on the value. Types
+   * declared with BEAM_DEFINE_RECORD have a fixed size when every one of their
+   * members does.
+   * @param <T> The type to measure.
+   */
+  template<typename T, typename Enabled>
+  struct FixedSerializedSize : std::integral_constant<std::size_t,
+    Details::GetFixedSerializedSize<T>()> {};
+
+  template<std::size_t N>
+  struct FixedSerializedSize<FixedString<N>> :
+    std::integral_constant<std::size_t, N> {};
+
+  /**
+   * Measures the number of bytes a BinarySender sends values as, without
+   * sending them.
+   * @param <S> The type of Sender whose encoding is measured.
+   */
+  template<typename S>
+  class SerializedSizeCounter : public SenderMixin<SerializedSizeCounter<S>> {
+    public:
+
+      /** The type of Sender whose encoding is measured. */
+      using Sender = S;
+
+      /** The type of Buffer the measured Sender sends to. */
+      using Sink = typename Sender::Sink;
+
+      /**
+       * Constructs a SerializedSizeCounter.
+       * @param registry The TypeRegistry used to measure polymorphic types.
+       */
+      explicit SerializedSizeCounter(const TypeRegistry<Sender>* registry);
+
+      /** Returns the number of bytes measured. */
+      std::size_t GetSize() const;
+
+      void SendTypeId(const char* name, std::uint32_t id);
+
+      template<typename T>
+      std::enable_if_t<std::is_fundamental<T>::value> Send(const char* name,
+        const T& value);
+
+      template<typename T>
+      std::enable_if_t<ImplementsConcept<T, IO::Buffer>::value> Send(
+        const char* name, const T& value);
+
+      void Send(const char* name, const std::string& value,
+        unsigned int version);
+
+      void Send(const char* name, std::string_view value,
+        unsigned int version);
+
+      template<std::size_t N>
+      void Send(const char* name, const FixedString<N>& value,
+        unsigned int version);
+
+      template<typename T>
+      std::enable_if_t<IsStructure<T>::value> Send(const char* name,
+        T* const& value, unsigned int version);
+
+      template<typename T, typename A>
+      void Send(const char* name, const std::vector<T, A>& value);
+
+      void StartStructure(const char* name);
+
+      void EndStructure();
+
+      void StartSequence(const char* name, const int& size);
+
+      void StartSequence(const char* name);
+
+      void EndSequence();
+
+      using SenderMixin<SerializedSizeCounter>::Send;
+      using SenderMixin<SerializedSizeCounter>::Shuttle;
+
+    private:
+      const TypeRegistry<Sender>* m_registry;
+      std::size_t m_size;
+  };
+
+  template<typename S>
+  SerializedSizeCounter<S>::SerializedSizeCounter(
+    const TypeRegistry<Sender>* registry)
+    : m_registry(registry),
+      m_size(0) {}
+
+  template<typename S>
+  std::size_t SerializedSizeCounter<S>::GetSize() const {
+    return m_size;
+  }
+
+  template<typename S>
+  void SerializedSizeCounter<S>::SendTypeId(const char* name,
+      std::uint32_t id) {
+    m_size += GetVarIntSize(id);
+  }
+
+  template<typename S>
+  template<typename T>
+  std::enable_if_t<std::is_fundamental<T>::value>
+      SerializedSizeCounter<S>::Send(const char* name, const T& value) {
+    m_size += sizeof(T);
+  }
+
+  template<typename S>
+  template<typename T>
+  std::enable_if_t<ImplementsConcept<T, IO::Buffer>::value>
+      SerializedSizeCounter<S>::Send(const char* name, const T& value) {
+    m_size += sizeof(std::uint32_t) + value.GetSize();
+  }
+
+  template<typename S>
+  void SerializedSizeCounter<S>::Send(const char* name,
+      const std::string& value, unsigned int version) {
+    Send(name, std::string_view(value), version);
+  }
+
+  template<typename S>
+  void SerializedSizeCounter<S>::Send(const char* name,
+      std::string_view value, unsigned int version) {
+    m_size += sizeof(std::uint32_t) + value.size();
+  }
+
+  template<typename S>
+  template<std::size_t N>
+  void SerializedSizeCounter<S>::Send(const char* name,
+      const FixedString<N>& value, unsigned int version) {
+    m_size += N;
+  }
+
+  template<typename S>
+  template<typename T>
+  std::enable_if_t<IsStructure<T>::value> SerializedSizeCounter<S>::Send(
+      const char* name, T* const& value, unsigned int version) {
+    assert(m_registry != nullptr);
+    if(value == nullptr) {
+      if(this->AreTypeIdsEnabled()) {
+        SendTypeId("__type", TypeRegistry<Sender>::NULL_ID);
+      } else {
+        m_size += sizeof(std::uint32_t) + sizeof("__null") - 1;
+      }
+      return;
+    }
+    auto& entry = m_registry->GetEntry(*value);
+    if(this->AreTypeIdsEnabled()) {
+      SendTypeId("__type", entry.GetId());
+    } else {
+      Send("__type", entry.GetName(), 0);
+    }
+    Send("__version", version);
+    entry.Measure(*this, value, version);
+  }
+
+  template<typename S>
+  template<typename T, typename A>
+  void SerializedSizeCounter<S>::Send(const char* name,
+      const std::vector<T, A>& value) {
+    m_size += sizeof(int);
+    if constexpr(FixedSerializedSize<T>::value != 0) {
+      m_size += value.size() * FixedSerializedSize<T>::value;
+    } else {
+      for(auto& i : value) {
+        this->Shuttle(i);
+      }
+    }
+  }
+
+  template<typename S>
+  void SerializedSizeCounter<S>::StartStructure(const char* name) {}
+
+  template<typename S>
+  void SerializedSizeCounter<S>::EndStructure() {}
+
+  template<typename S>
+  void SerializedSizeCounter<S>::StartSequence(const char* name,
+      const int& size) {
+    m_size += sizeof(int);
+  }
+
+  template<typename S>
+  void SerializedSizeCounter<S>::StartSequence(const char* name) {}
+
+  template<typename S>
+  void SerializedSizeCounter<S>::EndSequence() {}
+}
+
+#endif
@@ -16,8 +16,12 @@ namespace Serialization {
     void operator ()(Shuttler& shuttle, const char* name,
         const std::array<T, N>& value) const {
       shuttle.StartSequence(name, static_cast<int>(N));
-      for(const auto& i : value) {
-        shuttle.Shuttle(i);
+      if constexpr(IsBlockShuttleable<Shuttler, T>) {
+        Details::SendBitwise(shuttle, value.data(), N);
+      } else {
+        for(const auto& i : value) {
+          shuttle.Shuttle(i);
+        }
       }
       shuttle.EndSequence();
     }
@@ -33,8 +37,12 @@ namespace Serialization {
       if(size != N) {
         BOOST_THROW_EXCEPTION(SerializationException("Array size mismatch."));
       }
-      for(int i = 0; i < size; ++i) {
-        shuttle.Shuttle(value[i]);
+      if constexpr(IsBlockShuttleable<Shuttler, T>) {
+        Details::ReceiveBitwise(shuttle, value.data(), N);
+      } else {
+        for(int i = 0; i < size; ++i) {
+          shuttle.Shuttle(value[i]);
+        }
       }
       shuttle.EndSequence();
     }
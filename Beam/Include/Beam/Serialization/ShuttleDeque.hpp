@@ -1,6 +1,8 @@
 #ifndef BEAM_SHUTTLEDEQUE_HPP
 #define BEAM_SHUTTLEDEQUE_HPP
+#include <algorithm>
 #include <deque>
+#include <iterator>
 #include "Beam/Serialization/Receiver.hpp"
 #include "Beam/Serialization/Sender.hpp"
 
@@ -15,8 +17,24 @@ namespace Serialization {
     void operator ()(Shuttler& shuttle, const char* name,
         const std::deque<T, A>& value) const {
       shuttle.StartSequence(name, static_cast<int>(value.size()));
-      for(auto& i : value) {
-        shuttle.Shuttle(i);
+      if constexpr(IsBlockShuttleable<Shuttler, T>) {
+
+        /* A deque stores its elements in contiguous chunks, each chunk is
+           sent as one block. */
+        auto start = value.begin();
+        while(start != value.end()) {
+          auto end = std::next(start);
+          while(end != value.end() && &*end == &*std::prev(end) + 1) {
+            ++end;
+          }
+          Details::SendBitwise(shuttle, &*start,
+            static_cast<std::size_t>(end - start));
+          start = end;
+        }
+      } else {
+        for(auto& i : value) {
+          shuttle.Shuttle(i);
+        }
       }
       shuttle.EndSequence();
     }
@@ -30,9 +48,24 @@ namespace Serialization {
       value.clear();
       int size;
       shuttle.StartSequence(name, size);
-      value.resize(size);
-      for(auto i = 0; i < size; ++i) {
-        shuttle.Shuttle(value[i]);
+      if constexpr(IsBlockShuttleable<Shuttler, T>) {
+        auto count = static_cast<std::size_t>(std::max(size, 0));
+        value.resize(count);
+        auto start = value.begin();
+        while(start != value.end()) {
+          auto end = std::next(start);
+          while(end != value.end() && &*end == &*std::prev(end) + 1) {
+            ++end;
+          }
+          Details::ReceiveBitwise(shuttle, &*start,
+            static_cast<std::size_t>(end - start));
+          start = end;
+        }
+      } else {
+        value.resize(size);
+        for(auto i = 0; i < size; ++i) {
+          shuttle.Shuttle(value[i]);
+        }
       }
       shuttle.EndSequence();
     }
@@ -1,5 +1,6 @@
 #ifndef BEAM_SHUTTLEVECTOR_HPP
 #define BEAM_SHUTTLEVECTOR_HPP
+#include <algorithm>
 #include <vector>
 #include "Beam/Serialization/Receiver.hpp"
 #include "Beam/Serialization/Sender.hpp"
@@ -15,8 +16,12 @@ namespace Serialization {
     void operator ()(Shuttler& shuttle, const char* name,
         const std::vector<T, A>& value) const {
       shuttle.StartSequence(name, static_cast<int>(value.size()));
-      for(auto& i : value) {
-        shuttle.Shuttle(i);
+      if constexpr(IsBlockShuttleable<Shuttler, T>) {
+        Details::SendBitwise(shuttle, value.data(), value.size());
+      } else {
+        for(auto& i : value) {
+          shuttle.Shuttle(i);
+        }
       }
       shuttle.EndSequence();
     }
@@ -31,9 +36,15 @@ namespace Serialization {
       value.clear();
       auto size = int();
       shuttle.StartSequence(name, size);
-      for(auto i = 0; i < size; ++i) {
-        value.emplace_back();
-        shuttle.Shuttle(value.back());
+      if constexpr(IsBlockShuttleable<Shuttler, T>) {
+        auto count = static_cast<std::size_t>(std::max(size, 0));
+        value.resize(count);
+        Details::ReceiveBitwise(shuttle, value.data(), count);
+      } else {
+        for(auto i = 0; i < size; ++i) {
+          value.emplace_back();
+          shuttle.Shuttle(value.back());
+        }
       }
       shuttle.EndSequence();
     }
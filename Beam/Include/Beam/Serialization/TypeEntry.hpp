@@ -1,5 +1,6 @@
 #ifndef BEAM_TYPEENTRY_HPP
 #define BEAM_TYPEENTRY_HPP
+#include <cstdint>
 #include <functional>
 #include <string>
 #include <typeindex>
@@ -34,6 +35,9 @@ namespace Serialization {
       //! Returns the type's name.
       const std::string& GetName() const;
 
+      //! Returns the id assigned by the TypeRegistry storing this entry.
+      std::uint32_t GetId() const;
+
       //! Allocates and constructs an instance of this type.
       /*!
         \return A newly built instance of <i>T</i>.
@@ -61,24 +65,40 @@ namespace Serialization {
       template<typename T>
       void Receive(Receiver& receiver, T* value, unsigned int version) const;
 
+      //! Measures the size an instance of this type is sent as.
+      /*!
+        \tparam T The type to measure, it's RTTI must match GetType()'s.
+        \param counter The SerializedSizeCounter to add the size to.
+        \param value The value to measure.
+        \param version The version of the <i>value</i> to measure.
+      */
+      template<typename T>
+      void Measure(SerializedSizeCounter<Sender>& counter, T* const& value,
+        unsigned int version) const;
+
     private:
       template<typename S> friend class TypeRegistry;
       using SendFunction =
         std::function<void(Sender&, void* const, unsigned int)>;
       using ReceiveFunction =
         std::function<void(Receiver&, void*, unsigned int)>;
+      using MeasureFunction = std::function<
+        void(SerializedSizeCounter<Sender>&, void* const, unsigned int)>;
       using BuildFunction = std::function<void*()>;
       std::type_index m_type;
       std::string m_name;
+      std::uint32_t m_id;
       BuildFunction m_builder;
       SendFunction m_sender;
       ReceiveFunction m_receiver;
+      MeasureFunction m_measurer;
 
       template<typename NameForward, typename BuilderForward,
-        typename SenderForward, typename ReceiverForward>
+        typename SenderForward, typename ReceiverForward,
+        typename MeasurerForward>
       TypeEntry(std::type_index type, NameForward&& name,
         BuilderForward&& builder, SenderForward&& sender,
-        ReceiverForward&& receiver);
+        ReceiverForward&& receiver, MeasurerForward&& measurer);
   };
 
   template<typename SenderType>
@@ -91,6 +111,11 @@ namespace Serialization {
     return m_name;
   }
 
+  template<typename SenderType>
+  std::uint32_t TypeEntry<SenderType>::GetId() const {
+    return m_id;
+  }
+
   template<typename SenderType>
   template<typename T>
   T* TypeEntry<SenderType>::Build() const {
@@ -112,17 +137,27 @@ namespace Serialization {
     m_receiver(receiver, value, version);
   }
 
+  template<typename SenderType>
+  template<typename T>
+  void TypeEntry<SenderType>::Measure(SerializedSizeCounter<Sender>& counter,
+      T* const& value, unsigned int version) const {
+    m_measurer(counter,
+      const_cast<typename std::remove_const<T>::type*>(value), version);
+  }
+
   template<typename SenderType>
   template<typename NameForward, typename BuilderForward,
-    typename SenderForward, typename ReceiverForward>
+    typename SenderForward, typename ReceiverForward, typename MeasurerForward>
   TypeEntry<SenderType>::TypeEntry(std::type_index type,
       NameForward&& name, BuilderForward&& builder, SenderForward&& sender,
-      ReceiverForward&& receiver)
+      ReceiverForward&& receiver, MeasurerForward&& measurer)
       : m_type(type),
         m_name(std::forward<NameForward>(name)),
+        m_id(0),
         m_builder(std::forward<BuilderForward>(builder)),
         m_sender(std::forward<SenderForward>(sender)),
-        m_receiver(std::forward<ReceiverForward>(receiver)) {}
+        m_receiver(std::forward<ReceiverForward>(receiver)),
+        m_measurer(std::forward<MeasurerForward>(measurer)) {}
 }
 }
 
@@ -1,9 +1,12 @@
 #ifndef BEAM_TYPE_REGISTRY_HPP
 #define BEAM_TYPE_REGISTRY_HPP
+#include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <string>
 #include <typeindex>
 #include <unordered_map>
+#include <vector>
 #include <boost/preprocessor/list/for_each.hpp>
 #include <boost/preprocessor/tuple/to_list.hpp>
 #include "Beam/Pointers/Ref.hpp"
@@ -54,12 +57,18 @@ namespace Details {
       /** The TypeEntries stored by this registry. */
       using TypeEntry = Serialization::TypeEntry<Sender>;
 
+      /** The id used to send a null pointer. */
+      static constexpr auto NULL_ID = std::uint32_t(0);
+
       /** Constructs a TypeRegistry. */
       TypeRegistry();
 
       /** Copies a TypeRegistry. */
       TypeRegistry(const TypeRegistry& registry);
 
+      /** Replaces this registry's types with a copy of another's. */
+      TypeRegistry& operator =(const TypeRegistry& registry);
+
       /** Returns the TypeEntry for a specified type. */
       template<typename T>
       const TypeEntry& GetEntry() const;
@@ -75,6 +84,21 @@ namespace Details {
        */
       const TypeEntry& GetEntry(const std::string& name) const;
 
+      /**
+       * Returns the TypeEntry with a given id. Ids are dense and assigned in
+       * order of name, so registries storing the same types assign them the
+       * same ids regardless of the order they were registered in.
+       * @param id The id of the TypeEntry.
+       * @return The TypeEntry with the specified <i>id</i>.
+       */
+      const TypeEntry& GetEntryById(std::uint32_t id) const;
+
+      /**
+       * Returns a hash of every registered name in id order, two registries
+       * with equal fingerprints can exchange types by id.
+       */
+      std::uint64_t GetFingerprint() const;
+
       /**
        * Registers a type.
        * @param <T> The type to register.
@@ -94,12 +118,18 @@ namespace Details {
         typename std::unordered_map<std::type_index, TypeEntry>::iterator;
       std::unordered_map<std::type_index, TypeEntry> m_types;
       std::unordered_map<std::string, TypeEntryIterator> m_typeNames;
+      std::vector<TypeEntry*> m_ids;
+      std::uint64_t m_fingerprint;
 
+      void Index(TypeEntry& entry);
       template<typename T>
       static void Send(Sender& sender, void* value, unsigned int version);
       template<typename T>
       static void Receive(Receiver& receiver, void* value,
         unsigned int version);
+      template<typename T>
+      static void Measure(SerializedSizeCounter<Sender>& counter, void* value,
+        unsigned int version);
   };
 
   template<typename S>
@@ -112,6 +142,18 @@ namespace Details {
     Add(registry);
   }
 
+  template<typename S>
+  TypeRegistry<S>& TypeRegistry<S>::operator =(const TypeRegistry& registry) {
+    if(this == &registry) {
+      return *this;
+    }
+    m_ids.clear();
+    m_typeNames.clear();
+    m_types.clear();
+    Add(registry);
+    return *this;
+  }
+
   template<typename S>
   template<typename T>
   const TypeEntry<S>& TypeRegistry<S>::GetEntry() const {
@@ -143,18 +185,36 @@ namespace Details {
     return typeIterator->second->second;
   }
 
+  template<typename S>
+  const TypeEntry<S>& TypeRegistry<S>::GetEntryById(std::uint32_t id) const {
+    if(id >= m_ids.size()) {
+      BOOST_THROW_EXCEPTION(TypeNotFoundException(std::to_string(id)));
+    }
+    return *m_ids[id];
+  }
+
+  template<typename S>
+  std::uint64_t TypeRegistry<S>::GetFingerprint() const {
+    return m_fingerprint;
+  }
+
   template<typename S>
   template<typename T>
   void TypeRegistry<S>::Register(const std::string& name) {
     auto builder = static_cast<T* (*)()>(&DataShuttle::Builder<T>);
     auto sender = &Send<T>;
     auto receiver = &Receive<T>;
+    auto measurer = typename TypeEntry::MeasureFunction();
+    if constexpr(SupportsSerializedSize<S>::value) {
+      measurer = &Measure<T>;
+    }
     auto type = std::type_index(typeid(T));
     auto entry = TypeEntry(type, name, std::move(builder), std::move(sender),
-      std::move(receiver));
+      std::move(receiver), std::move(measurer));
     auto insertResult = m_types.insert(std::pair(type, std::move(entry)));
     if(insertResult.second) {
       m_typeNames.insert(std::pair(name, insertResult.first));
+      Index(insertResult.first->second);
     }
   }
 
@@ -166,7 +226,41 @@ namespace Details {
       auto insertResult = m_types.insert(std::pair(type, std::move(entry)));
       if(insertResult.second) {
         m_typeNames.insert(std::pair(typeEntry.first, insertResult.first));
+        Index(insertResult.first->second);
+      }
+    }
+  }
+
+  template<typename S>
+  void TypeRegistry<S>::Index(TypeEntry& entry) {
+    auto isNull = [] (const TypeEntry& entry) {
+      return entry.GetType() == typeid(Details::NullShuttle);
+    };
+    auto position = m_ids.begin();
+    if(!isNull(entry)) {
+      if(!m_ids.empty() && isNull(*m_ids.front())) {
+        ++position;
+      }
+      position = std::lower_bound(position, m_ids.end(), &entry,
+        [] (auto left, auto right) {
+          return left->GetName() < right->GetName();
+        });
+    }
+    position = m_ids.insert(position, &entry);
+    for(; position != m_ids.end(); ++position) {
+      (*position)->m_id = static_cast<std::uint32_t>(
+        position - m_ids.begin());
+    }
+
+    /* The fingerprint is checked on every message sent with type ids, so it
+       is kept up to date here rather than computed on demand. */
+    m_fingerprint = std::uint64_t(14695981039346656037ULL);
+    for(auto entry : m_ids) {
+      for(auto c : entry->GetName()) {
+        m_fingerprint = (m_fingerprint ^ static_cast<std::uint8_t>(c)) *
+          1099511628211ULL;
       }
+      m_fingerprint *= 1099511628211ULL;
     }
   }
 
@@ -183,6 +277,13 @@ namespace Details {
       unsigned int version) {
     Serialization::Receive<T>()(receiver, *static_cast<T*>(value), version);
   }
+
+  template<typename S>
+  template<typename T>
+  void TypeRegistry<S>::Measure(SerializedSizeCounter<Sender>& counter,
+      void* value, unsigned int version) {
+    Serialization::Send<T>()(counter, *static_cast<T*>(value), version);
+  }
 }
 
 #endif
@@ -0,0 +1,88 @@
+#ifndef BEAM_VAR_INT_HPP
+#define BEAM_VAR_INT_HPP
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include "Beam/Serialization/Serialization.hpp"
+
+namespace Beam::Serialization {
+
+  /** The maximum number of bytes used to encode a 64-bit varint. */
+  inline constexpr auto MAX_VAR_INT_SIZE = std::size_t(10);
+
+  /**
+   * Encodes an unsigned integer as a LEB128 varint.
+   * @param value The value to encode.
+   * @param destination Where to write the encoding, must have room for at
+   *        least MAX_VAR_INT_SIZE bytes.
+   * @return The number of bytes written.
+   */
+  inline std::size_t EncodeVarInt(std::uint64_t value, char* destination) {
+    auto size = std::size_t(0);
+    while(value >= 0x80) {
+      destination[size] = static_cast<char>((value & 0x7F) | 0x80);
+      value >>= 7;
+      ++size;
+    }
+    destination[size] = static_cast<char>(value);
+    return size + 1;
+  }
+
+  /**
+   * Returns the number of bytes EncodeVarInt encodes a value into.
+   * @param value The value to measure.
+   */
+  inline std::size_t GetVarIntSize(std::uint64_t value) {
+    auto size = std::size_t(1);
+    while(value >= 0x80) {
+      value >>= 7;
+      ++size;
+    }
+    return size;
+  }
+
+  /**
+   * Maps a signed integer onto an unsigned one so that values of small
+   * magnitude encode as short varints.
+   * @param value The value to map.
+   * @return The ZigZag encoding of the <i>value</i>.
+   */
+  inline std::uint64_t EncodeZigZag(std::int64_t value) {
+    return (static_cast<std::uint64_t>(value) << 1) ^
+      static_cast<std::uint64_t>(value >> 63);
+  }
+
+  /**
+   * Inverts EncodeZigZag.
+   * @param value The ZigZag encoded value.
+   * @return The signed integer the <i>value</i> encodes.
+   */
+  inline std::int64_t DecodeZigZag(std::uint64_t value) {
+    return static_cast<std::int64_t>(value >> 1) ^
+      -static_cast<std::int64_t>(value & 1);
+  }
+
+  /**
+   * Decodes a LEB128 varint.
+   * @param source The encoded data.
+   * @param size The number of bytes available in the <i>source</i>.
+   * @param value Stores the decoded value.
+   * @return The number of bytes consumed, or 0 if the <i>source</i> does not
+   *         contain a complete varint.
+   */
+  inline std::size_t DecodeVarInt(const char* source, std::size_t size,
+      std::uint64_t& value) {
+    value = 0;
+    auto limit = std::min(size, MAX_VAR_INT_SIZE);
+    for(auto i = std::size_t(0); i != limit; ++i) {
+      auto byte = static_cast<std::uint8_t>(source[i]);
+      value |= static_cast<std::uint64_t>(byte & 0x7F) << (7 * i);
+      if((byte & 0x80) == 0) {
+        return i + 1;
+      }
+    }
+    return 0;
+  }
+}
+
+#endif
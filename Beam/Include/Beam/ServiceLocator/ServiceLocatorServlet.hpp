@@ -5,6 +5,7 @@
 #include <random>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <boost/algorithm/string/case_conv.hpp>
 #include <boost/algorithm/string/trim.hpp>
 #include "Beam/Collections/SynchronizedList.hpp"
@@ -13,6 +14,7 @@
 #include "Beam/ServiceLocator/ServiceLocatorServices.hpp"
 #include "Beam/Services/ServiceProtocolServlet.hpp"
 #include "Beam/Threading/Mutex.hpp"
+#include "Beam/Threading/SharedMutex.hpp"
 #include "Beam/Threading/Sync.hpp"
 
 namespace Beam::ServiceLocator {
@@ -62,9 +64,11 @@ namespace Beam::ServiceLocator {
       GetOptionalLocalPtr<D> m_dataStore;
       SynchronizedVector<ServiceProtocolClient*, Threading::Mutex>
         m_accountUpdateSubscribers;
-      Threading::Sync<Sessions> m_sessions;
-      Threading::Sync<ServiceListings> m_serviceListings;
-      Threading::Sync<ServiceEntryListings> m_serviceEntryListings;
+      Threading::Sync<Sessions, Threading::SharedMutex> m_sessions;
+      Threading::Sync<ServiceListings, Threading::SharedMutex>
+        m_serviceListings;
+      Threading::Sync<ServiceEntryListings, Threading::SharedMutex>
+        m_serviceEntryListings;
       Threading::Sync<DirectoryEntryMonitorEntries>
         m_directoryEntryMonitorEntries;
       std::atomic_int m_nextServiceId;
@@ -443,7 +447,7 @@ namespace Beam::ServiceLocator {
     if(!session.IsLoggedIn()) {
       throw Services::ServiceRequestException("Not logged in.");
     }
-    auto listings = Threading::With(m_serviceEntryListings,
+    auto listings = Threading::With(std::as_const(m_serviceEntryListings),
       [&] (auto& serviceEntryListings) -> std::vector<ServiceEntry> {
         auto entryIterator = serviceEntryListings.find(name);
         if(entryIterator != serviceEntryListings.end()) {
@@ -996,7 +1000,7 @@ namespace Beam::ServiceLocator {
     }
     auto salt = std::to_string(saltId);
     auto upperCaseSessionId = boost::to_upper_copy(sessionId);
-    return Threading::With(m_sessions, [&] (auto& sessions) {
+    return Threading::With(std::as_const(m_sessions), [&] (auto& sessions) {
       for(auto& session : sessions) {
         auto encodedSessionId = ComputeSHA(salt + session.first);
         if(encodedSessionId == upperCaseSessionId) {
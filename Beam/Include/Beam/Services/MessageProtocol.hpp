@@ -1,5 +1,11 @@
 #ifndef BEAM_MESSAGE_PROTOCOL_HPP
 #define BEAM_MESSAGE_PROTOCOL_HPP
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string_view>
+#include <type_traits>
 #include <utility>
 #include <boost/thread/mutex.hpp>
 #include <boost/throw_exception.hpp>
@@ -16,11 +22,32 @@
 #include "Beam/Pointers/Out.hpp"
 #include "Beam/Serialization/Receiver.hpp"
 #include "Beam/Serialization/Sender.hpp"
+#include "Beam/Serialization/SerializationException.hpp"
 #include "Beam/Serialization/ShuttleClone.hpp"
 #include "Beam/Services/Services.hpp"
 #include "Beam/Utilities/Endian.hpp"
 
+#ifndef BEAM_MESSAGE_PROTOCOL_READ_AHEAD_SIZE
+  #define BEAM_MESSAGE_PROTOCOL_READ_AHEAD_SIZE 65536
+#endif
+
 namespace Beam::Services {
+namespace Details {
+
+  /** Set in the size of a frame whose polymorphic types are sent by id. */
+  inline constexpr auto TYPE_IDS_FLAG = std::uint32_t(1) << 31;
+
+  /** The size of a frame advertising a TypeRegistry's fingerprint. */
+  inline constexpr auto NEGOTIATION_FRAME = ~std::uint32_t(0);
+
+  template<typename R, typename = void>
+  struct HasRawSource : std::false_type {};
+
+  template<typename R>
+  struct HasRawSource<R, std::void_t<decltype(std::declval<R&>().SetSource(
+    std::declval<const char*>(), std::declval<std::size_t>()))>> :
+    std::true_type {};
+}
 
   /**
    * Implements a protocol used to send/receive discrete messages over a
@@ -95,10 +122,43 @@ namespace Beam::Services {
       std::enable_if_t<ImplementsConcept<Buffer, IO::Buffer>::value> Send(
         const Buffer& buffer);
 
-      /** Receives a message. */
+      /**
+       * Receives a message. Any views the message holds, such as
+       * std::string_view fields, refer into the receive buffer and are
+       * invalidated by the next call to Receive, which moves or overwrites
+       * that buffer. Use the overload taking a pin to keep views valid. In
+       * debug builds the frame is overwritten once it is invalidated, so that
+       * reading through a stale view fails visibly.
+       */
       template<typename Message>
       Message Receive();
 
+      /**
+       * Receives a message whose views, such as std::string_view fields, refer
+       * directly into the receive buffer rather than copies of it.
+       * @param pin Stores a reference to the buffer the message was received
+       *        from, the message's views remain valid for as long as the
+       *        <i>pin</i> is kept. Later messages are read into a new buffer
+       *        while it's held.
+       */
+      template<typename Message>
+      Message Receive(Out<IO::SharedBuffer> pin);
+
+      /**
+       * Advertises the fingerprint of the Receiver's TypeRegistry to the peer,
+       * only the first call has any effect. Polymorphic types are sent by id
+       * rather than by name once the peer advertises a fingerprint matching
+       * the Sender's TypeRegistry. Each frame records which of the two it was
+       * sent with, so a peer that never advertises keeps receiving names.
+       * Nothing is advertised unless this is called, the peer must be built
+       * with negotiation support since older peers read the advertisement as
+       * a frame.
+       */
+      void NegotiateTypeIds();
+
+      /** Returns <code>true</code> iff polymorphic types are sent by id. */
+      bool AreTypeIdsEnabled() const;
+
       void Close();
 
     private:
@@ -111,10 +171,25 @@ namespace Beam::Services {
       LocalPtr<Encoder> m_encoder;
       LocalPtr<Decoder> m_decoder;
       IO::SharedBuffer m_receiveBuffer;
+      std::size_t m_receiveOffset;
       IO::SharedBuffer m_decoderBuffer;
+      bool m_isPinned;
+      #ifndef NDEBUG
+      std::string_view m_unpinnedFrame;
+      #endif
+      std::optional<std::uint64_t> m_fingerprint;
+      std::optional<std::uint64_t> m_peerFingerprint;
 
       MessageProtocol(const MessageProtocol&) = delete;
       MessageProtocol& operator =(const MessageProtocol&) = delete;
+      bool IsPeerMatched() const;
+      bool EnableTypeIds();
+      std::uint32_t ReceiveHeader();
+      void ReadAhead(std::size_t size);
+      void Unpin();
+      void InvalidateUnpinnedFrame();
+      template<typename Message>
+      Message Receive(IO::SharedBuffer* pin);
   };
 
   template<typename C, typename S, typename E>
@@ -126,7 +201,9 @@ namespace Beam::Services {
       m_sender(std::forward<SF>(sender)),
       m_receiver(std::forward<RF>(receiver)),
       m_encoder(std::forward<EF>(encoder)),
-      m_decoder(std::forward<DF>(decoder)) {}
+      m_decoder(std::forward<DF>(decoder)),
+      m_receiveOffset(0),
+      m_isPinned(false) {}
 
   template<typename C, typename S, typename E>
   MessageProtocol<C, S, E>::~MessageProtocol() {
@@ -137,6 +214,7 @@ namespace Beam::Services {
   template<typename T>
   std::unique_ptr<T> MessageProtocol<C, S, E>::Clone(const T& value) {
     auto lock = boost::lock_guard(m_mutex);
+    m_sender->SetTypeIdsEnabled(m_receiver->AreTypeIdsEnabled());
     return Serialization::ShuttleClone(value, *m_sender, *m_receiver);
   }
 
@@ -146,8 +224,12 @@ namespace Beam::Services {
       Out<Buffer> buffer) {
     buffer->Append(std::uint32_t(0));
     auto serializationBuffer = Buffer();
+    auto flag = std::uint32_t(0);
     {
       auto lock = boost::lock_guard(m_mutex);
+      if(EnableTypeIds()) {
+        flag = Details::TYPE_IDS_FLAG;
+      }
       m_sender->SetSink(Ref(serializationBuffer));
       m_sender->Send(message);
     }
@@ -155,7 +237,11 @@ namespace Beam::Services {
       sizeof(std::uint32_t));
     auto size = m_encoder->Encode(serializationBuffer,
       Store(encoderViewBuffer));
-    buffer->Write(0, ToLittleEndian<std::uint32_t>(size));
+    if(size >= Details::TYPE_IDS_FLAG) {
+      BOOST_THROW_EXCEPTION(Serialization::SerializationException(
+        "Message too large."));
+    }
+    buffer->Write(0, ToLittleEndian<std::uint32_t>(size | flag));
   }
 
   template<typename C, typename S, typename E>
@@ -169,22 +255,34 @@ namespace Beam::Services {
     } else {
       encoderBuffer.Append(std::uint32_t(0));
     }
+    auto flag = std::uint32_t(0);
     {
       auto lock = boost::lock_guard(m_mutex);
+      if(EnableTypeIds()) {
+        flag = Details::TYPE_IDS_FLAG;
+      }
       m_sender->SetSink(Ref(senderBuffer));
       m_sender->Send(message);
     }
+    auto checkSize = [] (std::size_t size) {
+      if(size >= Details::TYPE_IDS_FLAG) {
+        BOOST_THROW_EXCEPTION(Serialization::SerializationException(
+          "Message too large."));
+      }
+    };
     if(Codecs::InPlaceSupport<Encoder>::value) {
       auto senderViewBuffer = IO::BufferSlice(Ref(senderBuffer),
         sizeof(std::uint32_t));
       auto size = m_encoder->Encode(senderViewBuffer, Store(senderViewBuffer));
-      senderBuffer.Write(0, ToLittleEndian<std::uint32_t>(size));
+      checkSize(size);
+      senderBuffer.Write(0, ToLittleEndian<std::uint32_t>(size | flag));
       m_writer.Write(senderBuffer);
     } else {
       auto encoderViewBuffer = IO::BufferSlice(Ref(encoderBuffer),
         sizeof(std::uint32_t));
       auto size = m_encoder->Encode(senderBuffer, Store(encoderViewBuffer));
-      encoderBuffer.Write(0, ToLittleEndian<std::uint32_t>(size));
+      checkSize(size);
+      encoderBuffer.Write(0, ToLittleEndian<std::uint32_t>(size | flag));
       m_writer.Write(encoderBuffer);
     }
   }
@@ -199,40 +297,109 @@ namespace Beam::Services {
   template<typename C, typename S, typename E>
   template<typename Message>
   Message MessageProtocol<C, S, E>::Receive() {
+    return Receive<Message>(static_cast<IO::SharedBuffer*>(nullptr));
+  }
+
+  template<typename C, typename S, typename E>
+  template<typename Message>
+  Message MessageProtocol<C, S, E>::Receive(Out<IO::SharedBuffer> pin) {
+    return Receive<Message>(&*pin);
+  }
+
+  template<typename C, typename S, typename E>
+  template<typename Message>
+  Message MessageProtocol<C, S, E>::Receive(IO::SharedBuffer* pin) {
     try {
-      auto size = std::uint32_t(0);
-      auto remainingSizeRead = sizeof(std::uint32_t);
-      while(remainingSizeRead != 0) {
-        remainingSizeRead -= m_channel->GetReader().Read(
-          reinterpret_cast<char*>(&size) +
-          (sizeof(std::uint32_t) - remainingSizeRead), remainingSizeRead);
-      }
-      size = FromLittleEndian<std::uint32_t>(size);
-      while(size > m_receiveBuffer.GetSize()) {
-        m_channel->GetReader().Read(Store(m_receiveBuffer),
-          size - m_receiveBuffer.GetSize());
+      InvalidateUnpinnedFrame();
+      Unpin();
+      auto header = ReceiveHeader();
+      auto size = header & ~Details::TYPE_IDS_FLAG;
+      auto areTypeIdsEnabled = (header & Details::TYPE_IDS_FLAG) != 0;
+      if(areTypeIdsEnabled) {
+
+        /* Ids are only meaningful against the registry that was advertised,
+           a type registered since then may have shifted them. */
+        auto lock = boost::lock_guard(m_mutex);
+        if(!m_fingerprint || *m_fingerprint !=
+            m_receiver->GetTypeRegistry()->GetFingerprint()) {
+          BOOST_THROW_EXCEPTION(Serialization::SerializationException(
+            "Type ids received for an unadvertised TypeRegistry."));
+        }
       }
-      if(Codecs::InPlaceSupport<Decoder>::value) {
-        m_decoder->Decode(m_receiveBuffer, Store(m_receiveBuffer));
-        m_receiver->SetSource(Ref(m_receiveBuffer));
+      m_receiver->SetTypeIdsEnabled(areTypeIdsEnabled);
+      ReadAhead(sizeof(std::uint32_t) + size);
+      auto frame =
+        m_receiveBuffer.GetMutableData() + m_receiveOffset + sizeof(size);
+      m_receiveOffset += sizeof(size) + size;
+      if constexpr(Codecs::InPlaceSupport<Decoder>::value &&
+          Details::HasRawSource<Receiver>::value) {
+        auto decodedSize = m_decoder->Decode(frame, size, frame, size);
+        m_receiver->SetSource(frame, decodedSize);
+        if(pin) {
+          *pin = m_receiveBuffer;
+          m_isPinned = true;
+        }
+        #ifndef NDEBUG
+        if(!pin) {
+          m_unpinnedFrame = std::string_view(frame, decodedSize);
+        }
+        #endif
       } else {
-        m_decoder->Decode(m_receiveBuffer, Store(m_decoderBuffer));
+        m_decoderBuffer.Reset();
+        m_decoder->Decode(frame, size, Store(m_decoderBuffer));
         m_receiver->SetSource(Ref(m_decoderBuffer));
+        if(pin) {
+          *pin = m_decoderBuffer;
+          m_isPinned = true;
+        }
+        #ifndef NDEBUG
+        if(!pin) {
+          m_unpinnedFrame = std::string_view(m_decoderBuffer.GetData(),
+            m_decoderBuffer.GetSize());
+        }
+        #endif
       }
       auto message = Message();
       m_receiver->Shuttle(message);
-      m_receiveBuffer.Reset();
-      if(!Codecs::InPlaceSupport<Decoder>::value) {
-        m_decoderBuffer.Reset();
+      if(m_receiveOffset == m_receiveBuffer.GetSize()) {
+        m_receiveBuffer.Reset();
+        m_receiveOffset = 0;
       }
       return message;
     } catch(const std::exception&) {
-      m_receiveBuffer.Reset();
-      m_decoderBuffer.Reset();
+      m_receiveBuffer = IO::SharedBuffer();
+      m_receiveOffset = 0;
+      m_decoderBuffer = IO::SharedBuffer();
+      m_isPinned = false;
+      #ifndef NDEBUG
+      m_unpinnedFrame = std::string_view();
+      #endif
       BOOST_RETHROW;
     }
   }
 
+  template<typename C, typename S, typename E>
+  void MessageProtocol<C, S, E>::NegotiateTypeIds() {
+    auto frame = typename Channel::Writer::Buffer();
+    {
+      auto lock = boost::lock_guard(m_mutex);
+      auto registry = m_receiver->GetTypeRegistry();
+      if(m_fingerprint || !registry) {
+        return;
+      }
+      m_fingerprint = registry->GetFingerprint();
+      frame.Append(ToLittleEndian(Details::NEGOTIATION_FRAME));
+      frame.Append(ToLittleEndian(*m_fingerprint));
+    }
+    m_writer.Write(frame);
+  }
+
+  template<typename C, typename S, typename E>
+  bool MessageProtocol<C, S, E>::AreTypeIdsEnabled() const {
+    auto lock = boost::lock_guard(m_mutex);
+    return IsPeerMatched();
+  }
+
   template<typename C, typename S, typename E>
   void MessageProtocol<C, S, E>::Close() {
     if(m_openState.SetClosing()) {
@@ -241,6 +408,97 @@ namespace Beam::Services {
     m_channel->GetConnection().Close();
     m_openState.Close();
   }
+
+  template<typename C, typename S, typename E>
+  bool MessageProtocol<C, S, E>::IsPeerMatched() const {
+    auto registry = m_sender->GetTypeRegistry();
+    return m_peerFingerprint && registry &&
+      *m_peerFingerprint == registry->GetFingerprint();
+  }
+
+  template<typename C, typename S, typename E>
+  bool MessageProtocol<C, S, E>::EnableTypeIds() {
+
+    /* Checked on every message so that a type registered after the peer
+       advertised falls back to names rather than sending a shifted id. */
+    auto areTypeIdsEnabled = IsPeerMatched();
+    m_sender->SetTypeIdsEnabled(areTypeIdsEnabled);
+    return areTypeIdsEnabled;
+  }
+
+  template<typename C, typename S, typename E>
+  std::uint32_t MessageProtocol<C, S, E>::ReceiveHeader() {
+    while(true) {
+      ReadAhead(sizeof(std::uint32_t));
+      auto header = FromLittleEndian(
+        m_receiveBuffer.Extract<std::uint32_t>(m_receiveOffset));
+      if(header != Details::NEGOTIATION_FRAME) {
+        return header;
+      }
+      ReadAhead(sizeof(std::uint32_t) + sizeof(std::uint64_t));
+      auto fingerprint = FromLittleEndian(m_receiveBuffer.Extract<
+        std::uint64_t>(m_receiveOffset + sizeof(std::uint32_t)));
+      m_receiveOffset += sizeof(std::uint32_t) + sizeof(std::uint64_t);
+      auto lock = boost::lock_guard(m_mutex);
+      m_peerFingerprint = fingerprint;
+    }
+  }
+
+  template<typename C, typename S, typename E>
+  void MessageProtocol<C, S, E>::ReadAhead(std::size_t size) {
+    if(m_receiveBuffer.GetSize() - m_receiveOffset >= size) {
+      return;
+    }
+
+    /* Move the partial frame to the front so the buffer only grows to fit
+       the largest frame rather than the whole stream. */
+    if(m_receiveOffset != 0) {
+      auto remainingSize = m_receiveBuffer.GetSize() - m_receiveOffset;
+      std::memmove(m_receiveBuffer.GetMutableData(),
+        m_receiveBuffer.GetData() + m_receiveOffset, remainingSize);
+      m_receiveBuffer.Shrink(m_receiveOffset);
+      m_receiveOffset = 0;
+    }
+    while(m_receiveBuffer.GetSize() < size) {
+      m_channel->GetReader().Read(Store(m_receiveBuffer),
+        std::max<std::size_t>(size - m_receiveBuffer.GetSize(),
+        BEAM_MESSAGE_PROTOCOL_READ_AHEAD_SIZE));
+    }
+  }
+
+  template<typename C, typename S, typename E>
+  void MessageProtocol<C, S, E>::Unpin() {
+    if(!m_isPinned) {
+      return;
+    }
+
+    /* Writing to a pinned buffer would copy all of it, including the frames
+       already received, so only the unread tail is moved to a new block. */
+    auto tail = IO::SharedBuffer();
+    if(m_receiveOffset != m_receiveBuffer.GetSize()) {
+      tail.Append(m_receiveBuffer.GetData() + m_receiveOffset,
+        m_receiveBuffer.GetSize() - m_receiveOffset);
+    }
+    m_receiveBuffer = std::move(tail);
+    m_receiveOffset = 0;
+    m_decoderBuffer = IO::SharedBuffer();
+    m_isPinned = false;
+  }
+
+  template<typename C, typename S, typename E>
+  void MessageProtocol<C, S, E>::InvalidateUnpinnedFrame() {
+    #ifndef NDEBUG
+    if(m_unpinnedFrame.empty()) {
+      return;
+    }
+
+    /* The frame is still owned by one of the receive buffers, neither has
+       been written to or reallocated since the message was received. */
+    std::memset(const_cast<char*>(m_unpinnedFrame.data()), 0xDD,
+      m_unpinnedFrame.size());
+    m_unpinnedFrame = std::string_view();
+    #endif
+  }
 }
 
 #endif
@@ -1,14 +1,19 @@
 #ifndef BEAM_RECORD_MESSAGE_HPP
 #define BEAM_RECORD_MESSAGE_HPP
+#include <array>
+#include <cstdint>
+#include <optional>
 #include <utility>
 #include <boost/preprocessor/empty.hpp>
 #include <boost/preprocessor/list/for_each.hpp>
 #include <boost/preprocessor/tuple/to_list.hpp>
 #include "Beam/Serialization/DataShuttle.hpp"
 #include "Beam/Serialization/ShuttleRecord.hpp"
+#include "Beam/Services/MessageProtocol.hpp"
 #include "Beam/Services/RecordMessageDetails.hpp"
 #include "Beam/Services/Services.hpp"
 #include "Beam/Utilities/BeamWorkaround.hpp"
+#include "Beam/Utilities/Endian.hpp"
 #include "Beam/Utilities/Preprocessor.hpp"
 
 #define BEAM_DEFINE_MESSAGE(Name, Uid, ...)                                    \
@@ -124,12 +129,28 @@ namespace Services {
     } else {
       auto message = RecordMessage<R, ServiceProtocolClient>(
         std::forward<Args>(args)...);
-      auto buffer = typename
-        ServiceProtocolClient::MessageProtocol::Channel::Writer::Buffer();
-      clients.front()->Encode(message, Store(buffer));
+      using Buffer = typename
+        ServiceProtocolClient::MessageProtocol::Channel::Writer::Buffer;
+
+      /* Clients whose peers registered different types receive the message
+         by type name, so it's encoded once for each form. A buffer is filed
+         under the form its frame was actually encoded with since a client
+         may begin sending ids between the check and the encoding. */
+      auto buffers = std::array<std::optional<Buffer>, 2>();
       for(auto& client : clients) {
         try {
-          client->Send(buffer);
+          if(auto& buffer = buffers[client->AreTypeIdsEnabled()]) {
+            client->Send(*buffer);
+            continue;
+          }
+          auto buffer = Buffer();
+          client->Encode(message, Store(buffer));
+          auto header = FromLittleEndian(buffer.template Extract<
+            std::uint32_t>(0));
+          auto& encoding =
+            buffers[(header & Details::TYPE_IDS_FLAG) != 0].emplace(
+              std::move(buffer));
+          client->Send(encoding);
         } catch(const std::exception&) {
           continue;
         }
@@ -3,6 +3,7 @@
 #include <atomic>
 #include <iostream>
 #include <unordered_map>
+#include <vector>
 #include <boost/range/adaptor/map.hpp>
 #include <boost/thread/mutex.hpp>
 #include "Beam/IO/Buffer.hpp"
@@ -146,9 +147,33 @@ namespace Details {
       /** Reads a Message from the Channel. */
       std::shared_ptr<Message<ServiceProtocolClient>> ReadMessage();
 
+      /**
+       * Reads all Messages received from the Channel, blocking until at least
+       * one is available.
+       * @param messages The vector to append the Messages to.
+       */
+      void ReadMessages(Out<std::vector<
+        std::shared_ptr<Message<ServiceProtocolClient>>>> messages);
+
       /** Spawns a Message handling loop for this ServiceProtocolClient. */
       void SpawnMessageHandler();
 
+      /**
+       * Sets whether this client advertises its registered types to the peer
+       * when it's first used, so that Messages are sent by type id once both
+       * ends advertise the same types. Off by default, a peer that doesn't
+       * negotiate reads the advertisement as a malformed frame.
+       * @param isEnabled Whether to advertise, must be set before the client
+       *        is first used.
+       */
+      void SetTypeIdNegotiation(bool isEnabled);
+
+      /**
+       * Returns <code>true</code> iff Messages are sent with compact type ids,
+       * which happens once the peer advertises the same registered types.
+       */
+      bool AreTypeIdsEnabled() const;
+
       void Close();
 
     private:
@@ -165,11 +190,14 @@ namespace Details {
       std::unordered_map<int, Routines::BaseEval*> m_pendingRequests;
       Queue<std::shared_ptr<Message<ServiceProtocolClient>>> m_messages;
       std::atomic_bool m_isReading;
+      std::atomic_bool m_isNegotiationEnabled;
+      std::atomic_bool m_isNegotiated;
       IO::OpenState m_openState;
 
       ServiceProtocolClient(const ServiceProtocolClient&) = delete;
       ServiceProtocolClient& operator =(
         const ServiceProtocolClient&) = delete;
+      void Negotiate();
       void Open();
       void Shutdown();
       void ReadLoop();
@@ -199,27 +227,32 @@ namespace Details {
   template<typename ServiceProtocolClient>
   void HandleMessagesLoop(ServiceProtocolClient& client) {
     auto routines = Routines::RoutineHandlerGroup();
+    auto messages = std::vector<std::shared_ptr<
+      Message<ServiceProtocolClient>>>();
     try {
       while(true) {
-        auto message = client.ReadMessage();
-        if(auto slot = client.GetSlots().Find(*message)) {
-          if constexpr(SupportsParallelism<ServiceProtocolClient>::value) {
-            routines.Spawn(
-              [&, message = std::move(message), slot = std::move(slot)] {
-                try {
-                  message->EmitSignal(slot, Ref(client));
-                } catch(const std::exception&) {
-                  client.Close();
-                }
-              });
-          } else {
-            try {
-              message->EmitSignal(slot, Ref(client));
-            } catch(const std::exception&) {
-              client.Close();
+        client.ReadMessages(Store(messages));
+        for(auto& message : messages) {
+          if(auto slot = client.GetSlots().Find(*message)) {
+            if constexpr(SupportsParallelism<ServiceProtocolClient>::value) {
+              routines.Spawn(
+                [&, message = std::move(message), slot = std::move(slot)] {
+                  try {
+                    message->EmitSignal(slot, Ref(client));
+                  } catch(const std::exception&) {
+                    client.Close();
+                  }
+                });
+            } else {
+              try {
+                message->EmitSignal(slot, Ref(client));
+              } catch(const std::exception&) {
+                client.Close();
+              }
             }
           }
         }
+        messages.clear();
       }
     } catch(const IO::EndOfFileException&) {
       return;
@@ -236,7 +269,9 @@ namespace Details {
         m_timer(std::forward<TF>(timer)),
         m_timerQueue(std::make_shared<Queue<Threading::Timer::Result>>()),
         m_nextRequestId(1),
-        m_isReading(false) {
+        m_isReading(false),
+        m_isNegotiationEnabled(false),
+        m_isNegotiated(false) {
     m_timer->GetPublisher().Monitor(m_timerQueue);
   }
 
@@ -286,18 +321,21 @@ namespace Details {
   template<typename Buffer>
   void ServiceProtocolClient<M, T, P, S, V>::Encode(
       const Message<ServiceProtocolClient>& message, Out<Buffer> buffer) {
+    Negotiate();
     m_protocol.Encode(&message, Store(buffer));
   }
 
   template<typename M, typename T, typename P, typename S, bool V>
   void ServiceProtocolClient<M, T, P, S, V>::Send(
       const Message<ServiceProtocolClient>& message) {
+    Negotiate();
     m_protocol.Send(&message);
   }
 
   template<typename M, typename T, typename P, typename S, bool V>
   template<typename Buffer, typename>
   void ServiceProtocolClient<M, T, P, S, V>::Send(const Buffer& buffer) {
+    Negotiate();
     m_protocol.Send(buffer);
   }
 
@@ -341,12 +379,30 @@ namespace Details {
     return m_messages.Pop();
   }
 
+  template<typename M, typename T, typename P, typename S, bool V>
+  void ServiceProtocolClient<M, T, P, S, V>::ReadMessages(Out<std::vector<
+      std::shared_ptr<Message<ServiceProtocolClient>>>> messages) {
+    Open();
+    m_messages.PopAll(Store(messages));
+  }
+
   template<typename M, typename T, typename P, typename S, bool V>
   void ServiceProtocolClient<M, T, P, S, V>::SpawnMessageHandler() {
     m_messageHandler = Routines::Spawn(
       std::bind(HandleMessagesLoop<ServiceProtocolClient>, std::ref(*this)));
   }
 
+  template<typename M, typename T, typename P, typename S, bool V>
+  void ServiceProtocolClient<M, T, P, S, V>::SetTypeIdNegotiation(
+      bool isEnabled) {
+    m_isNegotiationEnabled = isEnabled;
+  }
+
+  template<typename M, typename T, typename P, typename S, bool V>
+  bool ServiceProtocolClient<M, T, P, S, V>::AreTypeIdsEnabled() const {
+    return m_protocol.AreTypeIdsEnabled();
+  }
+
   template<typename M, typename T, typename P, typename S, bool V>
   void ServiceProtocolClient<M, T, P, S, V>::Close() {
     if(m_openState.SetClosing()) {
@@ -359,8 +415,19 @@ namespace Details {
     m_openState.Close();
   }
 
+  template<typename M, typename T, typename P, typename S, bool V>
+  void ServiceProtocolClient<M, T, P, S, V>::Negotiate() {
+
+    /* Slots are registered after construction, so the registry is only
+       advertised once the connection is first used. */
+    if(m_isNegotiationEnabled && !m_isNegotiated.exchange(true)) {
+      m_protocol.NegotiateTypeIds();
+    }
+  }
+
   template<typename M, typename T, typename P, typename S, bool V>
   void ServiceProtocolClient<M, T, P, S, V>::Open() {
+    Negotiate();
     if(m_isReading.exchange(true)) {
       return;
     }
@@ -439,11 +506,15 @@ namespace Details {
 
   template<typename M, typename T, typename P, typename S, bool V>
   void ServiceProtocolClient<M, T, P, S, V>::TimerLoop() {
-    auto heartbeatMessage = HeartbeatMessage<ServiceProtocolClient>();
     try {
+
+      /* Every heartbeat has the same encoding, so it is encoded once and
+         each send only shares the buffer. */
+      auto heartbeat = typename MessageProtocol::Channel::Writer::Buffer();
+      Encode(HeartbeatMessage<ServiceProtocolClient>(), Store(heartbeat));
       while(m_openState.IsOpen()) {
         if(m_timerQueue->Pop() == Threading::Timer::Result::EXPIRED) {
-          Send(heartbeatMessage);
+          Send(heartbeat);
         } else {
           break;
         }
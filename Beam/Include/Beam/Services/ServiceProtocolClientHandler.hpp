@@ -1,6 +1,7 @@
 #ifndef BEAM_SERVICE_PROTOCOL_CLIENT_HANDLER_HPP
 #define BEAM_SERVICE_PROTOCOL_CLIENT_HANDLER_HPP
 #include <utility>
+#include <vector>
 #include "Beam/IO/Connection.hpp"
 #include "Beam/IO/ConnectException.hpp"
 #include "Beam/IO/OpenState.hpp"
@@ -176,13 +177,17 @@ namespace Beam::Services {
   template<typename B>
   void ServiceProtocolClientHandler<B>::MessageLoop() {
     auto client = std::shared_ptr<Client>();
+    auto messages = std::vector<std::shared_ptr<Message<Client>>>();
     while(m_openState.IsOpen()) {
       try {
         client = GetClient();
         while(true) {
-          auto message = client->ReadMessage();
-          if(auto slot = client->GetSlots().Find(*message)) {
-            message->EmitSignal(slot, Ref(*client));
+          messages.clear();
+          client->ReadMessages(Store(messages));
+          for(auto& message : messages) {
+            if(auto slot = client->GetSlots().Find(*message)) {
+              message->EmitSignal(slot, Ref(*client));
+            }
           }
         }
       } catch(const std::exception&) {
@@ -0,0 +1,155 @@
+#ifndef BEAM_CPU_AFFINITY_HPP
+#define BEAM_CPU_AFFINITY_HPP
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <boost/lexical_cast.hpp>
+#include <boost/thread/thread.hpp>
+#ifdef _WIN32
+  #include <Windows.h>
+#elif defined(__linux__)
+  #include <pthread.h>
+  #include <sched.h>
+#endif
+#include "Beam/Threading/Threading.hpp"
+
+namespace Beam::Threading {
+
+  /**
+   * Parses a list of cores in the form used by Linux's cpulist files, for
+   * example "0-3,8,10-11".
+   * @param list The list of cores to parse.
+   * @return The cores represented by the <i>list</i>, in ascending order.
+   */
+  inline std::vector<int> ParseCpuList(const std::string& list) {
+    auto cores = std::vector<int>();
+    auto start = std::size_t(0);
+    while(start < list.size()) {
+      auto end = list.find(',', start);
+      if(end == std::string::npos) {
+        end = list.size();
+      }
+      auto token = list.substr(start, end - start);
+      token.erase(std::remove_if(token.begin(), token.end(),
+        [] (auto c) { return std::isspace(c); }), token.end());
+      if(!token.empty()) {
+        auto separator = token.find('-');
+        try {
+          if(separator == std::string::npos) {
+            cores.push_back(boost::lexical_cast<int>(token));
+          } else {
+            auto first = boost::lexical_cast<int>(token.substr(0, separator));
+            auto last = boost::lexical_cast<int>(token.substr(separator + 1));
+            if(first > last) {
+              throw std::invalid_argument("Invalid CPU list: " + list);
+            }
+            for(auto core = first; core <= last; ++core) {
+              cores.push_back(core);
+            }
+          }
+        } catch(const boost::bad_lexical_cast&) {
+          throw std::invalid_argument("Invalid CPU list: " + list);
+        }
+      }
+      start = end + 1;
+    }
+    std::sort(cores.begin(), cores.end());
+    cores.erase(std::unique(cores.begin(), cores.end()), cores.end());
+    return cores;
+  }
+
+  /** Returns the cores available to the process. */
+  inline std::vector<int> GetAvailableCores() {
+    auto cores = std::vector<int>();
+#if defined(__linux__)
+    auto set = cpu_set_t();
+    CPU_ZERO(&set);
+    if(sched_getaffinity(0, sizeof(set), &set) == 0) {
+      for(auto i = 0; i < CPU_SETSIZE; ++i) {
+        if(CPU_ISSET(i, &set)) {
+          cores.push_back(i);
+        }
+      }
+      return cores;
+    }
+#endif
+    auto count = static_cast<int>(boost::thread::hardware_concurrency());
+    for(auto i = 0; i < count; ++i) {
+      cores.push_back(i);
+    }
+    return cores;
+  }
+
+  /**
+   * Returns the cores belonging to a NUMA node.
+   * @param node The index of the NUMA node.
+   * @return The cores on the specified <i>node</i>, or an empty list if the
+   *         node does not exist.
+   */
+  inline std::vector<int> GetNumaNodeCores(int node) {
+#if defined(__linux__)
+    auto file = std::ifstream("/sys/devices/system/node/node" +
+      std::to_string(node) + "/cpulist");
+    auto list = std::string();
+    if(!std::getline(file, list)) {
+      return {};
+    }
+    return ParseCpuList(list);
+#elif defined(_WIN32)
+    auto mask = ULONGLONG(0);
+    if(!::GetNumaNodeProcessorMask(static_cast<UCHAR>(node), &mask)) {
+      return {};
+    }
+    auto cores = std::vector<int>();
+    for(auto i = 0; i < 64; ++i) {
+      if(mask & (ULONGLONG(1) << i)) {
+        cores.push_back(i);
+      }
+    }
+    return cores;
+#else
+    return {};
+#endif
+  }
+
+  /**
+   * Removes a set of reserved cores from a list of cores, throwing an
+   * std::invalid_argument if every core is reserved.
+   * @param cores The list of cores.
+   * @param reserved The cores to remove.
+   * @return The <i>cores</i> not found in <i>reserved</i>.
+   */
+  inline std::vector<int> ExcludeCores(std::vector<int> cores,
+      const std::vector<int>& reserved) {
+    auto isEmpty = cores.empty();
+    cores.erase(std::remove_if(cores.begin(), cores.end(), [&] (auto core) {
+      return std::find(reserved.begin(), reserved.end(), core) !=
+        reserved.end();
+    }), cores.end());
+    if(cores.empty() && !isEmpty) {
+      throw std::invalid_argument("All cores are reserved.");
+    }
+    return cores;
+  }
+
+  /**
+   * Pins the calling thread to a single core, platforms without support for
+   * thread affinity ignore the request.
+   * @param core The core to run the calling thread on.
+   */
+  inline void SetCurrentThreadAffinity(int core) {
+#if defined(__linux__)
+    auto set = cpu_set_t();
+    CPU_ZERO(&set);
+    CPU_SET(core, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#elif defined(_WIN32)
+    ::SetThreadAffinityMask(::GetCurrentThread(), DWORD_PTR(1) << core);
+#endif
+  }
+}
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef BEAM_EVENT_COUNT_HPP
+#define BEAM_EVENT_COUNT_HPP
+#include <atomic>
+#include <boost/thread/mutex.hpp>
+#include "Beam/Routines/Routine.hpp"
+#include "Beam/Routines/SuspendedRoutineQueue.hpp"
+#include "Beam/Threading/Threading.hpp"
+
+namespace Beam::Threading {
+
+  /**
+   * Suspends Routines until a condition on lock-free state holds. Notifying
+   * costs a fence and a load unless a Routine is waiting.
+   */
+  class EventCount {
+    public:
+
+      /** Constructs an EventCount. */
+      EventCount();
+
+      /**
+       * Suspends the current Routine until a condition is satisfied.
+       * @param isReady Returns <code>true</code> iff the Routine can resume,
+       *        the state it reads must be published before NotifyAll is
+       *        called.
+       */
+      template<typename F>
+      void Wait(F&& isReady);
+
+      /** Resumes all waiting Routines so that they check their condition. */
+      void NotifyAll();
+
+    private:
+      std::atomic_size_t m_waiterCount;
+      boost::mutex m_mutex;
+      Routines::SuspendedRoutineQueue m_suspendedRoutines;
+
+      EventCount(const EventCount&) = delete;
+      EventCount& operator =(const EventCount&) = delete;
+  };
+
+  inline EventCount::EventCount()
+    : m_waiterCount(0) {}
+
+  template<typename F>
+  void EventCount::Wait(F&& isReady) {
+    auto lock = boost::unique_lock(m_mutex);
+    m_waiterCount.fetch_add(1);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    while(!isReady()) {
+      Routines::Suspend(Store(m_suspendedRoutines), lock);
+    }
+    m_waiterCount.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  inline void EventCount::NotifyAll() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if(m_waiterCount.load(std::memory_order_relaxed) == 0) {
+      return;
+    }
+    auto lock = boost::lock_guard(m_mutex);
+    Routines::Resume(Store(m_suspendedRoutines));
+  }
+}
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef BEAM_LOCK_TRAITS_HPP
+#define BEAM_LOCK_TRAITS_HPP
+#include <type_traits>
+#include <boost/thread/locks.hpp>
+#include <boost/utility/declval.hpp>
+#include "Beam/Threading/Threading.hpp"
+
+namespace Beam::Threading {
+
+  /**
+   * Tests whether a mutex can be acquired for shared ownership.
+   * @param <T> The type of mutex to test.
+   */
+  template<typename T, typename = void>
+  struct IsSharedMutex : std::false_type {};
+
+  template<typename T>
+  struct IsSharedMutex<T, std::enable_if_t<
+      std::is_void_v<decltype(boost::declval<T>().lock_shared())> &&
+      std::is_same_v<decltype(boost::declval<T>().try_lock_shared()), bool> &&
+      std::is_void_v<decltype(boost::declval<T>().unlock_shared())>>> :
+    std::true_type {};
+
+  /**
+   * Specifies the lock used for immutable access, a shared lock if the mutex
+   * supports shared ownership, otherwise an exclusive lock.
+   * @param <T> The type of mutex to lock.
+   */
+  template<typename T, typename = void>
+  struct ReadLock {
+    using type = boost::unique_lock<T>;
+  };
+
+  template<typename T>
+  struct ReadLock<T, std::enable_if_t<IsSharedMutex<T>::value>> {
+    using type = boost::shared_lock<T>;
+  };
+
+  template<typename T>
+  using GetReadLock = typename ReadLock<T>::type;
+
+  /**
+   * Specifies the lock used for mutable access.
+   * @param <T> The type of mutex to lock.
+   */
+  template<typename T>
+  struct WriteLock {
+    using type = boost::unique_lock<T>;
+  };
+
+  template<typename T>
+  using GetWriteLock = typename WriteLock<T>::type;
+}
+
+#endif
@@ -1,18 +1,32 @@
 #ifndef BEAM_MUTEX_HPP
 #define BEAM_MUTEX_HPP
+#include <atomic>
+#include <cassert>
 #include <boost/thread/lock_types.hpp>
 #include <boost/thread/mutex.hpp>
 #include "Beam/Routines/Routine.hpp"
 #include "Beam/Routines/SuspendedRoutineQueue.hpp"
 #include "Beam/Threading/LockRelease.hpp"
+#include "Beam/Threading/SpinWait.hpp"
 #include "Beam/Threading/Threading.hpp"
 
+#ifndef BEAM_MUTEX_SPIN_COUNT
+  #define BEAM_MUTEX_SPIN_COUNT 32
+#endif
+
 namespace Beam::Threading {
 
-  /** Implements a mutex that suspends the current Routine. */
+  /**
+   * Implements a mutex that suspends the current Routine. A contended lock
+   * first spins for a bounded number of iterations in case the holder is
+   * about to release it.
+   */
   class Mutex {
     public:
 
+      /** The number of times to poll a contended lock before suspending. */
+      static constexpr auto SPIN_COUNT = BEAM_MUTEX_SPIN_COUNT;
+
       /** Constructs a Mutex. */
       Mutex();
 
@@ -29,7 +43,7 @@ namespace Beam::Threading {
 
     private:
       boost::mutex m_mutex;
-      int m_counter;
+      std::atomic_int m_counter;
       Routines::SuspendedRoutineQueue m_suspendedRoutines;
 
       Mutex(const Mutex&) = delete;
@@ -44,9 +58,23 @@ namespace Beam::Threading {
   }
 
   inline void Mutex::lock() {
+
+    /* Only spin while no Routine is queued, ownership is handed directly to
+       queued Routines so spinning past them can not succeed. */
+    for(auto i = 0; i < SPIN_COUNT; ++i) {
+      auto counter = m_counter.load(std::memory_order_relaxed);
+      if(counter == 0) {
+        if(m_counter.compare_exchange_weak(counter, 1,
+            std::memory_order_acquire, std::memory_order_relaxed)) {
+          return;
+        }
+      } else if(counter > 1) {
+        break;
+      }
+      CpuRelax();
+    }
     auto lock = boost::unique_lock(m_mutex);
-    ++m_counter;
-    if(m_counter > 1) {
+    if(m_counter.fetch_add(1, std::memory_order_acquire) != 0) {
       auto currentRoutine = Routines::SuspendedRoutineNode();
       m_suspendedRoutines.push_back(currentRoutine);
       currentRoutine.m_routine->PendingSuspend();
@@ -56,22 +84,21 @@ namespace Beam::Threading {
   }
 
   inline bool Mutex::try_lock() {
-    auto lock = boost::lock_guard(m_mutex);
-    if(m_counter > 0) {
-      return false;
-    }
-    m_counter = 1;
-    return true;
+    auto counter = 0;
+    return m_counter.compare_exchange_strong(counter, 1,
+      std::memory_order_acquire, std::memory_order_relaxed);
   }
 
   inline void Mutex::unlock() {
+    auto counter = 1;
+    if(m_counter.compare_exchange_strong(counter, 0,
+        std::memory_order_release, std::memory_order_relaxed)) {
+      return;
+    }
     auto routine = static_cast<Routines::Routine*>(nullptr);
     {
       auto lock = boost::lock_guard(m_mutex);
-      --m_counter;
-      if(m_counter == 0) {
-        return;
-      }
+      m_counter.fetch_sub(1, std::memory_order_release);
       routine = m_suspendedRoutines.front().m_routine;
       m_suspendedRoutines.pop_front();
     }
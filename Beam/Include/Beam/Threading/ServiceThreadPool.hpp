@@ -1,58 +1,153 @@
 #ifndef BEAM_SERVICE_THREAD_POOL_HPP
 #define BEAM_SERVICE_THREAD_POOL_HPP
+#include <atomic>
 #include <memory>
+#include <vector>
 #include <boost/asio/io_service.hpp>
 #include <boost/thread/thread.hpp>
 #include "Beam/Network/Network.hpp"
+#include "Beam/Routines/Scheduler.hpp"
+#include "Beam/Threading/CpuAffinity.hpp"
+#include "Beam/Threading/ServiceThreadPoolOptions.hpp"
+#include "Beam/Threading/SpinWait.hpp"
 #include "Beam/Threading/Threading.hpp"
 #include "Beam/Utilities/Singleton.hpp"
 
 namespace Beam::Threading {
 
-  /** Wraps a list of ASIO worker threads. */
+  /**
+   * Wraps a list of ASIO worker threads, either all running a single
+   * io_service or each running its own.
+   */
   class ServiceThreadPool : public Singleton<ServiceThreadPool> {
     public:
+
+      /**
+       * Constructs a ServiceThreadPool.
+       * @param options The options used to configure the pool.
+       */
+      explicit ServiceThreadPool(const ServiceThreadPoolOptions& options);
+
       ~ServiceThreadPool();
 
+      /** Returns the options this pool was constructed with. */
+      const ServiceThreadPoolOptions& GetOptions() const;
+
+      /**
+       * Returns the io_service to bind the calling thread's sockets and timers
+       * to, when running an io_service per thread this is the io_service
+       * whose index matches the calling Scheduler context.
+       */
+      boost::asio::io_service& GetService();
+
+      /**
+       * Returns the pool's io_services in round-robin order, used to spread
+       * sockets that are not tied to the calling context, such as accepted
+       * connections, across the pool's threads.
+       */
+      boost::asio::io_service& GetNextService();
+
     private:
       friend class Beam::Network::MulticastSocket;
+      friend class Beam::Network::SecureServerSocket;
       friend class Beam::Network::SecureSocketChannel;
       friend class Beam::Network::TcpServerSocket;
       friend class Beam::Network::TcpSocketChannel;
       friend class Beam::Network::UdpSocket;
       friend class LiveTimer;
       friend class Singleton<ServiceThreadPool>;
-      boost::asio::io_service m_service;
-      boost::asio::io_service::work m_work;
+      ServiceThreadPoolOptions m_options;
       std::size_t m_threadCount;
+      std::vector<std::unique_ptr<boost::asio::io_service>> m_services;
+      std::vector<std::unique_ptr<boost::asio::io_service::work>> m_works;
+      std::atomic_size_t m_nextService;
       std::unique_ptr<boost::thread[]> m_threads;
 
       ServiceThreadPool();
       ServiceThreadPool(const ServiceThreadPool&) = delete;
       ServiceThreadPool& operator =(const ServiceThreadPool&) = delete;
-      boost::asio::io_service& GetService();
+      void Run(std::size_t index);
   };
 
   inline ServiceThreadPool::~ServiceThreadPool() {
-    m_service.stop();
+    for(auto& service : m_services) {
+      service->stop();
+    }
     for(auto i = std::size_t(0); i < m_threadCount; ++i) {
       m_threads[i].join();
     }
   }
 
+  inline const ServiceThreadPoolOptions&
+      ServiceThreadPool::GetOptions() const {
+    return m_options;
+  }
+
   inline ServiceThreadPool::ServiceThreadPool()
-      : m_work(m_service),
-        m_threadCount(boost::thread::hardware_concurrency()),
+    : ServiceThreadPool(Details::GetServiceThreadPoolOptions()) {}
+
+  inline ServiceThreadPool::ServiceThreadPool(
+      const ServiceThreadPoolOptions& options)
+      : m_options(options),
+        m_threadCount(m_options.GetThreadCount()),
+        m_nextService(0),
         m_threads(std::make_unique<boost::thread[]>(m_threadCount)) {
+    auto serviceCount = m_options.m_isServicePerThread ? m_threadCount : 1;
+    for(auto i = std::size_t(0); i < serviceCount; ++i) {
+      m_services.push_back(std::make_unique<boost::asio::io_service>());
+      m_works.push_back(
+        std::make_unique<boost::asio::io_service::work>(*m_services.back()));
+    }
     for(auto i = std::size_t(0); i < m_threadCount; ++i) {
       m_threads[i] = boost::thread([=] {
-        m_service.run();
+        Run(i);
       });
     }
   }
 
   inline boost::asio::io_service& ServiceThreadPool::GetService() {
-    return m_service;
+    if(m_services.size() == 1) {
+      return *m_services.front();
+    }
+    auto contextId = Routines::GetCurrentContextId();
+    if(contextId == static_cast<std::size_t>(-1)) {
+
+      /* Threads outside of the Scheduler keep the io_service first assigned
+         to them so that repeated calls agree. */
+      thread_local auto index = m_nextService.fetch_add(1);
+      contextId = index;
+    }
+    return *m_services[contextId % m_services.size()];
+  }
+
+  inline boost::asio::io_service& ServiceThreadPool::GetNextService() {
+    if(m_services.size() == 1) {
+      return *m_services.front();
+    }
+    return *m_services[m_nextService.fetch_add(1) % m_services.size()];
+  }
+
+  inline void ServiceThreadPool::Run(std::size_t index) {
+    auto& service = *m_services[index % m_services.size()];
+    if(!m_options.m_cores.empty()) {
+      SetCurrentThreadAffinity(
+        m_options.m_cores[index % m_options.m_cores.size()]);
+    }
+    if(m_options.m_spinDuration <= boost::posix_time::time_duration()) {
+      service.run();
+      return;
+    }
+
+    /* Poll for ready handlers for the spin duration before blocking so that
+       back to back completions do not pay for a thread wake up. */
+    while(!service.stopped()) {
+      if(SpinUntil([&] {
+          return service.poll() != 0 || service.stopped();
+        }, m_options.m_spinDuration)) {
+        continue;
+      }
+      service.run_one();
+    }
   }
 }
 
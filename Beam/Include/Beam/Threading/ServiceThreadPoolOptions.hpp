@@ -0,0 +1,150 @@
+#ifndef BEAM_SERVICE_THREAD_POOL_OPTIONS_HPP
+#define BEAM_SERVICE_THREAD_POOL_OPTIONS_HPP
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/optional/optional.hpp>
+#include <boost/thread/thread.hpp>
+#include "Beam/Routines/SchedulerOptions.hpp"
+#include "Beam/Threading/CpuAffinity.hpp"
+#include "Beam/Threading/Threading.hpp"
+#include "Beam/Utilities/EnvironmentVariable.hpp"
+
+namespace Beam::Threading {
+
+  /** Stores the options used to construct the ServiceThreadPool. */
+  struct ServiceThreadPoolOptions {
+
+    /**
+     * The number of threads running the io_service, or 0 to use one thread
+     * per pinned core or, if no cores are pinned, per available core.
+     */
+    std::size_t m_threadCount;
+
+    /**
+     * The cores reserved for the pool, thread i runs on core
+     * m_cores[i % m_cores.size()]. An empty list disables pinning.
+     */
+    std::vector<int> m_cores;
+
+    /**
+     * The amount of time an idle thread polls for completions before it
+     * blocks.
+     */
+    boost::posix_time::time_duration m_spinDuration;
+
+    /**
+     * Whether each thread runs its own io_service. Sockets and timers are
+     * then bound to the io_service of the thread whose index matches the
+     * Scheduler context they are created on, so their completions stay on
+     * one thread rather than crossing a shared queue. Accepted connections
+     * are spread across the threads in round-robin order.
+     */
+    bool m_isServicePerThread;
+
+    /** Constructs the default options. */
+    ServiceThreadPoolOptions();
+
+    /** Returns the number of threads these options resolve to. */
+    std::size_t GetThreadCount() const;
+
+    /**
+     * Returns the default options overridden by the following environment
+     * variables:
+     * BEAM_SERVICE_THREADS: The number of threads.
+     * BEAM_SERVICE_CORES: The cores reserved for the pool, for example "0-1".
+     * BEAM_SERVICE_SPIN_MICROSECONDS: The idle spin duration.
+     * BEAM_SERVICE_PER_THREAD: Non-zero to run an io_service per thread.
+     * In that mode any cores or thread count that are not specified are taken
+     * from the Scheduler when the ServiceThreadPool is constructed.
+     */
+    static ServiceThreadPoolOptions FromEnvironment();
+  };
+
+  /**
+   * Sets the options used to construct the ServiceThreadPool, this must be
+   * called before any socket or timer is created.
+   * @param options The options to construct the ServiceThreadPool with.
+   */
+  void SetServiceThreadPoolOptions(const ServiceThreadPoolOptions& options);
+
+namespace Details {
+
+  /**
+   * Defaults an io_service per thread pool's cores and thread count to the
+   * Scheduler's, so that service thread i shares a core with context i.
+   * @param options The ServiceThreadPool's options.
+   * @param schedulerOptions The Scheduler's options.
+   */
+  inline void ShareSchedulerCores(ServiceThreadPoolOptions& options,
+      const Routines::SchedulerOptions& schedulerOptions) {
+    if(!options.m_isServicePerThread) {
+      return;
+    }
+    if(options.m_cores.empty()) {
+      options.m_cores = schedulerOptions.m_cores;
+    }
+    if(options.m_threadCount == 0) {
+      options.m_threadCount = schedulerOptions.GetThreadCount();
+    }
+  }
+
+  inline boost::optional<ServiceThreadPoolOptions>&
+      GetServiceThreadPoolOptionsOverride() {
+    static auto options = boost::optional<ServiceThreadPoolOptions>();
+    return options;
+  }
+
+  /** Returns the options the ServiceThreadPool is constructed with. */
+  inline ServiceThreadPoolOptions GetServiceThreadPoolOptions() {
+    if(auto& options = GetServiceThreadPoolOptionsOverride()) {
+      return *options;
+    }
+    auto options = ServiceThreadPoolOptions::FromEnvironment();
+    ShareSchedulerCores(options, Routines::Details::GetSchedulerOptions());
+    return options;
+  }
+}
+
+  inline ServiceThreadPoolOptions::ServiceThreadPoolOptions()
+    : m_threadCount(0),
+      m_isServicePerThread(false) {}
+
+  inline std::size_t ServiceThreadPoolOptions::GetThreadCount() const {
+    if(m_threadCount != 0) {
+      return m_threadCount;
+    } else if(!m_cores.empty()) {
+      return m_cores.size();
+    }
+    return std::max<std::size_t>(boost::thread::hardware_concurrency(), 1);
+  }
+
+  inline ServiceThreadPoolOptions ServiceThreadPoolOptions::FromEnvironment() {
+    auto options = ServiceThreadPoolOptions();
+    if(auto threadCount = ReadEnvironmentVariable<std::size_t>(
+        "BEAM_SERVICE_THREADS")) {
+      options.m_threadCount = *threadCount;
+    }
+    if(auto cores = ReadEnvironmentVariable<std::string>(
+        "BEAM_SERVICE_CORES")) {
+      options.m_cores = ParseCpuList(*cores);
+    }
+    if(auto spin = ReadEnvironmentVariable<int>(
+        "BEAM_SERVICE_SPIN_MICROSECONDS")) {
+      options.m_spinDuration = boost::posix_time::microseconds(*spin);
+    }
+    if(auto isServicePerThread = ReadEnvironmentVariable<int>(
+        "BEAM_SERVICE_PER_THREAD")) {
+      options.m_isServicePerThread = *isServicePerThread != 0;
+    }
+    return options;
+  }
+
+  inline void SetServiceThreadPoolOptions(
+      const ServiceThreadPoolOptions& options) {
+    Details::GetServiceThreadPoolOptionsOverride() = options;
+  }
+}
+
+#endif
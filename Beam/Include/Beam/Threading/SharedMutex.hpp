@@ -0,0 +1,119 @@
+#ifndef BEAM_SHARED_MUTEX_HPP
+#define BEAM_SHARED_MUTEX_HPP
+#include <cassert>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/mutex.hpp>
+#include "Beam/Routines/Routine.hpp"
+#include "Beam/Routines/SuspendedRoutineQueue.hpp"
+#include "Beam/Threading/Threading.hpp"
+
+namespace Beam::Threading {
+
+  /**
+   * Implements a reader/writer mutex that suspends the current Routine. Once
+   * a writer is waiting, new readers are suspended until it has acquired and
+   * released the lock.
+   */
+  class SharedMutex {
+    public:
+
+      /** Constructs a SharedMutex. */
+      SharedMutex();
+
+      ~SharedMutex();
+
+      /** Locks this SharedMutex for exclusive ownership. */
+      void lock();
+
+      /** Tries to lock this SharedMutex for exclusive ownership. */
+      bool try_lock();
+
+      /** Releases exclusive ownership of this SharedMutex. */
+      void unlock();
+
+      /** Locks this SharedMutex for shared ownership. */
+      void lock_shared();
+
+      /** Tries to lock this SharedMutex for shared ownership. */
+      bool try_lock_shared();
+
+      /** Releases shared ownership of this SharedMutex. */
+      void unlock_shared();
+
+    private:
+      boost::mutex m_mutex;
+      int m_readerCount;
+      int m_waitingWriterCount;
+      bool m_isWriting;
+      Routines::SuspendedRoutineQueue m_suspendedReaders;
+      Routines::SuspendedRoutineQueue m_suspendedWriters;
+
+      SharedMutex(const SharedMutex&) = delete;
+      SharedMutex& operator =(const SharedMutex&) = delete;
+  };
+
+  inline SharedMutex::SharedMutex()
+    : m_readerCount(0),
+      m_waitingWriterCount(0),
+      m_isWriting(false) {}
+
+  inline SharedMutex::~SharedMutex() {
+    assert(m_readerCount == 0 && !m_isWriting);
+  }
+
+  inline void SharedMutex::lock() {
+    auto lock = boost::unique_lock(m_mutex);
+    ++m_waitingWriterCount;
+    while(m_isWriting || m_readerCount != 0) {
+      Routines::Suspend(Store(m_suspendedWriters), lock);
+    }
+    --m_waitingWriterCount;
+    m_isWriting = true;
+  }
+
+  inline bool SharedMutex::try_lock() {
+    auto lock = boost::lock_guard(m_mutex);
+    if(m_isWriting || m_readerCount != 0) {
+      return false;
+    }
+    m_isWriting = true;
+    return true;
+  }
+
+  inline void SharedMutex::unlock() {
+    auto lock = boost::lock_guard(m_mutex);
+    m_isWriting = false;
+    if(m_waitingWriterCount != 0) {
+      Routines::ResumeFront(Store(m_suspendedWriters));
+    } else {
+      Routines::Resume(Store(m_suspendedReaders));
+    }
+  }
+
+  inline void SharedMutex::lock_shared() {
+    auto lock = boost::unique_lock(m_mutex);
+    while(m_isWriting || m_waitingWriterCount != 0) {
+      Routines::Suspend(Store(m_suspendedReaders), lock);
+    }
+    ++m_readerCount;
+  }
+
+  inline bool SharedMutex::try_lock_shared() {
+    auto lock = boost::lock_guard(m_mutex);
+    if(m_isWriting || m_waitingWriterCount != 0) {
+      return false;
+    }
+    ++m_readerCount;
+    return true;
+  }
+
+  inline void SharedMutex::unlock_shared() {
+    auto lock = boost::lock_guard(m_mutex);
+    --m_readerCount;
+    if(m_readerCount == 0) {
+      Routines::ResumeFront(Store(m_suspendedWriters));
+    }
+  }
+}
+
+#endif
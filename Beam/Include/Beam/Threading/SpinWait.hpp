@@ -0,0 +1,56 @@
+#ifndef BEAM_SPIN_WAIT_HPP
+#define BEAM_SPIN_WAIT_HPP
+#include <chrono>
+#include <thread>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#if defined(_MSC_VER)
+  #include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+  #include <immintrin.h>
+#endif
+#include "Beam/Threading/Threading.hpp"
+
+namespace Beam::Threading {
+
+  /** Hints to the processor that the calling thread is busy waiting. */
+  inline void CpuRelax() {
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#else
+    std::this_thread::yield();
+#endif
+  }
+
+  /**
+   * Busy waits until a condition is satisfied or a period of time elapses.
+   * @param condition The condition to wait for.
+   * @param duration The maximum amount of time to spin for.
+   * @return <code>true</code> iff the <i>condition</i> was satisfied.
+   */
+  template<typename F>
+  bool SpinUntil(F&& condition, boost::posix_time::time_duration duration) {
+    if(condition()) {
+      return true;
+    }
+    if(duration <= boost::posix_time::time_duration()) {
+      return false;
+    }
+    auto deadline = std::chrono::steady_clock::now() +
+      std::chrono::microseconds(duration.total_microseconds());
+    while(true) {
+      for(auto i = 0; i < 64; ++i) {
+        CpuRelax();
+        if(condition()) {
+          return true;
+        }
+      }
+      if(std::chrono::steady_clock::now() >= deadline) {
+        return false;
+      }
+    }
+  }
+}
+
+#endif
@@ -4,44 +4,12 @@
 #include <variant>
 #include <boost/thread/locks.hpp>
 #include <boost/thread/mutex.hpp>
-#include <boost/utility/declval.hpp>
 #include "Beam/Threading/LockRelease.hpp"
+#include "Beam/Threading/LockTraits.hpp"
 #include "Beam/Threading/Threading.hpp"
 #include "Beam/Utilities/BeamWorkaround.hpp"
 
 namespace Beam::Threading {
-namespace Details {
-  template<typename T, typename = void>
-  struct IsSharedMutex : std::false_type {};
-
-  template<typename T>
-  struct IsSharedMutex<T, std::enable_if_t<
-      std::is_void_v<decltype(boost::declval<T>().lock_shared())> &&
-      std::is_same_v<decltype(boost::declval<T>().try_lock_shared()), bool> &&
-      std::is_void_v<decltype(boost::declval<T>().unlock_shared())>>> :
-    std::true_type {};
-
-  template<typename T, typename = void>
-  struct ReadLock {
-    using type = boost::unique_lock<T>;
-  };
-
-  template<typename T>
-  struct ReadLock<T, std::enable_if_t<IsSharedMutex<T>::value>> {
-    using type = boost::shared_lock<T>;
-  };
-
-  template<typename T>
-  using GetReadLock = typename ReadLock<T>::type;
-
-  template<typename T>
-  struct WriteLock {
-    using type = boost::unique_lock<T>;
-  };
-
-  template<typename T>
-  using GetWriteLock = typename WriteLock<T>::type;
-}
 
   /**
    * Synchronizes access to a resource.
@@ -60,10 +28,10 @@ namespace Details {
       using Mutex = M;
 
       /** The type of the lock used for immutable access. */
-      using ReadLock = Details::GetReadLock<Mutex>;
+      using ReadLock = GetReadLock<Mutex>;
 
       /** The type of the lock used for mutable access. */
-      using WriteLock = Details::GetWriteLock<Mutex>;
+      using WriteLock = GetWriteLock<Mutex>;
 
       /** The proxy for any type of lock in use. */
       class LockProxy {
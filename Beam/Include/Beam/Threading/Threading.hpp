@@ -4,6 +4,7 @@
 namespace Beam::Threading {
   template<typename M> class CallOnce;
   class ConditionVariable;
+  class EventCount;
   class LiveTimer;
   template<typename L> class LockRelease;
   class Mutex;
@@ -11,8 +12,11 @@ namespace Beam::Threading {
   template<typename M> struct PreferredConditionVariable;
   class RecursiveMutex;
   class ServiceThreadPool;
+  struct ServiceThreadPoolOptions;
+  class SharedMutex;
   template<typename T, typename M> class Sync;
   class TaskRunner;
+  struct ThreadingConfig;
   class ThreadPool;
   class TimedConditionVariable;
   class TimeoutException;
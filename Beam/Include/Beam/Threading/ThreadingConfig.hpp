@@ -0,0 +1,105 @@
+#ifndef BEAM_THREADING_CONFIG_HPP
+#define BEAM_THREADING_CONFIG_HPP
+#include <string>
+#include <vector>
+#include "Beam/Routines/SchedulerOptions.hpp"
+#include "Beam/Threading/CpuAffinity.hpp"
+#include "Beam/Threading/ServiceThreadPoolOptions.hpp"
+#include "Beam/Threading/Threading.hpp"
+#include "Beam/Utilities/YamlConfig.hpp"
+
+namespace Beam::Threading {
+
+  /**
+   * Stores the configuration of the Routine Scheduler and the
+   * ServiceThreadPool.
+   */
+  struct ThreadingConfig {
+
+    /**
+     * Parses a ThreadingConfig from a YAML Node, values that are not
+     * specified are taken from the environment.
+     * @param node The YAML node to parse.
+     */
+    static ThreadingConfig Parse(const YAML::Node& node);
+
+    /** The options used to construct the Scheduler. */
+    Routines::SchedulerOptions m_schedulerOptions;
+
+    /** The options used to construct the ServiceThreadPool. */
+    ServiceThreadPoolOptions m_serviceThreadPoolOptions;
+  };
+
+  /**
+   * Applies a ThreadingConfig, this must be called before any Routine is
+   * spawned or any socket or timer is created.
+   * @param config The configuration to apply.
+   */
+  inline void Configure(const ThreadingConfig& config) {
+    Routines::SetSchedulerOptions(config.m_schedulerOptions);
+    SetServiceThreadPoolOptions(config.m_serviceThreadPoolOptions);
+  }
+
+namespace Details {
+  inline std::vector<int> ParseCores(const YAML::Node& node,
+      const std::vector<int>& cores) {
+    if(auto& numaNode = node["numa_node"]) {
+      return GetNumaNodeCores(Extract<int>(numaNode));
+    }
+    auto& coresNode = node["cores"];
+    if(!coresNode) {
+      return cores;
+    } else if(coresNode.IsSequence()) {
+      return Extract<std::vector<int>>(coresNode);
+    }
+    return ParseCpuList(Extract<std::string>(coresNode));
+  }
+}
+
+  inline ThreadingConfig ThreadingConfig::Parse(const YAML::Node& node) {
+    auto config = ThreadingConfig();
+    config.m_schedulerOptions = Routines::SchedulerOptions::FromEnvironment();
+    config.m_serviceThreadPoolOptions =
+      ServiceThreadPoolOptions::FromEnvironment();
+    auto& schedulerOptions = config.m_schedulerOptions;
+    auto& serviceThreadPoolOptions = config.m_serviceThreadPoolOptions;
+    if(auto& serviceNode = node["service_pool"]) {
+      serviceThreadPoolOptions.m_threadCount = Extract<std::size_t>(
+        serviceNode, "threads", serviceThreadPoolOptions.m_threadCount);
+      serviceThreadPoolOptions.m_cores = Details::ParseCores(serviceNode,
+        serviceThreadPoolOptions.m_cores);
+      serviceThreadPoolOptions.m_spinDuration =
+        Extract<boost::posix_time::time_duration>(serviceNode, "spin",
+        serviceThreadPoolOptions.m_spinDuration);
+      serviceThreadPoolOptions.m_isServicePerThread = Extract<bool>(
+        serviceNode, "per_thread",
+        serviceThreadPoolOptions.m_isServicePerThread);
+    }
+    if(auto& schedulerNode = node["scheduler"]) {
+      schedulerOptions.m_threadCount = Extract<std::size_t>(schedulerNode,
+        "threads", schedulerOptions.m_threadCount);
+      schedulerOptions.m_cores = Details::ParseCores(schedulerNode,
+        schedulerOptions.m_cores);
+      schedulerOptions.m_isWorkStealing = Extract<bool>(schedulerNode,
+        "work_stealing", schedulerOptions.m_isWorkStealing);
+      schedulerOptions.m_spinDuration =
+        Extract<boost::posix_time::time_duration>(schedulerNode, "spin",
+        schedulerOptions.m_spinDuration);
+      schedulerOptions.m_watchdogThreshold =
+        Extract<boost::posix_time::time_duration>(schedulerNode, "watchdog",
+        schedulerOptions.m_watchdogThreshold);
+    }
+    if(serviceThreadPoolOptions.m_isServicePerThread) {
+      Details::ShareSchedulerCores(serviceThreadPoolOptions, schedulerOptions);
+    } else if(!serviceThreadPoolOptions.m_cores.empty()) {
+      if(schedulerOptions.m_cores.empty()) {
+        schedulerOptions.m_cores = GetAvailableCores();
+      }
+      schedulerOptions.m_cores = ExcludeCores(
+        std::move(schedulerOptions.m_cores), serviceThreadPoolOptions.m_cores);
+    }
+    return config;
+  }
+}
+
+#endif
@@ -0,0 +1,30 @@
+#ifndef BEAM_ENVIRONMENT_VARIABLE_HPP
+#define BEAM_ENVIRONMENT_VARIABLE_HPP
+#include <cstdlib>
+#include <boost/lexical_cast.hpp>
+#include <boost/optional/optional.hpp>
+#include "Beam/Utilities/Utilities.hpp"
+
+namespace Beam {
+
+  /**
+   * Returns the value of an environment variable.
+   * @param name The name of the environment variable.
+   * @return The variable's value, or <code>none</code> if the variable is not
+   *         set or can not be converted to a <i>T</i>.
+   */
+  template<typename T>
+  boost::optional<T> ReadEnvironmentVariable(const char* name) {
+    auto value = std::getenv(name);
+    if(value == nullptr || *value == '\0') {
+      return boost::none;
+    }
+    try {
+      return boost::lexical_cast<T>(value);
+    } catch(const boost::bad_lexical_cast&) {
+      return boost::none;
+    }
+  }
+}
+
+#endif
@@ -9,6 +9,18 @@
 #include "Beam/WebServices/Uri.hpp"
 #include "Beam/WebServices/WebServices.hpp"
 
+/**
+ * Set to 1 to connect plain TCP URIs with a UringSocketChannel on Linux,
+ * kernels without io_uring support fall back to a TcpSocketChannel.
+ */
+#ifndef BEAM_ENABLE_IO_URING
+  #define BEAM_ENABLE_IO_URING 0
+#endif
+
+#if BEAM_ENABLE_IO_URING && defined(__linux__)
+  #include "Beam/Network/UringSocketChannel.hpp"
+#endif
+
 namespace Beam::WebServices {
 
   /**
@@ -55,6 +67,19 @@ namespace Beam::WebServices {
       }();
       return std::make_unique<IO::ChannelBox>(std::move(baseSocket));
     } else {
+#if BEAM_ENABLE_IO_URING && defined(__linux__)
+      if(Network::IoUringService::IsAvailable()) {
+        auto baseSocket = [&] {
+          if(m_interface) {
+            return std::make_unique<Network::UringSocketChannel>(
+              std::move(address), *m_interface);
+          }
+          return std::make_unique<Network::UringSocketChannel>(
+            std::move(address));
+        }();
+        return std::make_unique<IO::ChannelBox>(std::move(baseSocket));
+      }
+#endif
       auto baseSocket = [&] {
         if(m_interface) {
           return std::make_unique<Network::TcpSocketChannel>(std::move(address),
@@ -9,6 +9,8 @@
 #include <cryptopp/osrng.h>
 #include <cryptopp/sha.h>
 #include "Beam/IO/BufferOutputStream.hpp"
+#include "Beam/IO/BufferSequence.hpp"
+#include "Beam/IO/InlineBuffer.hpp"
 #include "Beam/IO/OpenState.hpp"
 #include "Beam/IO/SharedBuffer.hpp"
 #include "Beam/Pointers/Dereference.hpp"
@@ -139,7 +141,11 @@ namespace Details {
       IO::SharedBuffer m_frameBuffer;
       IO::OpenState m_openState;
 
+      static constexpr auto MAX_FRAME_HEADER_SIZE = std::size_t(10);
+
       void Open();
+      template<typename B>
+      void AppendFrameHeader(std::size_t size, Out<B> frame);
   };
 
   inline WebSocketConfig::WebSocketConfig()
@@ -254,11 +260,49 @@ namespace Details {
 
   template<typename C>
   void WebSocket<C>::Write(const void* data, std::size_t size) {
+    auto frame = typename Channel::Writer::Buffer();
+    AppendFrameHeader(size, Store(frame));
+    if(m_isServerMode) {
+      frame.Append(data, size);
+    } else {
+      auto maskingKey = std::uint32_t(m_randomEngine());
+      frame.Append(&maskingKey, sizeof(maskingKey));
+      auto frameSize = frame.GetSize();
+      frame.Append(data, size);
+      for(auto i = std::size_t(0); i < size; ++i) {
+        auto index = i + frameSize;
+        frame.GetMutableData()[index] = frame.GetMutableData()[index] ^
+          (reinterpret_cast<unsigned char*>(&maskingKey)[
+          i % sizeof(maskingKey)]);
+      }
+    }
+    m_channel->GetWriter().Write(frame);
+  }
+
+  template<typename C>
+  template<typename Buffer>
+  void WebSocket<C>::Write(const Buffer& buffer) {
+    if(!m_isServerMode) {
+      Write(buffer.GetData(), buffer.GetSize());
+      return;
+    }
+
+    /* Unmasked payloads are written after the header without being copied
+       into the frame. */
+    auto header = IO::InlineBuffer<MAX_FRAME_HEADER_SIZE>();
+    AppendFrameHeader(buffer.GetSize(), Store(header));
+    IO::WriteSequence(m_channel->GetWriter(), IO::BufferSequence<
+      const IO::InlineBuffer<MAX_FRAME_HEADER_SIZE>&, const Buffer&>(
+      header, buffer));
+  }
+
+  template<typename C>
+  template<typename B>
+  void WebSocket<C>::AppendFrameHeader(std::size_t size, Out<B> frame) {
     static constexpr auto MAX_PAYLOAD_LENGTH = std::size_t(125);
     static constexpr auto MAX_TWO_BYTE_PAYLOAD_LENGTH = std::size_t(1 << 16);
-    auto frame = typename Channel::Writer::Buffer();
     auto code = std::uint8_t((1 << 7) | 1);
-    frame.Append(&code, sizeof(code));
+    frame->Append(&code, sizeof(code));
     auto payloadLength = [&] {
       if(size <= MAX_PAYLOAD_LENGTH) {
         return static_cast<std::uint8_t>(size);
@@ -271,39 +315,18 @@ namespace Details {
     if(!m_isServerMode) {
       payloadLength |= (1 << 7);
     }
-    frame.Append(&payloadLength, sizeof(payloadLength));
+    frame->Append(&payloadLength, sizeof(payloadLength));
     if(size > MAX_PAYLOAD_LENGTH) {
       if(size <= MAX_TWO_BYTE_PAYLOAD_LENGTH) {
         auto extendedPayloadLength = ToBigEndian(
           static_cast<std::uint16_t>(size));
-        frame.Append(&extendedPayloadLength, sizeof(extendedPayloadLength));
+        frame->Append(&extendedPayloadLength, sizeof(extendedPayloadLength));
       } else {
         auto extendedPayloadLength = ToBigEndian(
           static_cast<std::uint64_t>(size));
-        frame.Append(&extendedPayloadLength, sizeof(extendedPayloadLength));
+        frame->Append(&extendedPayloadLength, sizeof(extendedPayloadLength));
       }
     }
-    if(m_isServerMode) {
-      frame.Append(data, size);
-    } else {
-      auto maskingKey = std::uint32_t(m_randomEngine());
-      frame.Append(&maskingKey, sizeof(maskingKey));
-      auto frameSize = frame.GetSize();
-      frame.Append(data, size);
-      for(auto i = std::size_t(0); i < size; ++i) {
-        auto index = i + frameSize;
-        frame.GetMutableData()[index] = frame.GetMutableData()[index] ^
-          (reinterpret_cast<unsigned char*>(&maskingKey)[
-          i % sizeof(maskingKey)]);
-      }
-    }
-    m_channel->GetWriter().Write(frame);
-  }
-
-  template<typename C>
-  template<typename Buffer>
-  void WebSocket<C>::Write(const Buffer& buffer) {
-    Write(buffer.GetData(), buffer.GetSize());
   }
 
   template<typename C>
@@ -39,7 +39,7 @@ namespace WebServices {
 
   template<typename WebSocketType>
   void WebSocketWriter<WebSocketType>::Write(const Buffer& data) {
-    Write(data.GetData(), data.GetSize());
+    m_socket->Write(data);
   }
 
   template<typename WebSocketType>
@@ -0,0 +1,67 @@
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <doctest/doctest.h>
+#include "Beam/Network/DatagramBatch.hpp"
+#include "Beam/Network/UdpSocket.hpp"
+
+using namespace Beam;
+using namespace Beam::Network;
+
+namespace {
+  UdpSocketOptions MakeOptions() {
+    auto options = UdpSocketOptions();
+    options.m_receiveBufferSize = 4 * 1024 * 1024;
+    return options;
+  }
+
+  double Transfer(unsigned short port, bool isBatched, int rounds,
+      std::size_t batchSize, std::size_t datagramSize) {
+    auto receiver = UdpSocket(IpAddress("127.0.0.1", port + 1),
+      IpAddress("127.0.0.1", port), MakeOptions());
+    auto sender = UdpSocket(IpAddress("127.0.0.1", port),
+      IpAddress("127.0.0.1", port + 1), MakeOptions());
+    auto payload = std::string(datagramSize, 'x');
+    auto outgoing = DatagramBatch(batchSize, datagramSize);
+    for(auto i = std::size_t(0); i != batchSize; ++i) {
+      outgoing.Add(payload.data(), payload.size(), sender.GetAddress());
+    }
+    auto incoming = DatagramBatch(batchSize, datagramSize);
+    auto buffer = std::vector<char>(datagramSize);
+    auto address = IpAddress();
+    auto start = std::chrono::steady_clock::now();
+    for(auto i = 0; i != rounds; ++i) {
+      if(isBatched) {
+        sender.GetSender().Send(outgoing);
+        auto received = std::size_t(0);
+        while(received != batchSize) {
+          received += receiver.GetReceiver().Receive(Store(incoming));
+        }
+      } else {
+        for(auto j = std::size_t(0); j != batchSize; ++j) {
+          sender.GetSender().Send(payload.data(), payload.size(),
+            sender.GetAddress());
+        }
+        for(auto j = std::size_t(0); j != batchSize; ++j) {
+          receiver.GetReceiver().Receive(buffer.data(), buffer.size(),
+            Store(address));
+        }
+      }
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return rounds * batchSize / std::chrono::duration<double>(elapsed).count();
+  }
+}
+
+TEST_SUITE("DatagramBenchmarks") {
+  TEST_CASE("udp_loopback") {
+    const auto ROUNDS = 2000;
+    const auto BATCH_SIZE = 32;
+    const auto DATAGRAM_SIZE = 64;
+    auto single = Transfer(20190, false, ROUNDS, BATCH_SIZE, DATAGRAM_SIZE);
+    auto batched = Transfer(20192, true, ROUNDS, BATCH_SIZE, DATAGRAM_SIZE);
+    std::cout << "UDP loopback " << DATAGRAM_SIZE << " byte datagrams/s: " <<
+      "single " << single << ", batched " << batched << std::endl;
+  }
+}
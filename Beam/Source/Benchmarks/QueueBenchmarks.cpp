@@ -0,0 +1,60 @@
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <doctest/doctest.h>
+#include "Beam/Queues/MpscQueue.hpp"
+#include "Beam/Queues/Queue.hpp"
+#include "Beam/Queues/SpscQueue.hpp"
+
+using namespace Beam;
+
+namespace {
+  template<typename Q>
+  double PushPop(Q& queue, int producerCount, int count) {
+    auto start = std::chrono::steady_clock::now();
+    auto producers = std::vector<std::thread>();
+    for(auto i = 0; i < producerCount; ++i) {
+      producers.emplace_back([&, i] {
+        for(auto j = 0; j < count; ++j) {
+          queue.Push(i * count + j);
+        }
+      });
+    }
+    auto sum = std::int64_t(0);
+    for(auto i = 0; i < producerCount * count; ++i) {
+      sum += queue.Pop();
+    }
+    for(auto& producer : producers) {
+      producer.join();
+    }
+    auto total = std::int64_t(producerCount) * count;
+    REQUIRE(sum == total * (total - 1) / 2);
+    return std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+  }
+}
+
+TEST_SUITE("QueueBenchmarks") {
+  TEST_CASE("mpsc_queue") {
+    const auto COUNT = 250000;
+    const auto PRODUCER_COUNT = 4;
+    auto queue = Queue<int>();
+    auto queueTime = PushPop(queue, PRODUCER_COUNT, COUNT);
+    auto mpscQueue = MpscQueue<int>();
+    auto mpscTime = PushPop(mpscQueue, PRODUCER_COUNT, COUNT);
+    std::cout << PRODUCER_COUNT << " producer throughput (values/s): Queue " <<
+      PRODUCER_COUNT * COUNT / queueTime << ", MpscQueue " <<
+      PRODUCER_COUNT * COUNT / mpscTime << std::endl;
+  }
+
+  TEST_CASE("spsc_queue") {
+    const auto COUNT = 1000000;
+    auto queue = Queue<int>();
+    auto queueTime = PushPop(queue, 1, COUNT);
+    auto spscQueue = SpscQueue<int>();
+    auto spscTime = PushPop(spscQueue, 1, COUNT);
+    std::cout << "1 producer throughput (values/s): Queue " <<
+      COUNT / queueTime << ", SpscQueue " << COUNT / spscTime << std::endl;
+  }
+}
@@ -0,0 +1,127 @@
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <doctest/doctest.h>
+#include "Beam/IO/SharedBuffer.hpp"
+#include "Beam/Queries/IndexedValue.hpp"
+#include "Beam/Queries/QueryResult.hpp"
+#include "Beam/Queries/SequencedValue.hpp"
+#include "Beam/Serialization/BinaryReceiver.hpp"
+#include "Beam/Serialization/BinarySender.hpp"
+#include "Beam/Serialization/CompactBinaryReceiver.hpp"
+#include "Beam/Serialization/CompactBinarySender.hpp"
+#include "Beam/Serialization/ShuttleVector.hpp"
+
+using namespace Beam;
+using namespace Beam::IO;
+using namespace Beam::Queries;
+using namespace Beam::Serialization;
+
+namespace {
+  struct Point {
+    std::int32_t m_x;
+    std::int32_t m_y;
+
+    template<typename Shuttler>
+    void Shuttle(Shuttler& shuttle, unsigned int version) {
+      shuttle.Shuttle("x", m_x);
+      shuttle.Shuttle("y", m_y);
+    }
+  };
+
+  struct UnsharedPoint {
+    std::int32_t m_x;
+    std::int32_t m_y;
+
+    template<typename Shuttler>
+    void Shuttle(Shuttler& shuttle, unsigned int version) {
+      shuttle.Shuttle("x", m_x);
+      shuttle.Shuttle("y", m_y);
+    }
+  };
+
+  template<typename T>
+  using Snapshot = QueryResult<SequencedValue<IndexedValue<std::int64_t, T>>>;
+
+  template<typename T>
+  Snapshot<T> MakeSnapshot(int size, const T& index) {
+    auto snapshot = Snapshot<T>();
+    snapshot.m_queryId = 12;
+    for(auto i = 0; i != size; ++i) {
+      snapshot.m_snapshot.push_back(SequencedValue(IndexedValue(
+        std::int64_t(100 * i), index),
+        Sequence(static_cast<Sequence::Ordinal>(i + 1))));
+    }
+    return snapshot;
+  }
+
+  template<typename S, typename T>
+  void Measure(const std::string& name, const T& value, int count) {
+    auto sender = S();
+    auto receiver = GetInverse<S>();
+    auto buffer = SharedBuffer();
+    auto start = std::chrono::steady_clock::now();
+    for(auto i = 0; i != count; ++i) {
+      buffer.Reset();
+      sender.SetSink(Ref(buffer));
+      sender.Shuttle(value);
+    }
+    auto sendTime = std::chrono::steady_clock::now() - start;
+    start = std::chrono::steady_clock::now();
+    for(auto i = 0; i != count; ++i) {
+      auto received = T();
+      receiver.SetSource(Ref(buffer));
+      receiver.Shuttle(received);
+    }
+    auto receiveTime = std::chrono::steady_clock::now() - start;
+    auto toNanoseconds = [&] (auto duration) {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        duration).count() / count;
+    };
+    std::cout << name << ": " << buffer.GetSize() << " bytes, send " <<
+      toNanoseconds(sendTime) << "ns, receive " <<
+      toNanoseconds(receiveTime) << "ns" << std::endl;
+  }
+}
+
+namespace Beam::Serialization {
+  template<>
+  struct IsBitwiseShuttleable<Point> : std::true_type {};
+}
+
+TEST_SUITE("SerializationBenchmarks") {
+  TEST_CASE("bitwise_shuttle") {
+    const auto SIZE = 100000;
+    auto points = std::vector<Point>();
+    auto unsharedPoints = std::vector<UnsharedPoint>();
+    for(auto i = 0; i != SIZE; ++i) {
+      points.push_back({i, -i});
+      unsharedPoints.push_back({i, -i});
+    }
+    Measure<BinarySender<SharedBuffer>>("Point vector elementwise",
+      unsharedPoints, 100);
+    Measure<BinarySender<SharedBuffer>>("Point vector block", points, 100);
+  }
+
+  TEST_CASE("compact_binary") {
+    auto snapshot = MakeSnapshot(1000, std::string("MSFT.NSDQ"));
+    Measure<BinarySender<SharedBuffer>>("QueryResult snapshot binary",
+      snapshot, 1000);
+    Measure<CompactBinarySender<SharedBuffer>>("QueryResult snapshot compact",
+      snapshot, 1000);
+  }
+
+  TEST_CASE("serialized_size") {
+    for(auto size : {1000, 100000}) {
+      auto count = 10000000 / size;
+      Measure<BinarySender<SharedBuffer>>(std::to_string(size) +
+        " entry snapshot of strings",
+        MakeSnapshot(size, std::string("MSFT.NSDQ")), count);
+      Measure<BinarySender<SharedBuffer>>(std::to_string(size) +
+        " entry snapshot of integers", MakeSnapshot(size, std::int32_t(5)),
+        count);
+    }
+  }
+}
@@ -0,0 +1,32 @@
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <doctest/doctest.h>
+#include "Beam/IO/SharedBuffer.hpp"
+
+using namespace Beam;
+using namespace Beam::IO;
+
+TEST_SUITE("SharedBufferBenchmarks") {
+  TEST_CASE("allocation") {
+    const auto COUNT = 1000000;
+    const auto SIZE = std::size_t(256);
+    auto start = std::chrono::steady_clock::now();
+    for(auto i = 0; i != COUNT; ++i) {
+      auto buffer = std::shared_ptr<char[]>(new char[SIZE]);
+      buffer[0] = static_cast<char>(i);
+    }
+    auto allocatorTime = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+    start = std::chrono::steady_clock::now();
+    for(auto i = 0; i != COUNT; ++i) {
+      auto buffer = SharedBuffer(SIZE);
+      buffer.GetMutableData()[0] = static_cast<char>(i);
+    }
+    auto bufferTime = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+    std::cout << SIZE << " byte allocation throughput (buffers/s): "
+      "shared_ptr " << COUNT / allocatorTime << ", SharedBuffer " <<
+      COUNT / bufferTime << std::endl;
+  }
+}
@@ -0,0 +1,38 @@
+#include <chrono>
+#include <iostream>
+#include <doctest/doctest.h>
+#include "Beam/Routines/RoutineHandlerGroup.hpp"
+#include "Beam/Routines/StackPool.hpp"
+
+using namespace Beam;
+using namespace Beam::Routines;
+
+namespace {
+  double SpawnRoutines(int count) {
+    auto start = std::chrono::steady_clock::now();
+    auto routines = RoutineHandlerGroup();
+    for(auto i = 0; i < count; ++i) {
+      routines.Spawn([] {});
+    }
+    routines.Wait();
+    return std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+  }
+}
+
+TEST_SUITE("StackPoolBenchmarks") {
+  TEST_CASE("spawn_throughput") {
+    const auto ROUTINE_COUNT = 10000;
+    auto& pool = StackPool::GetInstance();
+    auto limit = pool.GetCacheLimit();
+    SpawnRoutines(ROUTINE_COUNT);
+    pool.SetCacheLimit(0);
+    auto unpooledTime = SpawnRoutines(ROUTINE_COUNT);
+    pool.SetCacheLimit(limit);
+    SpawnRoutines(ROUTINE_COUNT);
+    auto pooledTime = SpawnRoutines(ROUTINE_COUNT);
+    std::cout << "Spawn/complete throughput (routines/s): unpooled " <<
+      ROUTINE_COUNT / unpooledTime << ", pooled " <<
+      ROUTINE_COUNT / pooledTime << std::endl;
+  }
+}
@@ -0,0 +1,72 @@
+#ifdef __linux__
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <doctest/doctest.h>
+#include "Beam/IO/SharedBuffer.hpp"
+#include "Beam/Network/TcpServerSocket.hpp"
+#include "Beam/Network/TcpSocketChannel.hpp"
+#include "Beam/Network/UringServerSocket.hpp"
+#include "Beam/Network/UringSocketChannel.hpp"
+#include "Beam/Routines/RoutineHandler.hpp"
+
+using namespace Beam;
+using namespace Beam::IO;
+using namespace Beam::Network;
+using namespace Beam::Routines;
+
+namespace {
+  template<typename ServerSocket, typename Channel>
+  double PingPong(unsigned short port, int roundTrips,
+      std::size_t messageSize) {
+    auto options = TcpSocketOptions();
+    options.m_noDelayEnabled = true;
+    auto server = ServerSocket(IpAddress("127.0.0.1", port), options);
+    auto serverTask = RoutineHandler(Spawn([&] {
+      auto channel = server.Accept();
+      auto buffer = SharedBuffer();
+      try {
+        while(true) {
+          buffer.Reset();
+          channel->GetReader().Read(Store(buffer));
+          channel->GetWriter().Write(buffer);
+        }
+      } catch(const EndOfFileException&) {}
+    }));
+    auto client = Channel(IpAddress("127.0.0.1", port), options);
+    auto message = SharedBuffer(std::string(messageSize, 'x').c_str(),
+      messageSize);
+    auto buffer = SharedBuffer();
+    auto start = std::chrono::steady_clock::now();
+    for(auto i = 0; i != roundTrips; ++i) {
+      client.GetWriter().Write(message);
+      auto received = std::size_t(0);
+      while(received != messageSize) {
+        buffer.Reset();
+        received += client.GetReader().Read(Store(buffer));
+      }
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    client.GetConnection().Close();
+    serverTask.Wait();
+    return roundTrips / std::chrono::duration<double>(elapsed).count();
+  }
+}
+
+TEST_SUITE("UringSocketChannelBenchmarks") {
+  TEST_CASE("ping_pong") {
+    if(!IoUringService::IsAvailable()) {
+      return;
+    }
+    auto roundTrips = 20000;
+    for(auto size : {std::size_t(64), std::size_t(4096)}) {
+      auto tcp = PingPong<TcpServerSocket, TcpSocketChannel>(20174, roundTrips,
+        size);
+      auto uring = PingPong<UringServerSocket, UringSocketChannel>(20175,
+        roundTrips, size);
+      std::cout << "ping pong " << size << " bytes: asio " << tcp <<
+        " round trips/s, io_uring " << uring << " round trips/s" << std::endl;
+    }
+  }
+}
+#endif
@@ -0,0 +1,135 @@
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include <boost/thread/mutex.hpp>
+#include <doctest/doctest.h>
+#include "Beam/IO/AsyncWriter.hpp"
+#include "Beam/IO/EndOfFileException.hpp"
+
+using namespace Beam;
+using namespace Beam::IO;
+
+namespace {
+  struct RecordingWriter {
+    using Buffer = SharedBuffer;
+    boost::mutex m_gate;
+    std::atomic_int m_writeCount;
+    bool m_isFailing;
+    std::vector<std::string> m_writes;
+
+    RecordingWriter()
+      : m_writeCount(0),
+        m_isFailing(false) {}
+
+    void Write(const void* data, std::size_t size) {
+      ++m_writeCount;
+      auto lock = boost::lock_guard(m_gate);
+      if(m_isFailing) {
+        BOOST_THROW_EXCEPTION(EndOfFileException());
+      }
+      m_writes.emplace_back(static_cast<const char*>(data), size);
+    }
+
+    void Write(const Buffer& data) {
+      Write(data.GetData(), data.GetSize());
+    }
+
+    void WaitForWrite() {
+      while(m_writeCount == 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+    }
+  };
+}
+
+TEST_SUITE("AsyncWriter") {
+  TEST_CASE("coalesce") {
+    auto destination = RecordingWriter();
+    {
+      auto writer = AsyncWriter(&destination);
+      auto lock = boost::unique_lock(destination.m_gate);
+      writer.Write("a", 1);
+
+      /* Buffers written while the first write is blocked must be combined
+         into a single write once it completes. */
+      destination.WaitForWrite();
+      writer.Write("b", 1);
+      writer.Write("c", 1);
+      writer.Write("d", 1);
+      lock.unlock();
+    }
+    REQUIRE(destination.m_writes == std::vector<std::string>{"a", "bcd"});
+  }
+
+  TEST_CASE("failed_write") {
+    auto destination = RecordingWriter();
+    destination.m_isFailing = true;
+    auto writer = AsyncWriter(&destination);
+    auto lock = boost::unique_lock(destination.m_gate);
+    writer.Write("a", 1);
+    destination.WaitForWrite();
+    auto buffer = BufferFromString<SharedBuffer>("b");
+    auto data = buffer.GetData();
+    writer.Write(buffer);
+    lock.unlock();
+    auto isBroken = false;
+    for(auto i = 0; i < 1000 && !isBroken; ++i) {
+      try {
+        writer.Write("c", 1);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      } catch(const EndOfFileException&) {
+        isBroken = true;
+      }
+    }
+    REQUIRE(isBroken);
+    REQUIRE_THROWS_AS(writer.Write("d", 1), EndOfFileException);
+    REQUIRE(destination.m_writes.empty());
+
+    /* The buffer is only modified in place if the writer no longer holds a
+       reference to it. */
+    REQUIRE(buffer.GetMutableData() == data);
+  }
+
+  TEST_CASE("coalesce_size") {
+    auto destination = RecordingWriter();
+    {
+      auto writer = AsyncWriter(&destination, 2,
+        boost::posix_time::seconds(0));
+      auto lock = boost::unique_lock(destination.m_gate);
+      writer.Write("a", 1);
+      writer.Write("b", 1);
+      writer.Write("c", 1);
+      writer.Write("def", 3);
+      lock.unlock();
+    }
+    auto written = std::string();
+    for(auto& write : destination.m_writes) {
+      REQUIRE((write.size() <= 2 || write == "def"));
+      written += write;
+    }
+    REQUIRE(written == "abcdef");
+  }
+
+  TEST_CASE("cork_window") {
+    auto destination = RecordingWriter();
+    auto elapsed = std::chrono::steady_clock::duration();
+    auto earlyWriteCount = 0;
+    {
+      auto writer = AsyncWriter(&destination, 1024,
+        boost::posix_time::milliseconds(200));
+      auto start = std::chrono::steady_clock::now();
+      writer.Write("a", 1);
+      writer.Write("b", 1);
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+      writer.Write("c", 1);
+      earlyWriteCount = destination.m_writeCount;
+      destination.WaitForWrite();
+      elapsed = std::chrono::steady_clock::now() - start;
+    }
+    REQUIRE(earlyWriteCount == 0);
+    REQUIRE(elapsed >= std::chrono::milliseconds(200));
+    REQUIRE(destination.m_writes == std::vector<std::string>{"abc"});
+  }
+}
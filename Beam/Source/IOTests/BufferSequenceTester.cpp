@@ -0,0 +1,60 @@
+#include <string>
+#include <vector>
+#include <doctest/doctest.h>
+#include "Beam/IO/BufferSequence.hpp"
+#include "Beam/IO/PipedReader.hpp"
+#include "Beam/IO/PipedWriter.hpp"
+#include "Beam/IO/SharedBuffer.hpp"
+
+using namespace Beam;
+using namespace Beam::IO;
+
+namespace {
+  struct GatherWriter {
+    using Buffer = SharedBuffer;
+    std::vector<std::string> m_writes;
+
+    template<typename... B>
+    void Write(const BufferSequence<B...>& buffers) {
+      buffers.ForEach([&] (const auto& buffer) {
+        m_writes.emplace_back(buffer.GetData(), buffer.GetSize());
+      });
+    }
+  };
+}
+
+namespace Beam::IO {
+  template<>
+  struct IsGatherWriter<GatherWriter> : std::true_type {};
+}
+
+TEST_SUITE("BufferSequence") {
+  TEST_CASE("size") {
+    auto header = BufferFromString<SharedBuffer>("head");
+    auto body = BufferFromString<SharedBuffer>("body!");
+    auto buffers = BufferSequence<const SharedBuffer&, SharedBuffer>(
+      header, body);
+    REQUIRE(buffers.GetSize() == 9);
+  }
+
+  TEST_CASE("gathered_write") {
+    auto header = BufferFromString<SharedBuffer>("head");
+    auto body = BufferFromString<SharedBuffer>("body");
+    auto writer = GatherWriter();
+    WriteSequence(writer,
+      BufferSequence<const SharedBuffer&, const SharedBuffer&>(header, body));
+    REQUIRE(writer.m_writes == std::vector<std::string>{"head", "body"});
+  }
+
+  TEST_CASE("copied_write") {
+    auto reader = PipedReader<SharedBuffer>();
+    auto writer = PipedWriter<SharedBuffer>(Ref(reader));
+    auto header = BufferFromString<SharedBuffer>("head");
+    auto body = BufferFromString<SharedBuffer>("body");
+    WriteSequence(writer,
+      BufferSequence<const SharedBuffer&, const SharedBuffer&>(header, body));
+    auto buffer = SharedBuffer();
+    reader.Read(Store(buffer));
+    REQUIRE(buffer == "headbody");
+  }
+}
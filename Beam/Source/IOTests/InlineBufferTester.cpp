@@ -0,0 +1,67 @@
+#include <cstring>
+#include <string>
+#include <doctest/doctest.h>
+#include "Beam/IO/InlineBuffer.hpp"
+#include "Beam/IO/SharedBuffer.hpp"
+#include "Beam/Serialization/BinaryReceiver.hpp"
+#include "Beam/Serialization/BinarySender.hpp"
+
+using namespace Beam;
+using namespace Beam::IO;
+using namespace Beam::Serialization;
+
+TEST_SUITE("InlineBuffer") {
+  TEST_CASE("append_inline") {
+    auto buffer = InlineBuffer<16>();
+    buffer.Append("hello", 5);
+    buffer.Append(" world", 6);
+    REQUIRE(buffer.IsInline());
+    REQUIRE(buffer.GetSize() == 11);
+    REQUIRE(std::strncmp(buffer.GetData(), "hello world", 11) == 0);
+  }
+
+  TEST_CASE("spill") {
+    auto buffer = InlineBuffer<4>();
+    buffer.Append("abc", 3);
+    REQUIRE(buffer.IsInline());
+    buffer.Append("defgh", 5);
+    REQUIRE(!buffer.IsInline());
+    REQUIRE(buffer.GetSize() == 8);
+    REQUIRE(std::strncmp(buffer.GetData(), "abcdefgh", 8) == 0);
+  }
+
+  TEST_CASE("copy_and_move") {
+    auto inlineBuffer = InlineBuffer<4>("ab", 2);
+    auto heapBuffer = InlineBuffer<4>("abcdefgh", 8);
+    auto inlineCopy = inlineBuffer;
+    REQUIRE(inlineCopy.GetData() != inlineBuffer.GetData());
+    REQUIRE(inlineCopy == "ab");
+    auto heapData = heapBuffer.GetData();
+    auto moved = std::move(heapBuffer);
+    REQUIRE(moved.GetData() == heapData);
+    REQUIRE(moved == "abcdefgh");
+    REQUIRE(heapBuffer.IsEmpty());
+    REQUIRE(heapBuffer.IsInline());
+    auto shared = SharedBuffer(moved);
+    REQUIRE(shared == "abcdefgh");
+  }
+
+  TEST_CASE("shrink_front") {
+    auto buffer = InlineBuffer<8>("abcdef", 6);
+    buffer.ShrinkFront(2);
+    REQUIRE(buffer == "cdef");
+  }
+
+  TEST_CASE("sender_sink") {
+    auto buffer = InlineBuffer<64>();
+    auto sender = BinarySender<InlineBuffer<64>>();
+    sender.SetSink(Ref(buffer));
+    sender.Send(std::string("hello"));
+    REQUIRE(buffer.IsInline());
+    auto receiver = BinaryReceiver<InlineBuffer<64>>();
+    receiver.SetSource(Ref(buffer));
+    auto value = std::string();
+    receiver.Shuttle(value);
+    REQUIRE(value == "hello");
+  }
+}
@@ -110,4 +110,37 @@ TEST_SUITE("SharedBuffer") {
     copy.Append("b", 1);
     REQUIRE(buffer.GetData() != copy.GetData());
   }
+
+  TEST_CASE("pooled_reuse") {
+    auto initialStatistics = GetBufferPoolStatistics();
+    {
+      auto buffer = SharedBuffer();
+      buffer.Append("hello", 5);
+    }
+    {
+      auto buffer = SharedBuffer();
+      buffer.Append("world", 5);
+      REQUIRE(std::strncmp(buffer.GetData(), "world", 5) == 0);
+    }
+    auto statistics = GetBufferPoolStatistics();
+    REQUIRE(statistics.m_allocationCount -
+      initialStatistics.m_allocationCount == 2);
+    REQUIRE(statistics.m_releaseCount - initialStatistics.m_releaseCount == 2);
+    if(BEAM_SHARED_BUFFER_POOLING) {
+      REQUIRE(statistics.m_reuseCount - initialStatistics.m_reuseCount >= 1);
+    }
+  }
+
+  TEST_CASE("shared_release") {
+    auto initialStatistics = GetBufferPoolStatistics();
+    {
+      auto buffer = SharedBuffer();
+      buffer.Append("a", 1);
+      auto copy = buffer;
+      auto moved = std::move(buffer);
+      REQUIRE(moved.GetData() == copy.GetData());
+    }
+    auto statistics = GetBufferPoolStatistics();
+    REQUIRE(statistics.m_releaseCount - initialStatistics.m_releaseCount == 1);
+  }
 }
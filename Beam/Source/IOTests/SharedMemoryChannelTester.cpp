@@ -0,0 +1,164 @@
+#ifdef __linux__
+#include <cstring>
+#include <string>
+#include <thread>
+#include <doctest/doctest.h>
+#include <sys/wait.h>
+#include "Beam/IO/SharedBuffer.hpp"
+#include "Beam/IO/SharedMemoryServerConnection.hpp"
+#include "Beam/Routines/RoutineHandler.hpp"
+
+using namespace Beam;
+using namespace Beam::IO;
+using namespace Beam::Routines;
+
+namespace {
+
+  /* Runs a function in a child process that exits without any cleanup, the
+     child only touches shared memory since other threads' locks are not
+     carried across the fork. */
+  template<typename F>
+  void RunChild(const F& f) {
+    auto pid = ::fork();
+    REQUIRE(pid != -1);
+    if(pid == 0) {
+      f();
+      ::_exit(0);
+    }
+    auto status = 0;
+    ::waitpid(pid, &status, 0);
+  }
+}
+
+TEST_SUITE("SharedMemoryChannel") {
+  TEST_CASE("close_then_accept") {
+    auto server = SharedMemoryServerConnection("beam_shm_test_close");
+    server.Close();
+    REQUIRE_THROWS_AS(server.Accept(), EndOfFileException);
+    REQUIRE_THROWS_AS(SharedMemoryChannel("beam_shm_test_close"),
+      ConnectException);
+  }
+
+  TEST_CASE("read_write") {
+    auto server = SharedMemoryServerConnection("beam_shm_test_echo");
+    auto serverTask = RoutineHandler(Spawn([&] {
+      auto channel = server.Accept();
+      auto buffer = SharedBuffer();
+      while(buffer.GetSize() != 5) {
+        channel->GetReader().Read(Store(buffer));
+      }
+      REQUIRE(std::string(buffer.GetData(), buffer.GetSize()) == "hello");
+      channel->GetWriter().Write(BufferFromString<SharedBuffer>("world"));
+      channel->GetConnection().Close();
+    }));
+    auto client = SharedMemoryChannel("beam_shm_test_echo");
+    client.GetWriter().Write(BufferFromString<SharedBuffer>("hello"));
+    auto buffer = SharedBuffer();
+    while(buffer.GetSize() != 5) {
+      client.GetReader().Read(Store(buffer));
+    }
+    REQUIRE(std::string(buffer.GetData(), buffer.GetSize()) == "world");
+    serverTask.Wait();
+    REQUIRE_THROWS_AS(client.GetReader().Read(Store(buffer)),
+      EndOfFileException);
+    REQUIRE_THROWS_AS(client.GetWriter().Write(buffer), EndOfFileException);
+  }
+
+  TEST_CASE("write_larger_than_ring") {
+    const auto SIZE = 3 * std::size_t(BEAM_SHARED_MEMORY_RING_SIZE) + 17;
+    auto server = SharedMemoryServerConnection("beam_shm_test_large");
+    auto message = std::string(SIZE, '\0');
+    for(auto i = std::size_t(0); i != SIZE; ++i) {
+      message[i] = static_cast<char>(i % 251);
+    }
+    auto serverTask = RoutineHandler(Spawn([&] {
+      auto channel = server.Accept();
+      channel->GetWriter().Write(message.data(), message.size());
+    }));
+    auto client = SharedMemoryChannel("beam_shm_test_large");
+    auto buffer = SharedBuffer();
+    while(buffer.GetSize() != SIZE) {
+      client.GetReader().Read(Store(buffer));
+    }
+    REQUIRE(std::string(buffer.GetData(), buffer.GetSize()) == message);
+    serverTask.Wait();
+  }
+
+  TEST_CASE("client_exits") {
+    auto server = SharedMemoryServerConnection("beam_shm_test_client_exit");
+    auto segmentName = std::string("/beam_shm_test_client_exit.child");
+    auto size = IO::Details::SharedMemorySegment::GetSize(
+      BEAM_SHARED_MEMORY_RING_SIZE);
+    auto isEndOfFile = false;
+    auto serverTask = RoutineHandler(Spawn([&] {
+      auto channel = server.Accept();
+      auto buffer = SharedBuffer();
+      try {
+        channel->GetReader().Read(Store(buffer));
+      } catch(const EndOfFileException&) {
+        isEndOfFile = true;
+      }
+    }));
+    RunChild([&] {
+      ::shm_unlink(segmentName.c_str());
+      auto segment = new(IO::Details::MapSharedMemory(segmentName, size, true))
+        IO::Details::SharedMemorySegment();
+      segment->m_capacity = BEAM_SHARED_MEMORY_RING_SIZE;
+      segment->m_clientPid.store(::getpid());
+      auto listener = static_cast<IO::Details::SharedMemoryListener*>(
+        IO::Details::MapSharedMemory("/beam_shm_test_client_exit",
+        sizeof(IO::Details::SharedMemoryListener), false));
+      listener->Lock();
+      auto tail = listener->m_tail.load();
+      std::strcpy(listener->m_names[tail % BEAM_SHARED_MEMORY_BACKLOG],
+        segmentName.c_str());
+      listener->m_tail.store(tail + 1);
+      listener->Unlock();
+      listener->m_event.Notify();
+      while(segment->m_state.load() ==
+          IO::Details::SharedMemorySegment::PENDING) {
+        std::this_thread::yield();
+      }
+    });
+    serverTask.Wait();
+    ::shm_unlink(segmentName.c_str());
+    REQUIRE(isEndOfFile);
+  }
+
+  TEST_CASE("lock_holder_exits") {
+    auto server = SharedMemoryServerConnection("beam_shm_test_lock_exit");
+    RunChild([&] {
+      auto listener = static_cast<IO::Details::SharedMemoryListener*>(
+        IO::Details::MapSharedMemory("/beam_shm_test_lock_exit",
+        sizeof(IO::Details::SharedMemoryListener), false));
+      listener->Lock();
+    });
+    auto serverTask = RoutineHandler(Spawn([&] {
+      auto channel = server.Accept();
+      channel->GetWriter().Write(BufferFromString<SharedBuffer>("ok"));
+    }));
+    auto client = SharedMemoryChannel("beam_shm_test_lock_exit");
+    auto buffer = SharedBuffer();
+    while(buffer.GetSize() != 2) {
+      client.GetReader().Read(Store(buffer));
+    }
+    REQUIRE(std::string(buffer.GetData(), buffer.GetSize()) == "ok");
+    serverTask.Wait();
+  }
+
+  TEST_CASE("server_exits") {
+    auto name = std::string("/beam_shm_test_server_exit");
+    RunChild([&] {
+      ::shm_unlink(name.c_str());
+      auto listener = new(IO::Details::MapSharedMemory(name,
+        sizeof(IO::Details::SharedMemoryListener), true))
+        IO::Details::SharedMemoryListener();
+      listener->m_pid.store(::getpid());
+      listener->m_isOpen.store(1);
+    });
+    REQUIRE_THROWS_AS(SharedMemoryChannel("beam_shm_test_server_exit"),
+      ConnectException);
+    ::shm_unlink(name.c_str());
+  }
+}
+#endif
@@ -0,0 +1,98 @@
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <doctest/doctest.h>
+#include "Beam/IO/SharedBuffer.hpp"
+#include "Beam/Network/DatagramBatch.hpp"
+#include "Beam/Network/UdpSocket.hpp"
+
+using namespace Beam;
+using namespace Beam::IO;
+using namespace Beam::Network;
+
+namespace {
+  UdpSocketOptions MakeOptions() {
+    auto options = UdpSocketOptions();
+    options.m_receiveBufferSize = 4 * 1024 * 1024;
+    return options;
+  }
+}
+
+TEST_SUITE("DatagramBatch") {
+  TEST_CASE("add_and_reset") {
+    auto batch = DatagramBatch(2, 16);
+    REQUIRE(batch.IsEmpty());
+    batch.Add("hello", 5, IpAddress("127.0.0.1", 20180));
+    batch.Add("world!", 6, IpAddress("127.0.0.1", 20181));
+    REQUIRE(batch.IsFull());
+    REQUIRE(std::string(batch.GetData(1), batch.GetDatagramSize(1)) ==
+      "world!");
+    REQUIRE(batch.GetAddress(0) == IpAddress("127.0.0.1", 20180));
+    batch.Reset();
+    REQUIRE(batch.IsEmpty());
+    REQUIRE(batch.GetCapacity() == 2);
+  }
+
+  TEST_CASE("send_and_receive") {
+    auto receiver = UdpSocket(IpAddress("127.0.0.1", 20183),
+      IpAddress("127.0.0.1", 20182), MakeOptions());
+    auto sender = UdpSocket(IpAddress("127.0.0.1", 20182),
+      IpAddress("127.0.0.1", 20183), MakeOptions());
+    auto outgoing = DatagramBatch(8, 64);
+    for(auto i = 0; i != 8; ++i) {
+      auto message = std::to_string(i);
+      outgoing.Add(message.data(), message.size(), sender.GetAddress());
+    }
+    sender.GetSender().Send(outgoing);
+    auto packets = std::vector<DatagramPacket<SharedBuffer>>();
+    while(packets.size() != 8) {
+      receiver.GetReceiver().Receive(Store(packets), 8 - packets.size());
+    }
+    for(auto i = 0; i != 8; ++i) {
+      REQUIRE(std::string(packets[i].GetData().GetData(),
+        packets[i].GetData().GetSize()) == std::to_string(i));
+      REQUIRE(packets[i].GetAddress() == IpAddress("127.0.0.1", 20183));
+    }
+    receiver.Close();
+    auto incoming = DatagramBatch(8, 64);
+    REQUIRE_THROWS_AS(receiver.GetReceiver().Receive(Store(incoming)),
+      EndOfFileException);
+  }
+
+  TEST_CASE("add_out_of_bounds") {
+    auto batch = DatagramBatch(1, 4);
+    auto data = std::string(5, 'x');
+    REQUIRE_THROWS_AS(batch.Add(data.data(), data.size(),
+      IpAddress("127.0.0.1", 20180)), std::length_error);
+    REQUIRE(batch.IsEmpty());
+    batch.Add(data.data(), 4, IpAddress("127.0.0.1", 20180));
+    REQUIRE_THROWS_AS(batch.Add(data.data(), 1,
+      IpAddress("127.0.0.1", 20180)), std::length_error);
+    REQUIRE(batch.GetSize() == 1);
+  }
+
+  TEST_CASE("send_oversized_packet") {
+    auto receiver = UdpSocket(IpAddress("127.0.0.1", 20185),
+      IpAddress("127.0.0.1", 20184), MakeOptions());
+    auto senderOptions = MakeOptions();
+    senderOptions.m_maxDatagramSize = 16;
+    auto sender = UdpSocket(IpAddress("127.0.0.1", 20184),
+      IpAddress("127.0.0.1", 20185), senderOptions);
+    auto messages = std::vector<std::string>{"a", std::string(100, 'b'), "c"};
+    auto outgoing = std::vector<DatagramPacket<SharedBuffer>>();
+    for(auto& message : messages) {
+      outgoing.emplace_back(BufferFromString<SharedBuffer>(message),
+        sender.GetAddress());
+    }
+    sender.GetSender().Send(outgoing);
+    auto packets = std::vector<DatagramPacket<SharedBuffer>>();
+    while(packets.size() != messages.size()) {
+      receiver.GetReceiver().Receive(Store(packets),
+        messages.size() - packets.size());
+    }
+    for(auto i = std::size_t(0); i != messages.size(); ++i) {
+      REQUIRE(std::string(packets[i].GetData().GetData(),
+        packets[i].GetData().GetSize()) == messages[i]);
+    }
+  }
+}
@@ -0,0 +1,129 @@
+#include <memory>
+#include <string>
+#include <doctest/doctest.h>
+#include <openssl/ec.h>
+#include <openssl/evp.h>
+#include <openssl/pem.h>
+#include <openssl/x509.h>
+#include "Beam/IO/BufferSequence.hpp"
+#include "Beam/IO/SharedBuffer.hpp"
+#include "Beam/Network/SecureServerSocket.hpp"
+#include "Beam/Network/SecureSocketChannel.hpp"
+#include "Beam/Routines/RoutineHandler.hpp"
+
+using namespace Beam;
+using namespace Beam::IO;
+using namespace Beam::Network;
+using namespace Beam::Routines;
+
+namespace {
+  std::string ToPem(BIO* bio) {
+    auto data = static_cast<char*>(nullptr);
+    auto size = BIO_get_mem_data(bio, &data);
+    auto pem = std::string(data, size);
+    BIO_free(bio);
+    return pem;
+  }
+
+  std::shared_ptr<boost::asio::ssl::context> MakeServerContext() {
+    auto keyContext = EVP_PKEY_CTX_new_id(EVP_PKEY_EC, nullptr);
+    EVP_PKEY_keygen_init(keyContext);
+    EVP_PKEY_CTX_set_ec_paramgen_curve_nid(keyContext,
+      NID_X9_62_prime256v1);
+    auto key = static_cast<EVP_PKEY*>(nullptr);
+    EVP_PKEY_keygen(keyContext, &key);
+    EVP_PKEY_CTX_free(keyContext);
+    auto certificate = X509_new();
+    X509_set_version(certificate, 2);
+    ASN1_INTEGER_set(X509_get_serialNumber(certificate), 1);
+    X509_gmtime_adj(X509_getm_notBefore(certificate), 0);
+    X509_gmtime_adj(X509_getm_notAfter(certificate), 24 * 60 * 60);
+    X509_set_pubkey(certificate, key);
+    auto name = X509_get_subject_name(certificate);
+    X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC,
+      reinterpret_cast<const unsigned char*>("localhost"), -1, -1, 0);
+    X509_set_issuer_name(certificate, name);
+    X509_sign(certificate, key, EVP_sha256());
+    auto certificateBio = BIO_new(BIO_s_mem());
+    PEM_write_bio_X509(certificateBio, certificate);
+    auto keyBio = BIO_new(BIO_s_mem());
+    PEM_write_bio_PrivateKey(keyBio, key, nullptr, nullptr, 0, nullptr,
+      nullptr);
+    auto context = SecureContextFactory::GetInstance().MakeServerContext(
+      ToPem(certificateBio), ToPem(keyBio));
+    X509_free(certificate);
+    EVP_PKEY_free(key);
+    return context;
+  }
+
+  void Echo(SecureServerSocket& server, int connections) {
+    for(auto i = 0; i != connections; ++i) {
+      auto channel = server.Accept();
+      auto buffer = SharedBuffer();
+      try {
+        while(true) {
+          buffer.Reset();
+          channel->GetReader().Read(Store(buffer));
+          channel->GetWriter().Write(buffer);
+        }
+      } catch(const EndOfFileException&) {}
+    }
+  }
+
+  void Ping(const IpAddress& address) {
+    auto client = SecureSocketChannel(address);
+    client.GetWriter().Write(BufferFromString<SharedBuffer>("ping"));
+    auto buffer = SharedBuffer();
+    while(buffer.GetSize() != 4) {
+      client.GetReader().Read(Store(buffer));
+    }
+    REQUIRE(std::string(buffer.GetData(), buffer.GetSize()) == "ping");
+  }
+}
+
+TEST_SUITE("SecureSocketChannel") {
+  TEST_CASE("session_resumption") {
+    auto& factory = SecureContextFactory::GetInstance();
+    auto address = IpAddress("127.0.0.1", 20191);
+    auto server = SecureServerSocket(address, MakeServerContext());
+    auto serverTask = RoutineHandler(Spawn([&] {
+      Echo(server, 2);
+    }));
+    auto clientFull = factory.GetClientCounters().GetFullHandshakeCount();
+    auto clientResumed =
+      factory.GetClientCounters().GetResumedHandshakeCount();
+    auto serverResumed =
+      factory.GetServerCounters().GetResumedHandshakeCount();
+    Ping(address);
+    REQUIRE(factory.GetClientCounters().GetFullHandshakeCount() ==
+      clientFull + 1);
+    REQUIRE(factory.GetSessionCache().GetSize() >= 1);
+    Ping(address);
+    REQUIRE(factory.GetClientCounters().GetResumedHandshakeCount() ==
+      clientResumed + 1);
+    serverTask.Wait();
+    REQUIRE(factory.GetServerCounters().GetResumedHandshakeCount() ==
+      serverResumed + 1);
+  }
+
+  TEST_CASE("gathered_write") {
+    static_assert(IsGatherWriter<SecureSocketWriter>::value);
+    auto address = IpAddress("127.0.0.1", 20193);
+    auto server = SecureServerSocket(address, MakeServerContext());
+    auto serverTask = RoutineHandler(Spawn([&] {
+      Echo(server, 1);
+    }));
+    auto client = SecureSocketChannel(address);
+    auto header = BufferFromString<SharedBuffer>("head");
+    auto body = BufferFromString<SharedBuffer>("body");
+    WriteSequence(client.GetWriter(),
+      BufferSequence<const SharedBuffer&, const SharedBuffer&>(header, body));
+    auto buffer = SharedBuffer();
+    while(buffer.GetSize() != 8) {
+      client.GetReader().Read(Store(buffer));
+    }
+    REQUIRE(std::string(buffer.GetData(), buffer.GetSize()) == "headbody");
+    client.GetConnection().Close();
+    serverTask.Wait();
+  }
+}
@@ -0,0 +1,125 @@
+#ifdef __linux__
+#include <cerrno>
+#include <exception>
+#include <string>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <doctest/doctest.h>
+#include "Beam/IO/SharedBuffer.hpp"
+#include "Beam/Network/UringServerSocket.hpp"
+#include "Beam/Network/UringSocketChannel.hpp"
+#include "Beam/Routines/RoutineHandler.hpp"
+
+using namespace Beam;
+using namespace Beam::IO;
+using namespace Beam::Network;
+using namespace Beam::Routines;
+
+TEST_SUITE("UringSocketChannel") {
+  TEST_CASE("read_write") {
+    if(!IoUringService::IsAvailable()) {
+      return;
+    }
+    auto server = UringServerSocket(IpAddress("127.0.0.1", 20171));
+    auto serverTask = RoutineHandler(Spawn([&] {
+      auto channel = server.Accept();
+      auto buffer = SharedBuffer();
+      while(buffer.GetSize() != 10) {
+        channel->GetReader().Read(Store(buffer));
+      }
+      REQUIRE(std::string(buffer.GetData(), buffer.GetSize()) ==
+        "helloworld");
+      channel->GetWriter().Write(BufferFromString<SharedBuffer>("done"));
+    }));
+    auto client = UringSocketChannel(IpAddress("127.0.0.1", 20171));
+    client.GetWriter().Write(BufferSequence(
+      BufferFromString<SharedBuffer>("hello"),
+      BufferFromString<SharedBuffer>("world")));
+    auto buffer = SharedBuffer();
+    while(buffer.GetSize() != 4) {
+      client.GetReader().Read(Store(buffer));
+    }
+    REQUIRE(std::string(buffer.GetData(), buffer.GetSize()) == "done");
+    serverTask.Wait();
+    REQUIRE_THROWS_AS(client.GetReader().Read(Store(buffer)),
+      EndOfFileException);
+  }
+
+  TEST_CASE("large_write") {
+    if(!IoUringService::IsAvailable()) {
+      return;
+    }
+    auto server = UringServerSocket(IpAddress("127.0.0.1", 20172));
+    auto size = std::size_t(4 * 1024 * 1024);
+    auto serverTask = RoutineHandler(Spawn([&] {
+      auto channel = server.Accept();
+      auto buffer = SharedBuffer();
+      while(buffer.GetSize() != size) {
+        channel->GetReader().Read(Store(buffer), size - buffer.GetSize());
+      }
+      for(auto i = std::size_t(0); i != size; ++i) {
+        REQUIRE(buffer.GetData()[i] == static_cast<char>(i % 251));
+      }
+    }));
+    auto client = UringSocketChannel(IpAddress("127.0.0.1", 20172));
+    auto message = SharedBuffer(size);
+    for(auto i = std::size_t(0); i != size; ++i) {
+      message.GetMutableData()[i] = static_cast<char>(i % 251);
+    }
+    client.GetWriter().Write(message);
+    serverTask.Wait();
+  }
+
+  TEST_CASE("close_server") {
+    if(!IoUringService::IsAvailable()) {
+      return;
+    }
+    auto server = UringServerSocket(IpAddress("127.0.0.1", 20173));
+    auto serverTask = RoutineHandler(Spawn([&] {
+      REQUIRE_THROWS_AS(server.Accept(), EndOfFileException);
+    }));
+    server.Close();
+    serverTask.Wait();
+  }
+
+  TEST_CASE("connection_reset") {
+    if(!IoUringService::IsAvailable()) {
+      return;
+    }
+    auto server = ::socket(AF_INET, SOCK_STREAM, 0);
+    auto address = sockaddr_in();
+    address.sin_family = AF_INET;
+    address.sin_port = htons(20174);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    auto option = 1;
+    ::setsockopt(server, SOL_SOCKET, SO_REUSEADDR, &option, sizeof(option));
+    REQUIRE(::bind(server, reinterpret_cast<sockaddr*>(&address),
+      sizeof(address)) == 0);
+    REQUIRE(::listen(server, 1) == 0);
+    auto client = UringSocketChannel(IpAddress("127.0.0.1", 20174));
+    auto connection = ::accept(server, nullptr, nullptr);
+    REQUIRE(connection >= 0);
+
+    /* Closing with a zero linger time resets the connection. */
+    auto linger = ::linger();
+    linger.l_onoff = 1;
+    linger.l_linger = 0;
+    ::setsockopt(connection, SOL_SOCKET, SO_LINGER, &linger, sizeof(linger));
+    ::close(connection);
+    ::close(server);
+    auto code = 0;
+    auto buffer = SharedBuffer();
+    try {
+      client.GetReader().Read(Store(buffer));
+    } catch(const EndOfFileException& e) {
+      try {
+        std::rethrow_if_nested(e);
+      } catch(const SocketException& e) {
+        code = e.GetCode();
+      }
+    }
+    REQUIRE(code == ECONNRESET);
+  }
+}
+#endif
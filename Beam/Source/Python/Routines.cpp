@@ -1,12 +1,14 @@
 #include "Beam/Python/Routines.hpp"
 #include <pybind11/stl.h>
 #include <pybind11/functional.h>
+#include "Beam/Python/DateTime.hpp"
 #include "Beam/Python/GilRelease.hpp"
 #include "Beam/Python/SharedObject.hpp"
 #include "Beam/Routines/Routine.hpp"
 #include "Beam/Routines/RoutineException.hpp"
 #include "Beam/Routines/RoutineHandler.hpp"
 #include "Beam/Routines/RoutineHandlerGroup.hpp"
+#include "Beam/Routines/Scheduler.hpp"
 
 using namespace Beam;
 using namespace Beam::Python;
@@ -63,12 +65,38 @@ void Beam::Python::ExportRoutineHandlerGroup(pybind11::module& module) {
     .def("wait", &RoutineHandlerGroup::Wait, call_guard<GilRelease>());
 }
 
+void Beam::Python::ExportSchedulerStatistics(pybind11::module& module) {
+  class_<SchedulerContextStatistics>(module, "SchedulerContextStatistics")
+    .def_readonly("pending_count", &SchedulerContextStatistics::m_pendingCount)
+    .def_readonly("suspended_count",
+      &SchedulerContextStatistics::m_suspendedCount)
+    .def_readonly("spawn_count", &SchedulerContextStatistics::m_spawnCount)
+    .def_readonly("completion_count",
+      &SchedulerContextStatistics::m_completionCount)
+    .def_readonly("context_switch_count",
+      &SchedulerContextStatistics::m_contextSwitchCount)
+    .def_readonly("long_slice_count",
+      &SchedulerContextStatistics::m_longSliceCount)
+    .def_readonly("running_time", &SchedulerContextStatistics::m_runningTime)
+    .def_readonly("idle_time", &SchedulerContextStatistics::m_idleTime);
+  class_<SchedulerStatistics>(module, "SchedulerStatistics")
+    .def_readonly("contexts", &SchedulerStatistics::m_contexts)
+    .def_readonly("slice_histogram", &SchedulerStatistics::m_sliceHistogram)
+    .def_readonly("steal_count", &SchedulerStatistics::m_stealCount)
+    .def_readonly("migration_count", &SchedulerStatistics::m_migrationCount)
+    .def_static("get_slice_bucket_bound",
+      &SchedulerStatistics::GetSliceBucketBound);
+  module.def("get_scheduler_statistics", &GetSchedulerStatistics,
+    call_guard<GilRelease>());
+}
+
 void Beam::Python::ExportRoutines(pybind11::module& module) {
   auto submodule = module.def_submodule("routines");
   ExportBaseAsync(submodule);
   ExportBaseEval(submodule);
   ExportRoutineHandler(submodule);
   ExportRoutineHandlerGroup(submodule);
+  ExportSchedulerStatistics(submodule);
   ExportAsync<object>(submodule, "");
   ExportEval<object>(submodule, "");
   submodule.def("spawn",
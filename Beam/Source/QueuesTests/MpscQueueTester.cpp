@@ -0,0 +1,106 @@
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <doctest/doctest.h>
+#include "Beam/Queues/MpscQueue.hpp"
+#include "Beam/Queues/RoutineTaskQueue.hpp"
+#include "Beam/Routines/RoutineHandler.hpp"
+
+using namespace Beam;
+using namespace Beam::Routines;
+
+namespace {
+  template<typename Q>
+  void PushPop(Q& queue, int producerCount, int count) {
+    auto producers = std::vector<std::thread>();
+    for(auto i = 0; i < producerCount; ++i) {
+      producers.emplace_back([&, i] {
+        for(auto j = 0; j < count; ++j) {
+          queue.Push(i * count + j);
+        }
+      });
+    }
+
+    /* Each producer's values must arrive in the order they were pushed, and
+       every value must arrive exactly once. */
+    auto nextValues = std::vector<int>(producerCount);
+    for(auto i = 0; i < producerCount * count; ++i) {
+      auto value = queue.Pop();
+      auto producer = value / count;
+      REQUIRE(producer >= 0);
+      REQUIRE(producer < producerCount);
+      REQUIRE(value % count == nextValues[producer]);
+      ++nextValues[producer];
+    }
+    for(auto& producer : producers) {
+      producer.join();
+    }
+    for(auto nextValue : nextValues) {
+      REQUIRE(nextValue == count);
+    }
+    REQUIRE(!queue.TryPop());
+  }
+}
+
+TEST_SUITE("MpscQueue") {
+  TEST_CASE("push_pop") {
+    auto queue = MpscQueue<int>();
+    REQUIRE(!queue.TryPop());
+    for(auto i = 0; i < 1000; ++i) {
+      queue.Push(i);
+    }
+    for(auto i = 0; i < 1000; ++i) {
+      REQUIRE(queue.Pop() == i);
+    }
+    REQUIRE(!queue.TryPop());
+  }
+
+  TEST_CASE("break") {
+    auto queue = MpscQueue<std::string>();
+    queue.Push("a");
+    queue.Break();
+    REQUIRE_THROWS_AS(queue.Push("b"), PipeBrokenException);
+    REQUIRE(!queue.IsBroken());
+    REQUIRE(queue.Pop() == "a");
+    REQUIRE(queue.IsBroken());
+    REQUIRE_THROWS_AS(queue.Pop(), PipeBrokenException);
+  }
+
+  TEST_CASE("suspended_pop") {
+    auto queue = MpscQueue<int>();
+    auto value = 0;
+    auto routine = RoutineHandler(Spawn([&] {
+      value = queue.Pop();
+    }));
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    queue.Push(123);
+    routine.Wait();
+    REQUIRE(value == 123);
+  }
+
+  TEST_CASE("multiple_producers") {
+    const auto COUNT = 100000;
+    auto queue = MpscQueue<int>();
+    PushPop(queue, 4, COUNT);
+  }
+
+  TEST_CASE("bounded") {
+    const auto COUNT = 100000;
+    auto queue = MpscQueue<int>(16);
+    PushPop(queue, 4, COUNT);
+  }
+
+  TEST_CASE("routine_task_queue") {
+    auto tasks = RoutineTaskQueue(
+      std::make_unique<MpscQueue<std::function<void ()>>>());
+    auto count = 0;
+    for(auto i = 0; i < 100; ++i) {
+      tasks.Push([&] {
+        ++count;
+      });
+    }
+    tasks.Break();
+    tasks.Wait();
+    REQUIRE(count == 100);
+  }
+}
@@ -1,4 +1,8 @@
+#include <algorithm>
 #include <atomic>
+#include <deque>
+#include <random>
+#include <boost/thread/thread.hpp>
 #include <doctest/doctest.h>
 #include "Beam/Queues/Queue.hpp"
 #include "Beam/Routines/RoutineHandler.hpp"
@@ -31,4 +35,146 @@ TEST_SUITE("Queue") {
     r2.Wait();
     REQUIRE(exceptionCount == 2);
   }
+
+  TEST_CASE("drop_oldest") {
+    auto q = Queue<int>(2, OverflowPolicy::DROP_OLDEST);
+    q.Push(1);
+    q.Push(2);
+    q.Push(3);
+    REQUIRE(q.Pop() == 2);
+    REQUIRE(q.Pop() == 3);
+    REQUIRE(!q.TryPop());
+    REQUIRE(q.GetStatistics().m_dropCount == 1);
+  }
+
+  TEST_CASE("drop_newest") {
+    auto q = Queue<int>(2, OverflowPolicy::DROP_NEWEST);
+    q.Push(1);
+    q.Push(2);
+    q.Push(3);
+    REQUIRE(q.Pop() == 1);
+    REQUIRE(q.Pop() == 2);
+    REQUIRE(!q.TryPop());
+    REQUIRE(q.GetStatistics().m_dropCount == 1);
+  }
+
+  TEST_CASE("conflate") {
+    auto q = Queue<std::pair<int, int>>(2, [] (const auto& value) {
+      return value.first;
+    });
+    q.Push({1, 10});
+    q.Push({2, 20});
+    q.Push({1, 11});
+    REQUIRE(q.Pop() == std::pair(1, 11));
+    q.Push({3, 30});
+    q.Push({4, 40});
+    REQUIRE(q.Pop() == std::pair(3, 30));
+    REQUIRE(q.Pop() == std::pair(4, 40));
+    REQUIRE(q.GetStatistics().m_dropCount == 2);
+  }
+
+  TEST_CASE("conflate_sequence") {
+    auto q = Queue<std::pair<int, int>>(5, [] (const auto& value) {
+      return value.first;
+    });
+    auto expected = std::deque<std::pair<int, int>>();
+    auto random = std::minstd_rand(1);
+    for(auto i = 0; i < 10000; ++i) {
+      if(random() % 3 == 0) {
+        auto value = q.TryPop();
+        if(expected.empty()) {
+          REQUIRE(!value);
+        } else {
+          REQUIRE(value == expected.front());
+          expected.pop_front();
+        }
+        continue;
+      }
+      auto value = std::pair(static_cast<int>(random() % 8), i);
+      auto pending = std::find_if(expected.begin(), expected.end(),
+        [&] (const auto& expectedValue) {
+          return expectedValue.first == value.first;
+        });
+      if(pending != expected.end()) {
+        *pending = value;
+      } else {
+        if(expected.size() == 5) {
+          expected.pop_front();
+        }
+        expected.push_back(value);
+      }
+      q.Push(value);
+    }
+    auto values = q.TryPopAll(5);
+    REQUIRE(values == std::vector(expected.begin(), expected.end()));
+  }
+
+  TEST_CASE("block") {
+    auto q = Queue<int>(1, OverflowPolicy::BLOCK);
+    q.Push(1);
+    auto isPushed = std::atomic_bool(false);
+    auto producer = RoutineHandler(Spawn(
+      [&] {
+        q.Push(2);
+        isPushed = true;
+      }));
+    boost::this_thread::sleep_for(boost::chrono::milliseconds(10));
+    REQUIRE(!isPushed);
+    REQUIRE(q.Pop() == 1);
+    producer.Wait();
+    REQUIRE(isPushed);
+    REQUIRE(q.Pop() == 2);
+    REQUIRE(q.GetStatistics().m_dropCount == 0);
+  }
+
+  TEST_CASE("block_break") {
+    auto q = Queue<int>(1, OverflowPolicy::BLOCK);
+    q.Push(1);
+    auto isBroken = std::atomic_bool(false);
+    auto producer = RoutineHandler(Spawn(
+      [&] {
+        try {
+          q.Push(2);
+        } catch(const PipeBrokenException&) {
+          isBroken = true;
+        }
+      }));
+    q.Break();
+    producer.Wait();
+    REQUIRE(isBroken);
+    REQUIRE(q.Pop() == 1);
+  }
+
+  TEST_CASE("pop_all") {
+    auto q = Queue<int>();
+    q.Push(1);
+    q.Push(2);
+    q.Push(3);
+    auto values = std::vector<int>{0};
+    q.PopAll(Store(values));
+    REQUIRE(values == std::vector{0, 1, 2, 3});
+    REQUIRE(q.TryPopAll(10).empty());
+    q.Push(4);
+    q.Push(5);
+    q.Push(6);
+    REQUIRE(q.TryPopAll(2) == std::vector{4, 5});
+    REQUIRE(q.TryPopAll(2) == std::vector{6});
+    q.Break();
+    REQUIRE_THROWS_AS(q.PopAll(Store(values)), PipeBrokenException);
+  }
+
+  TEST_CASE("pop_all_batch") {
+    const auto COUNT = 1000;
+    auto q = Queue<int>();
+    auto expected = std::vector<int>();
+    for(auto i = 0; i < COUNT; ++i) {
+      q.Push(i);
+      expected.push_back(i);
+    }
+    auto values = std::vector<int>();
+    q.PopAll(Store(values));
+    REQUIRE(values.size() == COUNT);
+    REQUIRE(values == expected);
+    REQUIRE(q.TryPopAll(COUNT).empty());
+  }
 }
@@ -0,0 +1,70 @@
+#include <chrono>
+#include <thread>
+#include <doctest/doctest.h>
+#include "Beam/Queues/SpscQueue.hpp"
+#include "Beam/Routines/RoutineHandler.hpp"
+
+using namespace Beam;
+using namespace Beam::Routines;
+
+namespace {
+  template<typename Q>
+  void PushPop(Q& queue, int count) {
+    auto producer = std::thread([&] {
+      for(auto i = 0; i < count; ++i) {
+        queue.Push(i);
+      }
+    });
+    for(auto i = 0; i < count; ++i) {
+      REQUIRE(queue.Pop() == i);
+    }
+    producer.join();
+    REQUIRE(!queue.TryPop());
+  }
+}
+
+TEST_SUITE("SpscQueue") {
+  TEST_CASE("push_pop") {
+    auto queue = SpscQueue<std::string>();
+    REQUIRE(!queue.TryPop());
+    for(auto i = 0; i < 1000; ++i) {
+      queue.Push(std::to_string(i));
+    }
+    for(auto i = 0; i < 1000; ++i) {
+      REQUIRE(queue.Pop() == std::to_string(i));
+    }
+    REQUIRE(!queue.TryPop());
+  }
+
+  TEST_CASE("break") {
+    auto queue = SpscQueue<int>();
+    queue.Push(1);
+    queue.Break();
+    REQUIRE_THROWS_AS(queue.Push(2), PipeBrokenException);
+    REQUIRE(queue.Pop() == 1);
+    REQUIRE(queue.IsBroken());
+    REQUIRE_THROWS_AS(queue.Pop(), PipeBrokenException);
+  }
+
+  TEST_CASE("suspended_pop") {
+    auto queue = SpscQueue<int>();
+    auto value = 0;
+    auto routine = RoutineHandler(Spawn([&] {
+      value = queue.Pop();
+    }));
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    queue.Push(321);
+    routine.Wait();
+    REQUIRE(value == 321);
+  }
+
+  TEST_CASE("unbounded") {
+    auto queue = SpscQueue<int>();
+    PushPop(queue, 100000);
+  }
+
+  TEST_CASE("bounded") {
+    auto queue = SpscQueue<int>(8);
+    PushPop(queue, 100000);
+  }
+}
@@ -1,4 +1,5 @@
 #include <atomic>
+#include <boost/thread/thread.hpp>
 #include <doctest/doctest.h>
 #include "Beam/Queues/StateQueue.hpp"
 #include "Beam/Routines/RoutineHandler.hpp"
@@ -42,4 +43,29 @@ TEST_SUITE("StateQueue") {
     q.Break();
     REQUIRE_THROWS_AS(q.Peek(), PipeBrokenException);
   }
+
+  TEST_CASE("drop_newest") {
+    auto q = StateQueue<int>(OverflowPolicy::DROP_NEWEST);
+    q.Push(123);
+    q.Push(456);
+    REQUIRE(q.Pop() == 123);
+    REQUIRE(q.GetStatistics().m_dropCount == 1);
+  }
+
+  TEST_CASE("block") {
+    auto q = StateQueue<int>(OverflowPolicy::BLOCK);
+    q.Push(123);
+    auto isPushed = std::atomic_bool(false);
+    auto producer = RoutineHandler(Spawn(
+      [&] {
+        q.Push(456);
+        isPushed = true;
+      }));
+    boost::this_thread::sleep_for(boost::chrono::milliseconds(10));
+    REQUIRE(!isPushed);
+    REQUIRE(q.Pop() == 123);
+    producer.Wait();
+    REQUIRE(q.Pop() == 456);
+    REQUIRE(q.GetStatistics().m_dropCount == 0);
+  }
 }
@@ -1,3 +1,4 @@
+#include <vector>
 #include <doctest/doctest.h>
 #include "Beam/Queues/TaskQueue.hpp"
 
@@ -16,4 +17,20 @@ TEST_SUITE("TaskQueue") {
     queue.Pop()();
     REQUIRE(receivedBreak);
   }
+
+  TEST_CASE("handle_tasks") {
+    auto queue = TaskQueue();
+    auto values = std::vector<int>();
+    queue.Push([&] {
+      values.push_back(1);
+      queue.Push([&] {
+        values.push_back(3);
+      });
+    });
+    queue.Push([&] {
+      values.push_back(2);
+    });
+    HandleTasks(queue);
+    REQUIRE(values == std::vector{1, 2, 3});
+  }
 }
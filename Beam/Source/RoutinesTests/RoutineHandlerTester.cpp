@@ -0,0 +1,52 @@
+#include <atomic>
+#include <doctest/doctest.h>
+#include "Beam/Routines/RoutineHandlerGroup.hpp"
+
+using namespace Beam;
+using namespace Beam::Routines;
+
+TEST_SUITE("RoutineHandler") {
+  TEST_CASE("wait") {
+    auto counter = std::atomic_int(0);
+    auto routine = RoutineHandler(Spawn([&] {
+      Defer();
+      ++counter;
+    }));
+    routine.Wait();
+    REQUIRE(counter == 1);
+    REQUIRE(routine.GetId() == 0);
+  }
+
+  TEST_CASE("wait_completed") {
+    auto id = Spawn([] {});
+    Wait(id);
+    Wait(id);
+  }
+
+  TEST_CASE("wait_pinned") {
+    auto& scheduler = Routines::Details::Scheduler::GetInstance();
+    auto counter = std::atomic_int(0);
+    auto routines = RoutineHandlerGroup();
+    for(auto i = std::size_t(0); i != 4 * scheduler.GetThreadCount(); ++i) {
+      routines.Add(Spawn([&] {
+        ++counter;
+      }, Routines::Details::Scheduler::DEFAULT_STACK_SIZE,
+        i % scheduler.GetThreadCount()));
+    }
+    routines.Wait();
+    REQUIRE(counter == 4 * static_cast<int>(scheduler.GetThreadCount()));
+  }
+
+  TEST_CASE("group_wait") {
+    auto counter = std::atomic_int(0);
+    auto routines = RoutineHandlerGroup();
+    for(auto i = 0; i < 100; ++i) {
+      routines.Spawn([&] {
+        Defer();
+        ++counter;
+      });
+    }
+    routines.Wait();
+    REQUIRE(counter == 100);
+  }
+}
@@ -0,0 +1,98 @@
+#include <thread>
+#include <doctest/doctest.h>
+#include "Beam/Routines/RoutineHandlerGroup.hpp"
+
+using namespace Beam;
+using namespace Beam::Routines;
+using namespace boost::posix_time;
+
+namespace {
+  auto SumContexts(const SchedulerStatistics& statistics,
+      std::uint64_t SchedulerContextStatistics::* field) {
+    auto sum = std::uint64_t(0);
+    for(auto& context : statistics.m_contexts) {
+      sum += context.*field;
+    }
+    return sum;
+  }
+}
+
+TEST_SUITE("SchedulerStatistics") {
+  TEST_CASE("slice_bucket") {
+    REQUIRE(SchedulerStatistics::GetSliceBucket(0) == 0);
+    REQUIRE(SchedulerStatistics::GetSliceBucket(1) == 1);
+    REQUIRE(SchedulerStatistics::GetSliceBucket(3) == 2);
+    REQUIRE(SchedulerStatistics::GetSliceBucket(4) == 3);
+    REQUIRE(SchedulerStatistics::GetSliceBucket(
+      std::numeric_limits<std::uint64_t>::max()) ==
+      SchedulerStatistics::SLICE_HISTOGRAM_SIZE - 1);
+    REQUIRE(SchedulerStatistics::GetSliceBucketBound(0) == microseconds(1));
+    REQUIRE(SchedulerStatistics::GetSliceBucketBound(3) == microseconds(8));
+    REQUIRE(SchedulerStatistics::GetSliceBucketBound(
+      SchedulerStatistics::SLICE_HISTOGRAM_SIZE - 1).is_pos_infinity());
+  }
+
+  TEST_CASE("counters") {
+    const auto ROUTINE_COUNT = 100;
+    auto initialStatistics = GetSchedulerStatistics();
+    REQUIRE(initialStatistics.m_contexts.size() ==
+      Routines::Details::Scheduler::GetInstance().GetThreadCount());
+    auto routines = RoutineHandlerGroup();
+    for(auto i = 0; i < ROUTINE_COUNT; ++i) {
+      routines.Spawn([] {
+        Defer();
+      });
+    }
+    routines.Wait();
+    auto statistics = GetSchedulerStatistics();
+    REQUIRE(SumContexts(statistics, &SchedulerContextStatistics::m_spawnCount) -
+      SumContexts(initialStatistics,
+      &SchedulerContextStatistics::m_spawnCount) == ROUTINE_COUNT);
+    REQUIRE(SumContexts(statistics,
+      &SchedulerContextStatistics::m_completionCount) -
+      SumContexts(initialStatistics,
+      &SchedulerContextStatistics::m_completionCount) >= ROUTINE_COUNT);
+    auto contextSwitchCount = SumContexts(statistics,
+      &SchedulerContextStatistics::m_contextSwitchCount) - SumContexts(
+      initialStatistics, &SchedulerContextStatistics::m_contextSwitchCount);
+    REQUIRE(contextSwitchCount >= 2 * ROUTINE_COUNT);
+    auto sliceCount = std::uint64_t(0);
+    for(auto i = std::size_t(0); i != statistics.m_sliceHistogram.size(); ++i) {
+      sliceCount += statistics.m_sliceHistogram[i] -
+        initialStatistics.m_sliceHistogram[i];
+    }
+    REQUIRE(sliceCount == contextSwitchCount);
+  }
+
+  TEST_CASE("watchdog") {
+    auto options = SchedulerOptions();
+    options.m_threadCount = 1;
+    options.m_watchdogThreshold = milliseconds(10);
+    auto reportCount = 0;
+    auto reportedId = Routine::Id(0);
+    auto reportedContextId = static_cast<std::size_t>(-1);
+    auto reportedDuration = time_duration();
+    options.m_watchdogHook = [&] (auto routineId, auto contextId,
+        auto duration) {
+      ++reportCount;
+      reportedId = routineId;
+      reportedContextId = contextId;
+      reportedDuration = duration;
+    };
+    auto scheduler = Routines::Details::Scheduler(options);
+    auto id = scheduler.Spawn([] {
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }, Routines::Details::Scheduler::DEFAULT_STACK_SIZE, 0);
+    scheduler.Wait(id);
+    scheduler.Spawn([] {}, Routines::Details::Scheduler::DEFAULT_STACK_SIZE, 0);
+    scheduler.Stop();
+    REQUIRE(reportCount == 1);
+    REQUIRE(reportedId == id);
+    REQUIRE(reportedContextId == 0);
+    REQUIRE(reportedDuration >= milliseconds(10));
+    auto statistics = scheduler.GetStatistics();
+    REQUIRE(statistics.m_contexts[0].m_longSliceCount == 1);
+    REQUIRE(statistics.m_contexts[0].m_completionCount == 2);
+    REQUIRE(statistics.m_contexts[0].m_runningTime >= milliseconds(100));
+  }
+}
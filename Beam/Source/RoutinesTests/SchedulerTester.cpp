@@ -0,0 +1,68 @@
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <doctest/doctest.h>
+#include "Beam/Routines/Async.hpp"
+#include "Beam/Routines/Scheduler.hpp"
+
+using namespace Beam;
+using namespace Beam::Routines;
+
+TEST_SUITE("Scheduler") {
+  TEST_CASE("resume_in_owning_scheduler") {
+    auto options = SchedulerOptions();
+    options.m_threadCount = 1;
+    auto scheduler = Routines::Details::Scheduler(options);
+    auto async = Async<int>();
+    auto isWaiting = std::atomic_bool(false);
+    auto result = std::atomic_int(0);
+    auto id = scheduler.Spawn([&] {
+      isWaiting = true;
+      result = async.Get();
+    }, Routines::Details::Scheduler::DEFAULT_STACK_SIZE,
+      static_cast<std::size_t>(-1));
+    while(!isWaiting) {
+      std::this_thread::yield();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    async.GetEval().SetResult(123);
+    scheduler.Wait(id);
+    scheduler.Stop();
+    REQUIRE(result == 123);
+  }
+
+  TEST_CASE("spawn_from_another_scheduler") {
+    auto options = SchedulerOptions();
+    options.m_threadCount = 1;
+    options.m_isWorkStealing = true;
+    auto scheduler = Routines::Details::Scheduler(options);
+    auto contextId = std::atomic_size_t(static_cast<std::size_t>(-1));
+    auto id = std::atomic<Routine::Id>(0);
+
+    /* Spawn from the default Scheduler's last context, whose id is out of
+       range for a single threaded Scheduler. */
+    Routines::Wait(Routines::Spawn([&] {
+      id = scheduler.Spawn([&] {
+        contextId = Routines::GetCurrentContextId();
+      }, Routines::Details::Scheduler::DEFAULT_STACK_SIZE,
+        static_cast<std::size_t>(-1));
+    }, Routines::Details::Scheduler::DEFAULT_STACK_SIZE,
+      Routines::Details::Scheduler::GetInstance().GetThreadCount() - 1));
+    scheduler.Wait(id);
+    scheduler.Stop();
+    REQUIRE(contextId == 0);
+  }
+
+  TEST_CASE("invalid_context_id") {
+    auto options = SchedulerOptions();
+    options.m_threadCount = 2;
+    auto scheduler = Routines::Details::Scheduler(options);
+    REQUIRE_THROWS_AS(scheduler.Spawn([] {},
+      Routines::Details::Scheduler::DEFAULT_STACK_SIZE, 2), std::out_of_range);
+    auto id = scheduler.Spawn([] {},
+      Routines::Details::Scheduler::DEFAULT_STACK_SIZE, 1);
+    scheduler.Wait(id);
+    scheduler.Stop();
+  }
+}
@@ -0,0 +1,103 @@
+#include <vector>
+#include <doctest/doctest.h>
+#include "Beam/Routines/Scheduler.hpp"
+#include "Beam/Routines/StackPool.hpp"
+
+using namespace Beam;
+using namespace Beam::Routines;
+
+TEST_SUITE("StackPool") {
+  TEST_CASE("size_class") {
+    auto pageSize = boost::context::stack_traits::page_size();
+    REQUIRE(StackPool::GetSizeClass(1) == pageSize);
+    REQUIRE(StackPool::GetSizeClass(pageSize) == pageSize);
+    REQUIRE(StackPool::GetSizeClass(pageSize + 1) == 2 * pageSize);
+    REQUIRE(StackPool::GetSizeClass(1048576) == 1048576);
+  }
+
+  TEST_CASE("reuse") {
+    auto& pool = StackPool::GetInstance();
+    auto stack = pool.Allocate(65536, false);
+    auto top = stack.sp;
+    pool.Deallocate(stack, false);
+    auto statistics = pool.GetStatistics();
+    auto reusedStack = pool.Allocate(65536, false);
+    REQUIRE(reusedStack.sp == top);
+    REQUIRE(reusedStack.size == 65536);
+    REQUIRE(pool.GetStatistics().m_reuseCount == statistics.m_reuseCount + 1);
+    pool.Deallocate(reusedStack, false);
+  }
+
+  TEST_CASE("guard_pages") {
+    auto& pool = StackPool::GetInstance();
+    auto stack = pool.Allocate(65536, true);
+    auto top = static_cast<char*>(stack.sp);
+    top[-1] = 'a';
+    (top - stack.size)[0] = 'b';
+    pool.Deallocate(stack, true);
+    auto statistics = pool.GetStatistics();
+    auto unguardedStack = pool.Allocate(65536, false);
+    REQUIRE(pool.GetStatistics().m_releaseCount ==
+      statistics.m_releaseCount + 1);
+    pool.Deallocate(unguardedStack, false);
+  }
+
+  TEST_CASE("cache_limit") {
+    auto& pool = StackPool::GetInstance();
+    auto limit = pool.GetCacheLimit();
+    pool.SetCacheLimit(0);
+    auto statistics = pool.GetStatistics();
+    auto stack = pool.Allocate(32768, false);
+    pool.Deallocate(stack, false);
+    REQUIRE(pool.GetStatistics().m_releaseCount ==
+      statistics.m_releaseCount + 1);
+    pool.SetCacheLimit(limit);
+  }
+
+  TEST_CASE("bounded_cache") {
+    const auto STACK_COUNT = 10;
+    const auto CACHE_LIMIT = 4;
+    auto& pool = StackPool::GetInstance();
+    auto limit = pool.GetCacheLimit();
+    pool.SetCacheLimit(CACHE_LIMIT);
+    auto stacks = std::vector<boost::context::stack_context>();
+    for(auto i = 0; i < STACK_COUNT; ++i) {
+      stacks.push_back(pool.Allocate(262144, false));
+    }
+    auto statistics = pool.GetStatistics();
+    for(auto& stack : stacks) {
+      pool.Deallocate(stack, false);
+    }
+    REQUIRE(pool.GetStatistics().m_releaseCount ==
+      statistics.m_releaseCount + STACK_COUNT - CACHE_LIMIT);
+    stacks.clear();
+    statistics = pool.GetStatistics();
+    for(auto i = 0; i < STACK_COUNT; ++i) {
+      stacks.push_back(pool.Allocate(262144, false));
+    }
+    REQUIRE(pool.GetStatistics().m_reuseCount ==
+      statistics.m_reuseCount + CACHE_LIMIT);
+    REQUIRE(pool.GetStatistics().m_allocationCount ==
+      statistics.m_allocationCount + STACK_COUNT - CACHE_LIMIT);
+    for(auto& stack : stacks) {
+      pool.Deallocate(stack, false);
+    }
+    pool.SetCacheLimit(limit);
+  }
+
+  TEST_CASE("routine_stack_recycled") {
+    const auto ROUTINE_COUNT = 100;
+    auto options = SchedulerOptions();
+    options.m_threadCount = 1;
+    auto scheduler = Routines::Details::Scheduler(options);
+    auto& pool = StackPool::GetInstance();
+    auto statistics = pool.GetStatistics();
+    for(auto i = 0; i < ROUTINE_COUNT; ++i) {
+      scheduler.Wait(scheduler.Spawn([] {},
+        Routines::Details::Scheduler::DEFAULT_STACK_SIZE, 0));
+    }
+    scheduler.Stop();
+    REQUIRE(pool.GetStatistics().m_reuseCount >=
+      statistics.m_reuseCount + ROUTINE_COUNT - 1);
+  }
+}
@@ -0,0 +1,69 @@
+#include <thread>
+#include <doctest/doctest.h>
+#include "Beam/Routines/RoutineHandlerGroup.hpp"
+#include "Beam/Threading/ConditionVariable.hpp"
+#include "Beam/Threading/Mutex.hpp"
+
+using namespace Beam;
+using namespace Beam::Routines;
+using namespace Beam::Threading;
+
+TEST_SUITE("SuspendedRoutineQueue") {
+  TEST_CASE("resume_all") {
+    const auto ROUTINE_COUNT = 200;
+    auto threadCount = Routines::Details::Scheduler::GetInstance().
+      GetThreadCount();
+    auto mutex = Mutex();
+    auto condition = ConditionVariable();
+    auto isReady = false;
+    auto waitingCount = 0;
+    auto resumedCount = 0;
+    auto routines = RoutineHandlerGroup();
+    auto wait = [&] {
+      auto lock = boost::unique_lock(mutex);
+      ++waitingCount;
+      while(!isReady) {
+        condition.wait(lock);
+      }
+      ++resumedCount;
+    };
+    for(auto i = 0; i < ROUTINE_COUNT; ++i) {
+      routines.Add(Spawn(wait,
+        Routines::Details::Scheduler::DEFAULT_STACK_SIZE, i % threadCount));
+    }
+    auto externalWaiter = std::thread(wait);
+    while(true) {
+      auto lock = boost::unique_lock(mutex);
+      if(waitingCount == ROUTINE_COUNT + 1) {
+        isReady = true;
+        condition.notify_all();
+        break;
+      }
+      lock.unlock();
+      std::this_thread::yield();
+    }
+    routines.Wait();
+    externalWaiter.join();
+    REQUIRE(resumedCount == ROUTINE_COUNT + 1);
+  }
+
+  TEST_CASE("resume_pending_suspend") {
+    const auto ROUTINE_COUNT = 1000;
+    auto mutex = Mutex();
+    auto condition = ConditionVariable();
+    auto count = 0;
+    auto routines = RoutineHandlerGroup();
+    for(auto i = 0; i < ROUTINE_COUNT; ++i) {
+      routines.Spawn([&] {
+        auto lock = boost::unique_lock(mutex);
+        ++count;
+        condition.notify_all();
+        while(count != ROUTINE_COUNT) {
+          condition.wait(lock);
+        }
+      });
+    }
+    routines.Wait();
+    REQUIRE(count == ROUTINE_COUNT);
+  }
+}
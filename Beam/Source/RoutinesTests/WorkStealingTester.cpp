@@ -0,0 +1,115 @@
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <doctest/doctest.h>
+#include "Beam/Routines/Scheduler.hpp"
+
+using namespace Beam;
+using namespace Beam::Routines;
+
+namespace {
+  auto MakeOptions() {
+    auto options = SchedulerOptions();
+    options.m_threadCount = 2;
+    options.m_isWorkStealing = true;
+    return options;
+  }
+}
+
+TEST_SUITE("WorkStealing") {
+  TEST_CASE("steal") {
+    const auto ROUTINE_COUNT = 100;
+    auto scheduler = Routines::Details::Scheduler(MakeOptions());
+    REQUIRE(scheduler.IsWorkStealing());
+    auto completionCount = std::atomic_int(0);
+    auto stolenCount = std::atomic_int(0);
+    auto id = scheduler.Spawn([&] {
+      for(auto i = 0; i < ROUTINE_COUNT; ++i) {
+        scheduler.Spawn([&] {
+          if(Routines::GetCurrentContextId() == 1) {
+            ++stolenCount;
+          }
+          ++completionCount;
+        }, Routines::Details::Scheduler::DEFAULT_STACK_SIZE,
+          static_cast<std::size_t>(-1));
+      }
+
+      /* Block context 0 without deferring so that only context 1 can run the
+         spawned Routines. */
+      auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+      while(completionCount != ROUTINE_COUNT &&
+          std::chrono::steady_clock::now() < timeout) {
+        std::this_thread::yield();
+      }
+    }, Routines::Details::Scheduler::DEFAULT_STACK_SIZE, 0);
+    scheduler.Wait(id);
+    scheduler.Stop();
+    REQUIRE(completionCount == ROUTINE_COUNT);
+    REQUIRE(stolenCount == ROUTINE_COUNT);
+    REQUIRE(scheduler.GetStealCount() >= ROUTINE_COUNT);
+    REQUIRE(scheduler.GetMigrationCount() == 0);
+    REQUIRE(scheduler.GetStatistics().m_stealCount ==
+      scheduler.GetStealCount());
+  }
+
+  TEST_CASE("migrate") {
+    auto scheduler = Routines::Details::Scheduler(MakeOptions());
+    auto isMigrated = std::atomic_bool(false);
+    auto id = scheduler.Spawn([&] {
+      auto contextId = Routines::GetCurrentContextId();
+
+      /* Occupy the starting context so that the deferred Routine can only
+         resume by being stolen. */
+      scheduler.Spawn([&] {
+        auto timeout =
+          std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while(!isMigrated && std::chrono::steady_clock::now() < timeout) {
+          std::this_thread::yield();
+        }
+      }, Routines::Details::Scheduler::DEFAULT_STACK_SIZE, contextId);
+      while(Routines::GetCurrentContextId() == contextId) {
+        Defer();
+      }
+      isMigrated = true;
+    }, Routines::Details::Scheduler::DEFAULT_STACK_SIZE,
+      static_cast<std::size_t>(-1));
+    scheduler.Wait(id);
+    scheduler.Stop();
+    REQUIRE(isMigrated);
+    REQUIRE(scheduler.GetStealCount() >= 1);
+    REQUIRE(scheduler.GetMigrationCount() >= 1);
+    REQUIRE(scheduler.GetStatistics().m_migrationCount ==
+      scheduler.GetMigrationCount());
+  }
+
+  TEST_CASE("pinned_routines_never_migrate") {
+    const auto ROUTINE_COUNT = 50;
+    const auto DEFER_COUNT = 20;
+    auto scheduler = Routines::Details::Scheduler(MakeOptions());
+    auto misplacedCount = std::atomic_int(0);
+    auto ids = std::vector<Routine::Id>();
+    for(auto i = 0; i < ROUTINE_COUNT; ++i) {
+      auto contextId = static_cast<std::size_t>(i % 2);
+      ids.push_back(scheduler.Spawn([&, contextId] {
+        for(auto j = 0; j < DEFER_COUNT; ++j) {
+          if(Routines::GetCurrentContextId() != contextId) {
+            ++misplacedCount;
+          }
+          Defer();
+        }
+      }, Routines::Details::Scheduler::DEFAULT_STACK_SIZE, contextId));
+      ids.push_back(scheduler.Spawn([&] {
+        for(auto j = 0; j < DEFER_COUNT; ++j) {
+          Defer();
+        }
+      }, Routines::Details::Scheduler::DEFAULT_STACK_SIZE,
+        static_cast<std::size_t>(-1)));
+    }
+    for(auto id : ids) {
+      scheduler.Wait(id);
+    }
+    scheduler.Stop();
+    REQUIRE(misplacedCount == 0);
+  }
+}
@@ -0,0 +1,50 @@
+#include <string>
+#include <string_view>
+#include <vector>
+#include <doctest/doctest.h>
+#include "Beam/IO/SharedBuffer.hpp"
+#include "Beam/Serialization/BinaryReceiver.hpp"
+#include "Beam/Serialization/BinarySender.hpp"
+#include "Beam/Serialization/ShuttleVector.hpp"
+
+using namespace Beam;
+using namespace Beam::IO;
+using namespace Beam::Serialization;
+
+TEST_SUITE("BinaryReceiver") {
+  TEST_CASE("string_view") {
+    auto buffer = SharedBuffer();
+    auto sender = BinarySender<SharedBuffer>();
+    sender.SetSink(Ref(buffer));
+    sender.Shuttle(std::string("hello"));
+    sender.Shuttle(BufferFromString<SharedBuffer>("world"));
+    sender.Shuttle(std::string_view("goodbye"));
+    sender.Shuttle(std::vector<std::string>{"a", "", "bc"});
+    auto receiver = BinaryReceiver<SharedBuffer>();
+    receiver.SetSource(Ref(buffer));
+    auto view = std::string_view();
+    receiver.Shuttle(view);
+    REQUIRE(view == "hello");
+    REQUIRE(view.data() >= buffer.GetData());
+    REQUIRE(view.data() + view.size() <= buffer.GetData() + buffer.GetSize());
+    receiver.Shuttle(view);
+    REQUIRE(view == "world");
+    auto value = std::string();
+    receiver.Shuttle(value);
+    REQUIRE(value == "goodbye");
+    auto views = std::vector<std::string_view>();
+    receiver.Shuttle(views);
+    REQUIRE(views == std::vector<std::string_view>{"a", "", "bc"});
+  }
+
+  TEST_CASE("truncated_string_view") {
+    auto buffer = SharedBuffer();
+    auto sender = BinarySender<SharedBuffer>();
+    sender.SetSink(Ref(buffer));
+    sender.Shuttle(std::string("hello"));
+    auto receiver = BinaryReceiver<SharedBuffer>();
+    receiver.SetSource(buffer.GetData(), buffer.GetSize() - 1);
+    auto view = std::string_view();
+    REQUIRE_THROWS_AS(receiver.Shuttle(view), SerializationException);
+  }
+}
@@ -0,0 +1,138 @@
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <vector>
+#include <doctest/doctest.h>
+#include "Beam/IO/SharedBuffer.hpp"
+#include "Beam/Serialization/BinaryReceiver.hpp"
+#include "Beam/Serialization/BinarySender.hpp"
+#include "Beam/Serialization/ShuttleArray.hpp"
+#include "Beam/Serialization/ShuttleDeque.hpp"
+#include "Beam/Serialization/ShuttleVector.hpp"
+#include "Beam/SerializationTests/ValueShuttleTests.hpp"
+
+using namespace Beam;
+using namespace Beam::IO;
+using namespace Beam::Serialization;
+using namespace Beam::Serialization::Tests;
+
+namespace {
+  struct Point {
+    std::int32_t m_x;
+    std::int32_t m_y;
+
+    bool operator ==(const Point& rhs) const {
+      return m_x == rhs.m_x && m_y == rhs.m_y;
+    }
+
+    template<typename Shuttler>
+    void Shuttle(Shuttler& shuttle, unsigned int version) {
+      shuttle.Shuttle("x", m_x);
+      shuttle.Shuttle("y", m_y);
+    }
+  };
+
+  struct UnsharedPoint {
+    std::int32_t m_x;
+    std::int32_t m_y;
+
+    template<typename Shuttler>
+    void Shuttle(Shuttler& shuttle, unsigned int version) {
+      shuttle.Shuttle("x", m_x);
+      shuttle.Shuttle("y", m_y);
+    }
+  };
+
+  struct Point3 {
+    std::int32_t m_x;
+    std::int32_t m_y;
+    std::int32_t m_z;
+
+    bool operator ==(const Point3& rhs) const {
+      return m_x == rhs.m_x && m_y == rhs.m_y && m_z == rhs.m_z;
+    }
+
+    template<typename Shuttler>
+    void Shuttle(Shuttler& shuttle, unsigned int version) {
+      shuttle.Shuttle("x", m_x);
+      shuttle.Shuttle("y", m_y);
+      if(version >= 1) {
+        shuttle.Shuttle("z", m_z);
+      } else {
+        m_z = 0;
+      }
+    }
+  };
+}
+
+namespace Beam::Serialization {
+  template<>
+  struct IsBitwiseShuttleable<Point> : std::true_type {};
+
+  template<>
+  struct IsBitwiseShuttleable<Point3> : std::true_type {};
+
+  template<>
+  struct Version<Point3> : std::integral_constant<unsigned int, 1> {};
+}
+
+TEST_SUITE("BitwiseShuttle") {
+  TEST_CASE("sequences") {
+    auto values = std::vector<int>();
+    for(auto i = 0; i != 1000; ++i) {
+      values.push_back(i * i - 500);
+    }
+    TestShuttlingReference(BinarySender<SharedBuffer>(),
+      BinaryReceiver<SharedBuffer>(), values);
+    TestShuttlingReference(BinarySender<SharedBuffer>(),
+      BinaryReceiver<SharedBuffer>(), std::vector<double>());
+    TestShuttlingReference(BinarySender<SharedBuffer>(),
+      BinaryReceiver<SharedBuffer>(), std::array<double, 3>{1.5, -2, 3});
+    TestShuttlingReference(BinarySender<SharedBuffer>(),
+      BinaryReceiver<SharedBuffer>(),
+      std::deque<std::int64_t>(values.begin(), values.end()));
+    TestShuttlingReference(BinarySender<SharedBuffer>(),
+      BinaryReceiver<SharedBuffer>(),
+      std::vector<Point>{{1, 2}, {-3, 4}, {5, -6}});
+  }
+
+  TEST_CASE("matches_elementwise_encoding") {
+    auto points = std::vector<Point>{{1, 2}, {3, 4}};
+    auto unsharedPoints = std::vector<UnsharedPoint>{{1, 2}, {3, 4}};
+    auto sender = BinarySender<SharedBuffer>();
+    auto blockBuffer = SharedBuffer();
+    sender.SetSink(Ref(blockBuffer));
+    sender.Shuttle(points);
+    auto elementBuffer = SharedBuffer();
+    sender.SetSink(Ref(elementBuffer));
+    sender.Shuttle(unsharedPoints);
+    REQUIRE(blockBuffer == elementBuffer);
+  }
+
+  TEST_CASE("truncated") {
+    auto sender = BinarySender<SharedBuffer>();
+    auto buffer = SharedBuffer();
+    sender.SetSink(Ref(buffer));
+    sender.Shuttle(std::vector<int>{1, 2, 3});
+    auto receiver = BinaryReceiver<SharedBuffer>();
+    receiver.SetSource(buffer.GetData(), buffer.GetSize() - 1);
+    auto values = std::vector<int>();
+    REQUIRE_THROWS_AS(receiver.Shuttle(values), SerializationException);
+  }
+
+  TEST_CASE("version_mismatch") {
+    auto sender = BinarySender<SharedBuffer>();
+    auto buffer = SharedBuffer();
+    sender.SetSink(Ref(buffer));
+    sender.Shuttle(std::vector<Point>{{1, 2}, {3, 4}});
+    sender.Shuttle(std::array<Point, 2>{Point{5, 6}, Point{7, 8}});
+    auto receiver = BinaryReceiver<SharedBuffer>();
+    receiver.SetSource(Ref(buffer));
+    auto values = std::vector<Point3>();
+    receiver.Shuttle(values);
+    REQUIRE(values == std::vector<Point3>{{1, 2, 0}, {3, 4, 0}});
+    auto array = std::array<Point3, 2>();
+    receiver.Shuttle(array);
+    REQUIRE(array == std::array<Point3, 2>{Point3{5, 6, 0}, Point3{7, 8, 0}});
+  }
+}
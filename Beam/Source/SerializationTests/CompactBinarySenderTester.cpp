@@ -0,0 +1,109 @@
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+#include <doctest/doctest.h>
+#include "Beam/IO/SharedBuffer.hpp"
+#include "Beam/Queries/IndexedValue.hpp"
+#include "Beam/Queries/QueryResult.hpp"
+#include "Beam/Queries/SequencedValue.hpp"
+#include "Beam/Serialization/CompactBinaryReceiver.hpp"
+#include "Beam/Serialization/CompactBinarySender.hpp"
+#include "Beam/Serialization/ShuttleVector.hpp"
+#include "Beam/SerializationTests/ShuttleTestTypes.hpp"
+#include "Beam/SerializationTests/ValueShuttleTests.hpp"
+
+using namespace Beam;
+using namespace Beam::IO;
+using namespace Beam::Queries;
+using namespace Beam::Serialization;
+using namespace Beam::Serialization::Tests;
+
+namespace {
+  using Sender = CompactBinarySender<SharedBuffer>;
+  using Receiver = CompactBinaryReceiver<SharedBuffer>;
+  using Snapshot =
+    QueryResult<SequencedValue<IndexedValue<std::int64_t, std::string>>>;
+
+  template<typename T>
+  void TestLimits() {
+    for(auto value : {T(0), T(1), std::numeric_limits<T>::min(),
+        std::numeric_limits<T>::max()}) {
+      TestShuttlingReference(Sender(), Receiver(), value);
+    }
+  }
+}
+
+TEST_SUITE("CompactBinarySender") {
+  TEST_CASE("integers") {
+    TestLimits<short>();
+    TestLimits<unsigned short>();
+    TestLimits<int>();
+    TestLimits<unsigned int>();
+    TestLimits<std::int64_t>();
+    TestLimits<std::uint64_t>();
+    TestShuttlingReference(Sender(), Receiver(), -1);
+    TestShuttlingReference(Sender(), Receiver(), 'a');
+    TestShuttlingReference(Sender(), Receiver(), true);
+    TestShuttlingReference(Sender(), Receiver(), 3.25);
+  }
+
+  TEST_CASE("small_values") {
+    auto buffer = SharedBuffer();
+    auto sender = Sender();
+    sender.SetSink(Ref(buffer));
+    sender.Shuttle(std::uint64_t(5));
+    sender.Shuttle(-1);
+    sender.Shuttle(std::string("abc"));
+    REQUIRE(buffer.GetSize() == 6);
+  }
+
+  TEST_CASE("out_of_range") {
+    auto buffer = SharedBuffer();
+    auto sender = Sender();
+    sender.SetSink(Ref(buffer));
+    sender.Shuttle(std::numeric_limits<int>::max() + std::int64_t(1));
+    auto receiver = Receiver();
+    receiver.SetSource(Ref(buffer));
+    auto value = 0;
+    REQUIRE_THROWS_AS(receiver.Shuttle(value), SerializationException);
+    receiver.SetSource(buffer.GetData(), buffer.GetSize() - 1);
+    auto wideValue = std::int64_t();
+    REQUIRE_THROWS_AS(receiver.Shuttle(wideValue), SerializationException);
+  }
+
+  TEST_CASE("structures") {
+    TestShuttlingReference(Sender(), Receiver(),
+      ClassWithShuttleMethod('a', -300, 1.5));
+    TestShuttlingReference(Sender(), Receiver(),
+      std::vector<std::string>{"a", "bc", ""});
+    auto snapshot = Snapshot(7, {SequencedValue(IndexedValue(
+      std::int64_t(-42), std::string("index")), Sequence(123))});
+    auto buffer = SharedBuffer();
+    auto sender = Sender();
+    sender.SetSink(Ref(buffer));
+    sender.Shuttle(snapshot);
+    auto receiver = Receiver();
+    receiver.SetSource(Ref(buffer));
+    auto received = Snapshot();
+    receiver.Shuttle(received);
+    REQUIRE(received.m_queryId == 7);
+    REQUIRE(received.m_snapshot == snapshot.m_snapshot);
+  }
+
+  TEST_CASE("polymorphic") {
+    auto registry = TypeRegistry<Sender>();
+    registry.Register<PolymorphicDerivedClassA>("PolymorphicDerivedClassA");
+    auto sender = Sender(Ref(registry));
+    auto receiver = Receiver(Ref(registry));
+    auto value = std::make_unique<PolymorphicDerivedClassA>();
+    auto buffer = SharedBuffer();
+    sender.SetSink(Ref(buffer));
+    sender.Send(value.get());
+    receiver.SetSource(Ref(buffer));
+    auto received = static_cast<PolymorphicBaseClass*>(nullptr);
+    receiver.Shuttle(received);
+    REQUIRE(received->ToString() == value->ToString());
+    delete received;
+  }
+}
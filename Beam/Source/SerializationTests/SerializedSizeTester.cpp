@@ -0,0 +1,155 @@
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <doctest/doctest.h>
+#include "Beam/IO/SharedBuffer.hpp"
+#include "Beam/Queries/IndexedValue.hpp"
+#include "Beam/Queries/QueryResult.hpp"
+#include "Beam/Queries/SequencedValue.hpp"
+#include "Beam/Serialization/BinaryReceiver.hpp"
+#include "Beam/Serialization/BinarySender.hpp"
+#include "Beam/Serialization/SerializedSize.hpp"
+#include "Beam/Serialization/ShuttleRecord.hpp"
+#include "Beam/SerializationTests/ShuttleTestTypes.hpp"
+
+using namespace Beam;
+using namespace Beam::IO;
+using namespace Beam::Queries;
+using namespace Beam::Serialization;
+using namespace Beam::Serialization::Tests;
+
+namespace {
+  enum class Side {
+    BID,
+    ASK
+  };
+
+  BEAM_DEFINE_RECORD(FixedRecord, std::int64_t, id, double, price, Side,
+    side, FixedString<4>, venue);
+
+  BEAM_DEFINE_RECORD(NestedRecord, FixedRecord, record, bool, flag);
+
+  BEAM_DEFINE_RECORD(VariableRecord, std::string, name, std::int32_t, id);
+
+  using Sender = BinarySender<SharedBuffer>;
+
+  struct ThrowingRecord {
+    std::string m_name;
+    std::int32_t m_id;
+
+    template<typename Shuttler>
+    void Shuttle(Shuttler& shuttle, unsigned int version) {
+      shuttle.Shuttle("name", m_name);
+      if constexpr(std::is_same_v<Shuttler, Sender>) {
+        throw std::runtime_error("Send failed.");
+      }
+      shuttle.Shuttle("id", m_id);
+    }
+  };
+
+  template<typename T>
+  using Snapshot = QueryResult<SequencedValue<IndexedValue<std::int64_t, T>>>;
+
+  template<typename T>
+  Snapshot<T> MakeSnapshot(int size, const T& index) {
+    auto snapshot = Snapshot<T>();
+    snapshot.m_queryId = 7;
+    for(auto i = 0; i != size; ++i) {
+      snapshot.m_snapshot.push_back(SequencedValue(IndexedValue(
+        std::int64_t(100 * i), index),
+        Sequence(static_cast<Sequence::Ordinal>(i + 1))));
+    }
+    return snapshot;
+  }
+
+  template<typename T>
+  void TestSerializedSize(Sender& sender, const T& value) {
+    auto buffer = SharedBuffer();
+    sender.SetSink(Ref(buffer));
+    sender.Shuttle(value);
+    REQUIRE(sender.GetSerializedSize(value) == buffer.GetSize());
+  }
+}
+
+TEST_SUITE("SerializedSize") {
+  TEST_CASE("fixed_size") {
+    static_assert(FixedSerializedSize<std::int16_t>::value == 2);
+    static_assert(FixedSerializedSize<Side>::value == sizeof(int));
+    static_assert(FixedSerializedSize<FixedString<4>>::value == 4);
+    static_assert(FixedSerializedSize<FixedRecord>::value ==
+      sizeof(unsigned int) + 8 + 8 + sizeof(int) + 4);
+    static_assert(FixedSerializedSize<NestedRecord>::value ==
+      sizeof(unsigned int) + FixedSerializedSize<FixedRecord>::value + 1);
+    static_assert(FixedSerializedSize<VariableRecord>::value == 0);
+    static_assert(FixedSerializedSize<std::string>::value == 0);
+    static_assert(FixedSerializedSize<std::vector<int>>::value == 0);
+    auto sender = Sender();
+    TestSerializedSize(sender, FixedRecord(5, 1.5, Side::ASK, "NSDQ"));
+    TestSerializedSize(sender, NestedRecord(
+      FixedRecord(-3, 2.25, Side::BID, "TSX"), true));
+  }
+
+  TEST_CASE("variable_size") {
+    auto sender = Sender();
+    TestSerializedSize(sender, std::string("hello"));
+    TestSerializedSize(sender, VariableRecord("name", 12));
+    TestSerializedSize(sender, ClassWithShuttleMethod('a', 42, 1.5));
+    TestSerializedSize(sender, std::vector<FixedRecord>(3,
+      FixedRecord(1, 2, Side::BID, "ASX")));
+    TestSerializedSize(sender, std::vector<VariableRecord>{
+      VariableRecord("a", 1), VariableRecord("bcd", 2)});
+    TestSerializedSize(sender, MakeSnapshot(10, std::string("MSFT.NSDQ")));
+  }
+
+  TEST_CASE("polymorphic") {
+    auto registry = TypeRegistry<Sender>();
+    registry.Register<PolymorphicDerivedClassA>("PolymorphicDerivedClassA");
+    registry.Register<PolymorphicDerivedClassB>("PolymorphicDerivedClassB");
+    auto sender = Sender(Ref(registry));
+    auto value = std::unique_ptr<PolymorphicBaseClass>(
+      std::make_unique<PolymorphicDerivedClassB>());
+    auto null = static_cast<PolymorphicBaseClass*>(nullptr);
+    TestSerializedSize(sender, value.get());
+    TestSerializedSize(sender, null);
+    sender.SetTypeIdsEnabled(true);
+    TestSerializedSize(sender, value.get());
+    TestSerializedSize(sender, null);
+  }
+
+  TEST_CASE("round_trip") {
+    auto snapshot = MakeSnapshot(100, std::string("MSFT.NSDQ"));
+    auto buffer = SharedBuffer();
+    auto sender = Sender();
+    sender.SetSink(Ref(buffer));
+    sender.Shuttle(snapshot);
+    sender.Shuttle(FixedRecord(9, 3.5, Side::ASK, "LSE"));
+    auto receiver = BinaryReceiver<SharedBuffer>();
+    receiver.SetSource(Ref(buffer));
+    auto receivedSnapshot = decltype(snapshot)();
+    receiver.Shuttle(receivedSnapshot);
+    REQUIRE(receivedSnapshot.m_queryId == snapshot.m_queryId);
+    REQUIRE(receivedSnapshot.m_snapshot == snapshot.m_snapshot);
+    auto record = FixedRecord();
+    receiver.Shuttle(record);
+    REQUIRE(record.id == 9);
+    REQUIRE(record.side == Side::ASK);
+    REQUIRE(record.venue == "LSE");
+  }
+
+  TEST_CASE("send_exception") {
+    auto record = ThrowingRecord{"name", 5};
+    auto buffer = SharedBuffer();
+    auto sender = Sender();
+    sender.SetSink(Ref(buffer));
+    REQUIRE_THROWS_AS(sender.Shuttle(record), std::runtime_error);
+    REQUIRE(buffer.GetSize() ==
+      sender.GetSerializedSize(record) - sizeof(std::int32_t));
+    auto size = buffer.GetSize();
+    auto fixedRecord = FixedRecord(1, 2, Side::BID, "ASX");
+    sender.Shuttle(fixedRecord);
+    REQUIRE(buffer.GetSize() == size + sender.GetSerializedSize(fixedRecord));
+  }
+}
@@ -0,0 +1,99 @@
+#include <string>
+#include <doctest/doctest.h>
+#include "Beam/IO/SharedBuffer.hpp"
+#include "Beam/Serialization/BinaryReceiver.hpp"
+#include "Beam/Serialization/BinarySender.hpp"
+#include "Beam/Serialization/TypeRegistry.hpp"
+#include "Beam/SerializationTests/ShuttleTestTypes.hpp"
+
+using namespace Beam;
+using namespace Beam::IO;
+using namespace Beam::Serialization;
+using namespace Beam::Serialization::Tests;
+
+namespace {
+  using TestRegistry = TypeRegistry<BinarySender<SharedBuffer>>;
+}
+
+TEST_SUITE("TypeRegistry") {
+  TEST_CASE("ids_ignore_registration_order") {
+    auto registryA = TestRegistry();
+    registryA.Register<PolymorphicDerivedClassA>("PolymorphicDerivedClassA");
+    registryA.Register<PolymorphicDerivedClassB>("PolymorphicDerivedClassB");
+    auto registryB = TestRegistry();
+    registryB.Register<PolymorphicDerivedClassB>("PolymorphicDerivedClassB");
+    registryB.Register<PolymorphicDerivedClassA>("PolymorphicDerivedClassA");
+    REQUIRE(registryA.GetEntry<PolymorphicDerivedClassA>().GetId() ==
+      registryB.GetEntry<PolymorphicDerivedClassA>().GetId());
+    REQUIRE(registryA.GetEntry<PolymorphicDerivedClassB>().GetId() ==
+      registryB.GetEntry<PolymorphicDerivedClassB>().GetId());
+    auto nullName = std::string("__null");
+    REQUIRE(registryA.GetEntry(nullName).GetId() == TestRegistry::NULL_ID);
+    auto& entry = registryA.GetEntryById(
+      registryA.GetEntry<PolymorphicDerivedClassB>().GetId());
+    REQUIRE(entry.GetName() == "PolymorphicDerivedClassB");
+    REQUIRE_THROWS_AS(registryA.GetEntryById(3), TypeNotFoundException);
+    REQUIRE(registryA.GetFingerprint() == registryB.GetFingerprint());
+    auto copy = TestRegistry(registryA);
+    REQUIRE(copy.GetFingerprint() == registryA.GetFingerprint());
+    REQUIRE(copy.GetEntry(nullName).GetId() == TestRegistry::NULL_ID);
+  }
+
+  TEST_CASE("assignment") {
+    auto registry = TestRegistry();
+    registry.Register<PolymorphicDerivedClassB>("PolymorphicDerivedClassB");
+    auto copy = TestRegistry();
+    copy.Register<PolymorphicDerivedClassA>("PolymorphicDerivedClassA");
+    {
+      auto source = TestRegistry();
+      source.Register<PolymorphicDerivedClassA>("PolymorphicDerivedClassA");
+      source.Register<PolymorphicDerivedClassB>("PolymorphicDerivedClassB");
+      copy = source;
+      registry = source;
+    }
+    REQUIRE(copy.GetFingerprint() == registry.GetFingerprint());
+    auto id = copy.GetEntry<PolymorphicDerivedClassB>().GetId();
+    REQUIRE(copy.GetEntryById(id).GetName() == "PolymorphicDerivedClassB");
+    REQUIRE_THROWS_AS(copy.GetEntryById(3), TypeNotFoundException);
+    auto& self = copy;
+    copy = self;
+    REQUIRE(copy.GetEntryById(id).GetName() == "PolymorphicDerivedClassB");
+  }
+
+  TEST_CASE("fingerprint_mismatch") {
+    auto registryA = TestRegistry();
+    registryA.Register<PolymorphicDerivedClassA>("PolymorphicDerivedClassA");
+    auto registryB = TestRegistry();
+    registryB.Register<PolymorphicDerivedClassA>("PolymorphicDerivedClassA");
+    registryB.Register<PolymorphicDerivedClassB>("PolymorphicDerivedClassB");
+    REQUIRE(registryA.GetFingerprint() != registryB.GetFingerprint());
+  }
+
+  TEST_CASE("send_by_id") {
+    auto registry = TestRegistry();
+    registry.Register<PolymorphicDerivedClassA>("PolymorphicDerivedClassA");
+    registry.Register<PolymorphicDerivedClassB>("PolymorphicDerivedClassB");
+    auto sender = BinarySender<SharedBuffer>(Ref(registry));
+    auto receiver = BinaryReceiver<SharedBuffer>(Ref(registry));
+    auto value = std::make_unique<PolymorphicDerivedClassB>();
+    auto namedBuffer = SharedBuffer();
+    sender.SetSink(Ref(namedBuffer));
+    sender.Send(value.get());
+    sender.SetTypeIdsEnabled(true);
+    auto idBuffer = SharedBuffer();
+    sender.SetSink(Ref(idBuffer));
+    sender.Send(value.get());
+    auto nullValue = static_cast<PolymorphicBaseClass*>(nullptr);
+    sender.Send(nullValue);
+    REQUIRE(idBuffer.GetSize() < namedBuffer.GetSize());
+    receiver.SetTypeIdsEnabled(true);
+    receiver.SetSource(Ref(idBuffer));
+    auto received = static_cast<PolymorphicBaseClass*>(nullptr);
+    receiver.Shuttle(received);
+    REQUIRE(received != nullptr);
+    REQUIRE(received->ToString() == value->ToString());
+    delete received;
+    receiver.Shuttle(received);
+    REQUIRE(received == nullptr);
+  }
+}
@@ -1,4 +1,6 @@
 #include <string>
+#include <string_view>
+#include <vector>
 #include <doctest/doctest.h>
 #include "Beam/CodecsTests/ReverseDecoder.hpp"
 #include "Beam/CodecsTests/ReverseEncoder.hpp"
@@ -12,6 +14,7 @@
 #include "Beam/IO/SharedBuffer.hpp"
 #include "Beam/Serialization/BinaryReceiver.hpp"
 #include "Beam/Serialization/BinarySender.hpp"
+#include "Beam/Serialization/TypeRegistry.hpp"
 #include "Beam/Services/MessageProtocol.hpp"
 
 using namespace Beam;
@@ -70,4 +73,125 @@ TEST_SUITE("MessageProtocol") {
     auto receivedMessage = protocol.Receive<std::string>();
     REQUIRE(receivedMessage == sentMessage);
   }
+
+  TEST_CASE("receive_batched_messages") {
+    using ProtocolChannel = BasicChannel<NamedChannelIdentifier, NullConnection,
+      PipedReader<SharedBuffer>*, NullWriter>;
+    auto reader = PipedReader<SharedBuffer>();
+    auto writer = PipedWriter<SharedBuffer>(Ref(reader));
+    auto channel = ProtocolChannel("channel", Initialize(), &reader,
+      Initialize());
+    auto protocol = MessageProtocol<ProtocolChannel*,
+      BinarySender<SharedBuffer>>(&channel, BinarySender<SharedBuffer>(),
+      BinaryReceiver<SharedBuffer>(), NullEncoder(), NullDecoder());
+    auto stream = SharedBuffer();
+    for(auto& message : {"hello", "world", "goodbye"}) {
+      auto sender = BinarySender<SharedBuffer>();
+      auto messageBuffer = SharedBuffer();
+      sender.SetSink(Ref(messageBuffer));
+      sender.Send(std::string(message));
+      stream.Append(ToLittleEndian<std::uint32_t>(
+        static_cast<std::uint32_t>(messageBuffer.GetSize())));
+      stream.Append(messageBuffer);
+    }
+    auto splitIndex = stream.GetSize() - 3;
+    writer.Write(stream.GetData(), splitIndex);
+    REQUIRE(protocol.Receive<std::string>() == "hello");
+    REQUIRE(protocol.Receive<std::string>() == "world");
+    writer.Write(stream.GetData() + splitIndex, stream.GetSize() - splitIndex);
+    REQUIRE(protocol.Receive<std::string>() == "goodbye");
+  }
+
+  TEST_CASE("receive_pinned_views") {
+    using ProtocolChannel = BasicChannel<NamedChannelIdentifier, NullConnection,
+      PipedReader<SharedBuffer>*, NullWriter>;
+    auto reader = PipedReader<SharedBuffer>();
+    auto writer = PipedWriter<SharedBuffer>(Ref(reader));
+    auto channel = ProtocolChannel("channel", Initialize(), &reader,
+      Initialize());
+    auto protocol = MessageProtocol<ProtocolChannel*,
+      BinarySender<SharedBuffer>>(&channel, BinarySender<SharedBuffer>(),
+      BinaryReceiver<SharedBuffer>(), NullEncoder(), NullDecoder());
+    auto messages = std::vector<std::string>{"hello", "world", "goodbye"};
+    auto stream = SharedBuffer();
+    for(auto& message : messages) {
+      auto sender = BinarySender<SharedBuffer>();
+      auto messageBuffer = SharedBuffer();
+      sender.SetSink(Ref(messageBuffer));
+      sender.Send(message);
+      stream.Append(ToLittleEndian<std::uint32_t>(
+        static_cast<std::uint32_t>(messageBuffer.GetSize())));
+      stream.Append(messageBuffer);
+    }
+    auto splitIndex = stream.GetSize() - 3;
+    writer.Write(stream.GetData(), splitIndex);
+    auto pins = std::vector<SharedBuffer>(messages.size());
+    auto views = std::vector<std::string_view>();
+    views.push_back(protocol.Receive<std::string_view>(Store(pins[0])));
+    views.push_back(protocol.Receive<std::string_view>(Store(pins[1])));
+    REQUIRE(pins[1].GetSize() < pins[0].GetSize());
+    writer.Write(stream.GetData() + splitIndex, stream.GetSize() - splitIndex);
+    views.push_back(protocol.Receive<std::string_view>(Store(pins[2])));
+    writer.Write(stream);
+    REQUIRE(protocol.Receive<std::string>() == "hello");
+    for(auto i = std::size_t(0); i != messages.size(); ++i) {
+      REQUIRE(views[i] == messages[i]);
+    }
+  }
+
+#ifndef NDEBUG
+  TEST_CASE("unpinned_view_invalidated") {
+    using ProtocolChannel = BasicChannel<NamedChannelIdentifier, NullConnection,
+      PipedReader<SharedBuffer>*, NullWriter>;
+    auto reader = PipedReader<SharedBuffer>();
+    auto writer = PipedWriter<SharedBuffer>(Ref(reader));
+    auto channel = ProtocolChannel("channel", Initialize(), &reader,
+      Initialize());
+    auto protocol = MessageProtocol<ProtocolChannel*,
+      BinarySender<SharedBuffer>>(&channel, BinarySender<SharedBuffer>(),
+      BinaryReceiver<SharedBuffer>(), NullEncoder(), NullDecoder());
+    auto stream = SharedBuffer();
+    for(auto& message : {"hello", "world"}) {
+      auto sender = BinarySender<SharedBuffer>();
+      auto messageBuffer = SharedBuffer();
+      sender.SetSink(Ref(messageBuffer));
+      sender.Send(std::string(message));
+      stream.Append(ToLittleEndian<std::uint32_t>(
+        static_cast<std::uint32_t>(messageBuffer.GetSize())));
+      stream.Append(messageBuffer);
+    }
+    writer.Write(stream);
+    auto view = protocol.Receive<std::string_view>();
+    REQUIRE(view == "hello");
+    REQUIRE(protocol.Receive<std::string_view>() == "world");
+    REQUIRE(view == std::string(view.size(), '\xDD'));
+  }
+#endif
+
+  TEST_CASE("one_sided_negotiation") {
+    using SenderChannel = BasicChannel<NamedChannelIdentifier, NullConnection,
+      NullReader, PipedWriter<SharedBuffer>>;
+    using ReceiverChannel = BasicChannel<NamedChannelIdentifier,
+      NullConnection, PipedReader<SharedBuffer>*, NullWriter>;
+    auto reader = PipedReader<SharedBuffer>();
+    auto senderChannel = SenderChannel("sender", Initialize(), Initialize(),
+      Initialize(Ref(reader)));
+    auto receiverChannel = ReceiverChannel("receiver", Initialize(), &reader,
+      Initialize());
+    auto registry = TypeRegistry<BinarySender<SharedBuffer>>();
+    auto sender = MessageProtocol<SenderChannel*, BinarySender<SharedBuffer>>(
+      &senderChannel, BinarySender<SharedBuffer>(Ref(registry)),
+      BinaryReceiver<SharedBuffer>(Ref(registry)), NullEncoder(),
+      NullDecoder());
+    auto receiver = MessageProtocol<ReceiverChannel*,
+      BinarySender<SharedBuffer>>(&receiverChannel,
+      BinarySender<SharedBuffer>(Ref(registry)),
+      BinaryReceiver<SharedBuffer>(Ref(registry)), NullEncoder(),
+      NullDecoder());
+    sender.NegotiateTypeIds();
+    sender.Send(std::string("hello"));
+    REQUIRE(receiver.Receive<std::string>() == "hello");
+    REQUIRE(!sender.AreTypeIdsEnabled());
+    REQUIRE(receiver.AreTypeIdsEnabled());
+  }
 }
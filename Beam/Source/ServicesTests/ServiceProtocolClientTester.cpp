@@ -1,3 +1,5 @@
+#include <cstdint>
+#include <memory>
 #include <doctest/doctest.h>
 #include "Beam/Codecs/NullDecoder.hpp"
 #include "Beam/Codecs/NullEncoder.hpp"
@@ -5,6 +7,7 @@
 #include "Beam/Services/ServiceSlots.hpp"
 #include "Beam/ServicesTests/TestServices.hpp"
 #include "Beam/Utilities/Capture.hpp"
+#include "Beam/Utilities/Endian.hpp"
 
 using namespace Beam;
 using namespace Beam::Codecs;
@@ -32,6 +35,11 @@ namespace {
     request.SetResult();
   }
 
+  struct UnsharedType {
+    template<typename Shuttler>
+    void Shuttle(Shuttler& shuttle, unsigned int version) {}
+  };
+
   void OnExceptionVoidRequest(
       RequestToken<ServerServiceProtocolClient, VoidService>& request, int n,
       int* callbackCount) {
@@ -79,6 +87,145 @@ TEST_SUITE("ServiceProtocolClient") {
     REQUIRE(callbackCount == 2);
   }
 
+  TEST_CASE("negotiate_type_ids") {
+    auto server = TestServerConnection();
+    auto callbackCount = 0;
+    auto serverTypeIds = false;
+    auto clientTypeIds = false;
+    auto serverTask = RoutineHandler(Spawn(
+      [&] {
+        auto clientChannel = server.Accept();
+        auto client = ServerServiceProtocolClient(std::move(clientChannel),
+          Initialize());
+        client.SetTypeIdNegotiation(true);
+        RegisterTestServices(Store(client.GetSlots()));
+        VoidService::AddRequestSlot(Store(client.GetSlots()),
+          std::bind(OnVoidRequest, std::placeholders::_1, std::placeholders::_2,
+          &callbackCount));
+        try {
+          while(true) {
+            auto message = client.ReadMessage();
+            serverTypeIds = client.AreTypeIdsEnabled();
+            auto slot = client.GetSlots().Find(*message);
+            if(slot != nullptr) {
+              message->EmitSignal(slot, Ref(client));
+            }
+          }
+        } catch(const ServiceRequestException&) {
+        } catch(const EndOfFileException&) {
+        }
+      }));
+    auto clientTask = RoutineHandler(Spawn(
+      [&] {
+        auto client = ClientServiceProtocolClient(Initialize("client", server),
+          Initialize());
+        client.SetTypeIdNegotiation(true);
+        RegisterTestServices(Store(client.GetSlots()));
+        client.SendRequest<VoidService>(123);
+        clientTypeIds = client.AreTypeIdsEnabled();
+        client.SendRequest<VoidService>(321);
+        client.Close();
+      }));
+    clientTask.Wait();
+    serverTask.Wait();
+    REQUIRE(callbackCount == 2);
+    REQUIRE(serverTypeIds);
+    REQUIRE(clientTypeIds);
+  }
+
+  TEST_CASE("mismatched_type_ids") {
+    auto server = TestServerConnection();
+    auto callbackCount = 0;
+    auto serverTypeIds = true;
+    auto clientTypeIds = true;
+    auto serverTask = RoutineHandler(Spawn(
+      [&] {
+        auto clientChannel = server.Accept();
+        auto client = ServerServiceProtocolClient(std::move(clientChannel),
+          Initialize());
+        client.SetTypeIdNegotiation(true);
+        RegisterTestServices(Store(client.GetSlots()));
+        VoidService::AddRequestSlot(Store(client.GetSlots()),
+          std::bind(OnVoidRequest, std::placeholders::_1, std::placeholders::_2,
+          &callbackCount));
+        try {
+          while(true) {
+            auto message = client.ReadMessage();
+            serverTypeIds = client.AreTypeIdsEnabled();
+            auto slot = client.GetSlots().Find(*message);
+            if(slot != nullptr) {
+              message->EmitSignal(slot, Ref(client));
+            }
+          }
+        } catch(const ServiceRequestException&) {
+        } catch(const EndOfFileException&) {
+        }
+      }));
+    auto clientTask = RoutineHandler(Spawn(
+      [&] {
+        auto client = ClientServiceProtocolClient(Initialize("client", server),
+          Initialize());
+        client.SetTypeIdNegotiation(true);
+        RegisterTestServices(Store(client.GetSlots()));
+        client.GetSlots().GetRegistry().Register<UnsharedType>("UnsharedType");
+        client.SendRequest<VoidService>(123);
+        clientTypeIds = client.AreTypeIdsEnabled();
+        client.SendRequest<VoidService>(321);
+        client.Close();
+      }));
+    clientTask.Wait();
+    serverTask.Wait();
+    REQUIRE(callbackCount == 2);
+    REQUIRE(!serverTypeIds);
+    REQUIRE(!clientTypeIds);
+  }
+
+  TEST_CASE("default_wire_format") {
+    auto server = TestServerConnection();
+    auto header = std::uint32_t(0);
+    auto message =
+      std::unique_ptr<Message<ServerServiceProtocolClient>>();
+    auto serverTask = RoutineHandler(Spawn(
+      [&] {
+
+        /* Decodes the first frame the way a MessageProtocol without type id
+           negotiation does, a size followed by a message sent by name. */
+        auto clientChannel = server.Accept();
+        auto slots = ServiceSlots<ServerServiceProtocolClient>();
+        RegisterTestServices(Store(slots));
+        auto buffer = SharedBuffer();
+        while(buffer.GetSize() < sizeof(header)) {
+          clientChannel->GetReader().Read(Store(buffer));
+        }
+        header = FromLittleEndian(buffer.Extract<std::uint32_t>(0));
+        while(buffer.GetSize() < sizeof(header) + header) {
+          clientChannel->GetReader().Read(Store(buffer));
+        }
+        auto receiver = BinaryReceiver<SharedBuffer>(Ref(slots.GetRegistry()));
+        receiver.SetSource(buffer.GetData() + sizeof(header), header);
+        auto value = static_cast<Message<ServerServiceProtocolClient>*>(
+          nullptr);
+        receiver.Shuttle(value);
+        message.reset(value);
+        clientChannel->GetConnection().Close();
+      }));
+    auto clientTask = RoutineHandler(Spawn(
+      [&] {
+        auto client = ClientServiceProtocolClient(Initialize("client", server),
+          Initialize());
+        RegisterTestServices(Store(client.GetSlots()));
+        try {
+          client.SendRequest<VoidService>(123);
+        } catch(const ServiceRequestException&) {}
+        client.Close();
+      }));
+    clientTask.Wait();
+    serverTask.Wait();
+    REQUIRE(header != Services::Details::NEGOTIATION_FRAME);
+    REQUIRE((header & Services::Details::TYPE_IDS_FLAG) == 0);
+    REQUIRE(message != nullptr);
+  }
+
   TEST_CASE("exception") {
     auto server = TestServerConnection();
     auto callbackCount = 0;
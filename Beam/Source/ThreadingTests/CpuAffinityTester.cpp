@@ -0,0 +1,35 @@
+#include <stdexcept>
+#include <doctest/doctest.h>
+#include "Beam/Threading/CpuAffinity.hpp"
+
+using namespace Beam;
+using namespace Beam::Threading;
+
+TEST_SUITE("CpuAffinity") {
+  TEST_CASE("parse_cpu_list") {
+    REQUIRE(ParseCpuList("").empty());
+    REQUIRE(ParseCpuList("3") == std::vector{3});
+    REQUIRE(ParseCpuList("0-3") == std::vector{0, 1, 2, 3});
+    REQUIRE(ParseCpuList("0-3,8,10-11") ==
+      std::vector{0, 1, 2, 3, 8, 10, 11});
+    REQUIRE(ParseCpuList(" 8, 2 - 3 ,2") == std::vector{2, 3, 8});
+    REQUIRE(ParseCpuList("4-4") == std::vector{4});
+  }
+
+  TEST_CASE("parse_malformed_cpu_list") {
+    REQUIRE_THROWS_AS(ParseCpuList("a"), std::invalid_argument);
+    REQUIRE_THROWS_AS(ParseCpuList("1-"), std::invalid_argument);
+    REQUIRE_THROWS_AS(ParseCpuList("-1"), std::invalid_argument);
+    REQUIRE_THROWS_AS(ParseCpuList("1-2-3"), std::invalid_argument);
+    REQUIRE_THROWS_AS(ParseCpuList("3-1"), std::invalid_argument);
+    REQUIRE_THROWS_AS(ParseCpuList("0,x"), std::invalid_argument);
+  }
+
+  TEST_CASE("exclude_cores") {
+    REQUIRE(ExcludeCores({0, 1, 2, 3}, {1, 3}) == std::vector{0, 2});
+    REQUIRE(ExcludeCores({0, 1, 2, 3}, {}) == std::vector{0, 1, 2, 3});
+    REQUIRE(ExcludeCores({0, 1}, {4, 5}) == std::vector{0, 1});
+    REQUIRE(ExcludeCores({}, {0}).empty());
+    REQUIRE_THROWS_AS(ExcludeCores({0, 1}, {0, 1, 2}), std::invalid_argument);
+  }
+}
@@ -0,0 +1,32 @@
+#include <doctest/doctest.h>
+#include "Beam/Routines/RoutineHandlerGroup.hpp"
+#include "Beam/Threading/Mutex.hpp"
+
+using namespace Beam;
+using namespace Beam::Routines;
+using namespace Beam::Threading;
+
+TEST_SUITE("Mutex") {
+  TEST_CASE("contention") {
+    auto mutex = Mutex();
+    auto counter = 0;
+    auto routines = RoutineHandlerGroup();
+    for(auto i = 0; i < 10; ++i) {
+      routines.Spawn([&] {
+        for(auto j = 0; j < 1000; ++j) {
+          auto lock = boost::lock_guard(mutex);
+          auto value = counter;
+          if(j % 100 == 0) {
+            Defer();
+          }
+          counter = value + 1;
+        }
+      });
+    }
+    routines.Wait();
+    REQUIRE(counter == 10000);
+    REQUIRE(mutex.try_lock());
+    REQUIRE(!mutex.try_lock());
+    mutex.unlock();
+  }
+}
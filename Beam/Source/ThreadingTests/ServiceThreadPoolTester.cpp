@@ -0,0 +1,94 @@
+#include <array>
+#include <doctest/doctest.h>
+#include "Beam/Routines/Scheduler.hpp"
+#include "Beam/Threading/ServiceThreadPool.hpp"
+
+using namespace Beam;
+using namespace Beam::Routines;
+using namespace Beam::Threading;
+
+namespace {
+  void TestServicePerThread(bool isWorkStealing) {
+    auto serviceOptions = ServiceThreadPoolOptions();
+    serviceOptions.m_threadCount = 2;
+    serviceOptions.m_isServicePerThread = true;
+    auto pool = ServiceThreadPool(serviceOptions);
+    auto schedulerOptions = SchedulerOptions();
+    schedulerOptions.m_threadCount = 4;
+    schedulerOptions.m_isWorkStealing = isWorkStealing;
+    auto scheduler = Routines::Details::Scheduler(schedulerOptions);
+    auto contextIds = std::array<std::size_t, 4>();
+    auto services = std::array<boost::asio::io_service*, 4>();
+    auto repeatedServices = std::array<boost::asio::io_service*, 4>();
+
+    /* The contexts are visited out of order so that assigning io_services in
+       the order they are first requested can not pass. */
+    for(auto contextId : {std::size_t(0), std::size_t(1), std::size_t(3),
+        std::size_t(2)}) {
+      scheduler.Wait(scheduler.Spawn([&, contextId] {
+        contextIds[contextId] = Routines::GetCurrentContextId();
+        services[contextId] = &pool.GetService();
+        repeatedServices[contextId] = &pool.GetService();
+      }, Routines::Details::Scheduler::DEFAULT_STACK_SIZE, contextId));
+    }
+    scheduler.Stop();
+    for(auto i = std::size_t(0); i != services.size(); ++i) {
+      REQUIRE(contextIds[i] == i);
+      REQUIRE(repeatedServices[i] == services[i]);
+    }
+    REQUIRE(services[0] != services[1]);
+    REQUIRE(services[0] == services[2]);
+    REQUIRE(services[1] == services[3]);
+  }
+}
+
+TEST_SUITE("ServiceThreadPool") {
+  TEST_CASE("shared_service") {
+    auto options = ServiceThreadPoolOptions();
+    options.m_threadCount = 2;
+    auto pool = ServiceThreadPool(options);
+    auto& service = pool.GetService();
+    auto schedulerOptions = SchedulerOptions();
+    schedulerOptions.m_threadCount = 2;
+    auto scheduler = Routines::Details::Scheduler(schedulerOptions);
+    auto routineService = static_cast<boost::asio::io_service*>(nullptr);
+    scheduler.Wait(scheduler.Spawn([&] {
+      routineService = &pool.GetService();
+    }, Routines::Details::Scheduler::DEFAULT_STACK_SIZE, 1));
+    scheduler.Stop();
+    REQUIRE(routineService == &service);
+  }
+
+  TEST_CASE("service_per_thread") {
+    TestServicePerThread(false);
+  }
+
+  TEST_CASE("service_per_thread_work_stealing") {
+    TestServicePerThread(true);
+  }
+
+  TEST_CASE("next_service") {
+    auto options = ServiceThreadPoolOptions();
+    options.m_threadCount = 2;
+    options.m_isServicePerThread = true;
+    auto pool = ServiceThreadPool(options);
+    auto first = &pool.GetNextService();
+    auto second = &pool.GetNextService();
+    REQUIRE(first != second);
+    REQUIRE(&pool.GetNextService() == first);
+    REQUIRE(&pool.GetNextService() == second);
+  }
+
+  TEST_CASE("share_scheduler_cores") {
+    auto schedulerOptions = SchedulerOptions();
+    schedulerOptions.m_cores = {2, 3, 4};
+    auto options = ServiceThreadPoolOptions();
+    Threading::Details::ShareSchedulerCores(options, schedulerOptions);
+    REQUIRE(options.m_cores.empty());
+    REQUIRE(options.m_threadCount == 0);
+    options.m_isServicePerThread = true;
+    Threading::Details::ShareSchedulerCores(options, schedulerOptions);
+    REQUIRE(options.m_cores == std::vector{2, 3, 4});
+    REQUIRE(options.m_threadCount == 3);
+  }
+}
@@ -0,0 +1,66 @@
+#include <atomic>
+#include <utility>
+#include <doctest/doctest.h>
+#include "Beam/Routines/RoutineHandler.hpp"
+#include "Beam/Routines/RoutineHandlerGroup.hpp"
+#include "Beam/Threading/SharedMutex.hpp"
+#include "Beam/Threading/Sync.hpp"
+
+using namespace Beam;
+using namespace Beam::Routines;
+using namespace Beam::Threading;
+
+TEST_SUITE("SharedMutex") {
+  TEST_CASE("shared_readers") {
+    auto mutex = SharedMutex();
+    mutex.lock_shared();
+    REQUIRE(mutex.try_lock_shared());
+    REQUIRE(!mutex.try_lock());
+    mutex.unlock_shared();
+    mutex.unlock_shared();
+    REQUIRE(mutex.try_lock());
+    REQUIRE(!mutex.try_lock_shared());
+    mutex.unlock();
+  }
+
+  TEST_CASE("writer_preference") {
+    auto mutex = SharedMutex();
+    mutex.lock_shared();
+    auto isWriting = std::atomic_bool(false);
+    auto writer = RoutineHandler(Spawn(
+      [&] {
+        mutex.lock();
+        isWriting = true;
+        mutex.unlock();
+      }));
+    while(mutex.try_lock_shared()) {
+      mutex.unlock_shared();
+    }
+    REQUIRE(!isWriting);
+    mutex.unlock_shared();
+    writer.Wait();
+    REQUIRE(isWriting);
+    REQUIRE(mutex.try_lock_shared());
+    mutex.unlock_shared();
+  }
+
+  TEST_CASE("sync") {
+    auto value = Sync<int, SharedMutex>(0);
+    auto routines = RoutineHandlerGroup();
+    for(auto i = 0; i < 10; ++i) {
+      routines.Spawn([&] {
+        for(auto j = 0; j < 100; ++j) {
+          With(value, [] (auto& value) {
+            ++value;
+          });
+          auto current = With(std::as_const(value), [] (auto& value) {
+            return value;
+          });
+          REQUIRE(current > 0);
+        }
+      });
+    }
+    routines.Wait();
+    REQUIRE(value.Acquire() == 1000);
+  }
+}
@@ -0,0 +1,63 @@
+#include <stdexcept>
+#include <doctest/doctest.h>
+#include "Beam/Threading/ThreadingConfig.hpp"
+
+using namespace Beam;
+using namespace Beam::Threading;
+using namespace boost::posix_time;
+
+TEST_SUITE("ThreadingConfig") {
+  TEST_CASE("parse") {
+    auto config = ThreadingConfig::Parse(YAML::Load(
+      "scheduler:\n"
+      "  threads: 4\n"
+      "  cores: 0-5\n"
+      "  work_stealing: true\n"
+      "service_pool:\n"
+      "  threads: 2\n"
+      "  cores: [4, 5]\n"));
+    REQUIRE(config.m_schedulerOptions.m_threadCount == 4);
+    REQUIRE(config.m_schedulerOptions.m_isWorkStealing);
+    REQUIRE(config.m_schedulerOptions.m_cores == std::vector{0, 1, 2, 3});
+    REQUIRE(config.m_serviceThreadPoolOptions.m_threadCount == 2);
+    REQUIRE(config.m_serviceThreadPoolOptions.m_cores == std::vector{4, 5});
+  }
+
+  TEST_CASE("partial_overlap") {
+    auto config = ThreadingConfig::Parse(YAML::Load(
+      "scheduler:\n"
+      "  cores: 0-3\n"
+      "service_pool:\n"
+      "  cores: 2-5\n"));
+    REQUIRE(config.m_schedulerOptions.m_cores == std::vector{0, 1});
+    REQUIRE(config.m_serviceThreadPoolOptions.m_cores ==
+      std::vector{2, 3, 4, 5});
+  }
+
+  TEST_CASE("complete_overlap") {
+    REQUIRE_THROWS_AS(ThreadingConfig::Parse(YAML::Load(
+      "scheduler:\n"
+      "  cores: 2-3\n"
+      "service_pool:\n"
+      "  cores: 0-3\n")), std::invalid_argument);
+  }
+
+  TEST_CASE("per_thread") {
+    auto config = ThreadingConfig::Parse(YAML::Load(
+      "scheduler:\n"
+      "  cores: 0-3\n"
+      "service_pool:\n"
+      "  per_thread: true\n"));
+    REQUIRE(config.m_serviceThreadPoolOptions.m_isServicePerThread);
+    REQUIRE(config.m_schedulerOptions.m_cores == std::vector{0, 1, 2, 3});
+    REQUIRE(config.m_serviceThreadPoolOptions.m_cores ==
+      std::vector{0, 1, 2, 3});
+    REQUIRE(config.m_serviceThreadPoolOptions.m_threadCount == 4);
+  }
+
+  TEST_CASE("malformed_cores") {
+    REQUIRE_THROWS(ThreadingConfig::Parse(YAML::Load(
+      "scheduler:\n"
+      "  cores: 3-x\n")));
+  }
+}